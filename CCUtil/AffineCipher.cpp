@@ -0,0 +1,238 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Affine cipher from:				https://en.wikipedia.org/wiki/Affine_cipher
+ * Modular inverses from:			https://en.wikipedia.org/wiki/Modular_multiplicative_inverse
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include "AffineCipher.h"
+#include "CaesarCipher.h"
+#include "SubstitutionCipher.h"
+
+// Static Constant Definitions ***********************************************
+const unsigned int AffineCipher::MULTIPLIERS[AffineCipher::MULTIPLIER_COUNT] = { 1, 3, 5, 7, 9, 11, 15, 17, 19, 21, 23, 25 };
+
+// Method Definitions ********************************************************
+bool AffineCipher::isValidKey (const Key& key) {
+
+	const unsigned int multiplier = key.multiplier % CaesarCipher::ALPHABET_LENGTH;
+
+	// 26 is 2 * 13, so any odd multiplier other than 13 will do.
+	return multiplier % 2 != 0 && multiplier != 13;
+
+}
+
+//****************************************************************************
+AffineCipher::Key AffineCipher::invertKey (const Key& key) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	Key inverse;
+
+	// x = a' * (y - b) = a' * y - a' * b, where a' undoes a.
+	inverse.multiplier = invertMultiplier (key.multiplier % ALPHABET_LENGTH);
+	inverse.shift = (ALPHABET_LENGTH - inverse.multiplier * (key.shift % ALPHABET_LENGTH) % ALPHABET_LENGTH) % ALPHABET_LENGTH;
+
+	return inverse;
+
+}
+
+//****************************************************************************
+AffineCipher::Key AffineCipher::getKey (const unsigned int index) {
+
+	Key key;
+
+	key.multiplier = MULTIPLIERS[index / CaesarCipher::ALPHABET_LENGTH];
+	key.shift = index % CaesarCipher::ALPHABET_LENGTH;
+
+	return key;
+
+}
+
+//****************************************************************************
+std::string AffineCipher::getAlphabet (const Key& key) {
+
+	char alphabet[CaesarCipher::ALPHABET_LENGTH];
+
+	if (!isValidKey (key)) {
+
+		throw std::logic_error ("Invalid key. The multiplier of an affine key must be odd and not 13.");
+
+	}
+
+	buildAlphabet (key, alphabet);
+
+	return std::string (alphabet, CaesarCipher::ALPHABET_LENGTH);
+
+}
+
+//****************************************************************************
+std::string AffineCipher::encipher (const std::string& plaintext, const Key& key) {
+
+	std::string ciphertext (plaintext.length (), '\0');
+
+	if (!isValidKey (key)) {
+
+		throw std::logic_error ("Invalid key. The multiplier of an affine key must be odd and not 13.");
+
+	}
+
+	encipher (plaintext.data (), plaintext.length (), key, &ciphertext[0]);
+
+	return ciphertext;
+
+}
+
+//****************************************************************************
+void AffineCipher::encipher (const char* const plaintext, const std::size_t length, const Key& key, char* const ciphertext) {
+
+	char alphabet[CaesarCipher::ALPHABET_LENGTH];
+
+	// Every key is a substitution, so it shares the substitution cipher's
+	// shuffle kernels once its table is built.
+	buildAlphabet (key, alphabet);
+	SubstitutionCipher::encipher (plaintext, length, alphabet, ciphertext);
+
+}
+
+//****************************************************************************
+std::string AffineCipher::decipher (const std::string& ciphertext, const Key& key) {
+
+	std::string plaintext (ciphertext.length (), '\0');
+
+	if (!isValidKey (key)) {
+
+		throw std::logic_error ("Invalid key. The multiplier of an affine key must be odd and not 13.");
+
+	}
+
+	decipher (ciphertext.data (), ciphertext.length (), key, &plaintext[0]);
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+void AffineCipher::decipher (const char* const ciphertext, const std::size_t length, const Key& key, char* const plaintext) {
+
+	encipher (ciphertext, length, invertKey (key), plaintext);
+
+}
+
+//****************************************************************************
+AffineCipher::Key AffineCipher::crackKey (const std::string& ciphertext) {
+
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+
+	CaesarCipher::countLetters (ciphertext, letterCounts);
+
+	return crackKey (letterCounts);
+
+}
+
+//****************************************************************************
+AffineCipher::Key AffineCipher::crackKey (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH]) {
+
+	double chiSquaredSums[KEY_COUNT];
+	unsigned int best = 0;
+
+	scoreKeys (letterCounts, chiSquaredSums);
+
+	for (unsigned int i = 1; i < KEY_COUNT; i++) {
+
+		if (chiSquaredSums[i] < chiSquaredSums[best]) {
+
+			best = i;
+
+		}
+
+	}
+
+	return getKey (best);
+
+}
+
+//****************************************************************************
+void AffineCipher::scoreKeys (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], double chiSquaredSums[KEY_COUNT]) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	unsigned int permutedCounts[ALPHABET_LENGTH];
+	double caesarSums[ALPHABET_LENGTH];
+	unsigned int multiplier = 0;
+
+	for (unsigned int i = 0; i < MULTIPLIER_COUNT; i++) {
+
+		multiplier = MULTIPLIERS[i];
+
+		for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+			permutedCounts[letter] = letterCounts[multiplier * letter % ALPHABET_LENGTH];
+
+		}
+
+		CaesarCipher::scoreKeys (permutedCounts, caesarSums);
+
+		for (unsigned int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+
+			chiSquaredSums[i * ALPHABET_LENGTH + multiplier * shift % ALPHABET_LENGTH] = caesarSums[shift];
+
+		}
+
+	}
+
+}
+
+//****************************************************************************
+void AffineCipher::rankKeys (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], Key rankedKeys[KEY_COUNT], double rankedScores[KEY_COUNT]) {
+
+	double chiSquaredSums[KEY_COUNT];
+	unsigned int rankedIndices[KEY_COUNT];
+
+	scoreKeys (letterCounts, chiSquaredSums);
+	CaesarCipher::rankScores (chiSquaredSums, KEY_COUNT, rankedIndices, rankedScores);
+
+	for (unsigned int i = 0; i < KEY_COUNT; i++) {
+
+		rankedKeys[i] = getKey (rankedIndices[i]);
+
+	}
+
+}
+
+//****************************************************************************
+unsigned int AffineCipher::invertMultiplier (const unsigned int multiplier) {
+
+	unsigned int inverse = 1;
+
+	// Only 12 candidates, so a search is as quick as Euclid.
+	while (multiplier * inverse % CaesarCipher::ALPHABET_LENGTH != 1) {
+
+		inverse += 2;
+
+	}
+
+	return inverse;
+
+}
+
+//****************************************************************************
+void AffineCipher::buildAlphabet (const Key& key, char alphabet[CaesarCipher::ALPHABET_LENGTH]) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const unsigned int multiplier = key.multiplier % ALPHABET_LENGTH;
+	const unsigned int shift = key.shift % ALPHABET_LENGTH;
+
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		alphabet[i] = static_cast<char> ('A' + (multiplier * i + shift) % ALPHABET_LENGTH);
+
+	}
+
+}
@@ -0,0 +1,198 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Affine cipher from:				https://en.wikipedia.org/wiki/Affine_cipher
+ * Modular inverses from:			https://en.wikipedia.org/wiki/Modular_multiplicative_inverse
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "CaesarCipher.h"
+
+#ifndef AFFINE_CIPHER_H
+#define AFFINE_CIPHER_H
+
+/**
+ * Static class with utilities for enciphering, deciphering, and cracking
+ * affine ciphers, which encipher each letter x as a * x + b modulo 26. A
+ * Caesar cipher is the affine cipher with a multiplier of 1. Every key is a
+ * substitution alphabet, so texts are translated by the substitution
+ * cipher's shuffle kernels.
+ */
+class AffineCipher {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * An affine key.
+	 */
+	struct Key {
+
+		unsigned int	multiplier;		/**< Multiplier a, which must share no factor with 26. */
+		unsigned int	shift;			/**< Shift b, the Caesar key applied after multiplying. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int MULTIPLIER_COUNT = 12;												/**< Number of multipliers that share no factor with 26. */
+	static const unsigned int KEY_COUNT = MULTIPLIER_COUNT * CaesarCipher::ALPHABET_LENGTH;		/**< Number of distinct keys. */
+	static const unsigned int MULTIPLIERS[MULTIPLIER_COUNT];										/**< Every multiplier that shares no factor with 26, in ascending order. */
+
+	// Public Methods ********************************************************
+	/**
+	 * Checks whether a key's multiplier shares no factor with 26, so that no
+	 * two letters encipher to the same letter.
+	 * @param key to check.
+	 * @return true if the key can be deciphered, otherwise false.
+	 */
+	static bool isValidKey (const Key& key);
+
+	/**
+	 * Returns the key that undoes a key.
+	 * @param key to invert. Must be valid; it is not checked.
+	 * @return the inverse key, with both parts in [0,26).
+	 */
+	static Key invertKey (const Key& key);
+
+	/**
+	 * Returns the key ranked at an index by scoreKeys.
+	 * @param index, in [0,KEY_COUNT).
+	 * @return the key at that index.
+	 */
+	static Key getKey (const unsigned int index);
+
+	/**
+	 * Returns the substitution alphabet equivalent to a key.
+	 * @param key to convert.
+	 * @return the alphabet, in uppercase.
+	 * @throw logic_error if the key is not valid.
+	 */
+	static std::string getAlphabet (const Key& key);
+
+	/**
+	 * Enciphers a string. Letters keep their case and anything else is left as is.
+	 * @param plaintext to encipher.
+	 * @param key to encipher with.
+	 * @return ciphertext.
+	 * @throw logic_error if the key is not valid.
+	 */
+	static std::string encipher (const std::string& plaintext, const Key& key);
+
+	/**
+	 * Enciphers a buffer with the selected translation kernel, through a
+	 * table built for the key.
+	 * @param plaintext to encipher.
+	 * @param length, number of characters in plaintext.
+	 * @param key to encipher with. Must be valid; it is not checked.
+	 * @param ciphertext, where to store length enciphered characters. May be
+	 * plaintext itself.
+	 */
+	static void encipher (const char* const plaintext, const std::size_t length, const Key& key, char* const ciphertext);
+
+	/**
+	 * Deciphers a string.
+	 * @param ciphertext to decipher.
+	 * @param key the ciphertext was enciphered with.
+	 * @return plaintext.
+	 * @throw logic_error if the key is not valid.
+	 */
+	static std::string decipher (const std::string& ciphertext, const Key& key);
+
+	/**
+	 * Deciphers a buffer by enciphering it with the inverse key.
+	 * @param ciphertext to decipher.
+	 * @param length, number of characters in ciphertext.
+	 * @param key the ciphertext was enciphered with. Must be valid; it is not
+	 * checked.
+	 * @param plaintext, where to store length deciphered characters. May be
+	 * ciphertext itself.
+	 */
+	static void decipher (const char* const ciphertext, const std::size_t length, const Key& key, char* const plaintext);
+
+	/**
+	 * Finds the key that most likely enciphered the given ciphertext.
+	 * @param ciphertext to analyze.
+	 * @return the most-likely key.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * an expected frequency of 0.
+	 */
+	static Key crackKey (const std::string& ciphertext);
+
+	/**
+	 * Finds the key that most likely enciphered a counted ciphertext.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @return the most-likely key.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * an expected frequency of 0.
+	 */
+	static Key crackKey (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH]);
+
+	/**
+	 * Scores every key from a single histogram. Under the multiplier a, the
+	 * letter a * (x + s) enciphers x with the shift a * s, so the counts
+	 * rearranged in the order 0, a, 2a, ... are scored by
+	 * CaesarCipher::scoreKeys for all 26 shifts of that multiplier at once.
+	 * The text is never read again.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @param chiSquaredSums, array to store the chi squared sum of each key in,
+	 * indexed as by getKey. The lower the sum, the more likely the key.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * an expected frequency of 0.
+	 */
+	static void scoreKeys (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], double chiSquaredSums[KEY_COUNT]);
+
+	/**
+	 * Ranks every key by its chi squared sum, as CaesarCipher::rankKeys does.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @param rankedKeys, array to store the keys in, most likely first.
+	 * @param rankedScores, array to store the chi squared sum of each ranked key in.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * an expected frequency of 0.
+	 */
+	static void rankKeys (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], Key rankedKeys[KEY_COUNT], double rankedScores[KEY_COUNT]);
+
+private:
+	// Private Methods *******************************************************
+	/**
+	 * Finds the multiplier that undoes a multiplier modulo 26.
+	 * @param multiplier to invert. Must share no factor with 26.
+	 * @return the inverse multiplier.
+	 */
+	static unsigned int invertMultiplier (const unsigned int multiplier);
+
+	/**
+	 * Builds the translation table of a key without allocating.
+	 * @param key to build the table of.
+	 * @param alphabet, where to store the letter each letter enciphers to, in
+	 * uppercase.
+	 */
+	static void buildAlphabet (const Key& key, char alphabet[CaesarCipher::ALPHABET_LENGTH]);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	AffineCipher (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param affineCipher to copy from.
+	 */
+	AffineCipher (const AffineCipher& affineCipher);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param affineCipher to copy from.
+	 * @return this AffineCipher.
+	 */
+	AffineCipher& operator= (const AffineCipher& affineCipher);
+
+};
+
+#endif
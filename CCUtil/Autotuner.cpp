@@ -0,0 +1,374 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Auto-tuning overview from:		https://en.wikipedia.org/wiki/Auto-tuning
+ * Various function lookups from:	http://www.cplusplus.com/reference/chrono/steady_clock/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include "Autotuner.h"
+#include "BinaryFormat.h"
+#include "CaesarCipher.h"
+#include "FileSystem.h"
+#include "SubstitutionCipher.h"
+#include "WorkStealingPool.h"
+
+// Static Constant Definitions ***********************************************
+const char Autotuner::MAGIC[4] = { 'C', 'C', 'T', 'P' };
+
+// Method Definitions ********************************************************
+Autotuner::Profile Autotuner::getDefaultProfile (void) {
+
+	Profile profile;
+
+	profile.translationKernel = SubstitutionCipher::getWidestTranslationKernel ();
+	profile.countingKernel = CaesarCipher::SIMPLE_COUNTING;
+	profile.threadCount = std::thread::hardware_concurrency ();
+	profile.chunkSize = 1 << 20;
+	profile.parallelThreshold = 4 << 20;
+
+	// hardware_concurrency may return 0 if it cannot tell.
+	if (profile.threadCount == 0) {
+
+		profile.threadCount = 1;
+
+	}
+
+	return profile;
+
+}
+
+//****************************************************************************
+Autotuner::Profile Autotuner::calibrate (const std::size_t sampleSize) {
+
+	const SubstitutionCipher::TranslationKernel previousTranslationKernel = SubstitutionCipher::getTranslationKernel ();
+	const CaesarCipher::CountingKernel previousCountingKernel = CaesarCipher::getCountingKernel ();
+	const unsigned int hardwareThreadCount = getDefaultProfile ().threadCount;
+	const std::size_t length = (sampleSize < MINIMUM_CHUNK_SIZE) ? MINIMUM_CHUNK_SIZE : sampleSize;
+	const SubstitutionCipher::TranslationKernel translationKernels[] = { SubstitutionCipher::SCALAR_TRANSLATION, SubstitutionCipher::SSSE3_TRANSLATION, SubstitutionCipher::AVX512_TRANSLATION };
+	const CaesarCipher::CountingKernel countingKernels[] = { CaesarCipher::SIMPLE_COUNTING, CaesarCipher::INTERLEAVED_COUNTING };
+	Profile profile = getDefaultProfile ();
+	std::string text (length, ' ');
+	std::string output (length, '\0');
+	std::minstd_rand generator (1);
+	unsigned int value = 0;
+	double bestTime = 0.0;
+	double time = 0.0;
+
+	// Mostly lowercase letters and spaces, with a few capitals and stops, so
+	// that every branch of every kernel is taken about as often as in prose.
+	for (std::size_t i = 0; i < length; i++) {
+
+		value = generator () % 100;
+		text[i] = (value < 78) ? static_cast<char> ('a' + generator () % CaesarCipher::ALPHABET_LENGTH) : (value < 93) ? ' ' : (value < 97) ? static_cast<char> ('A' + generator () % CaesarCipher::ALPHABET_LENGTH) : '.';
+
+	}
+
+	bestTime = -1.0;
+
+	for (const SubstitutionCipher::TranslationKernel kernel : translationKernels) {
+
+		if (SubstitutionCipher::setTranslationKernel (kernel)) {
+
+			time = timeEnciphering (text.data (), length, &output[0]);
+
+			if (bestTime < 0.0 || time < bestTime) {
+
+				bestTime = time;
+				profile.translationKernel = kernel;
+
+			}
+
+		}
+
+	}
+
+	SubstitutionCipher::setTranslationKernel (profile.translationKernel);
+	bestTime = -1.0;
+
+	for (const CaesarCipher::CountingKernel kernel : countingKernels) {
+
+		CaesarCipher::setCountingKernel (kernel);
+		time = timeCounting (text.data (), length);
+
+		if (bestTime < 0.0 || time < bestTime) {
+
+			bestTime = time;
+			profile.countingKernel = kernel;
+
+		}
+
+	}
+
+	bestTime = -1.0;
+
+	// Thread counts double up to the hardware's, each tried with chunks from
+	// small enough to balance well to large enough to schedule cheaply. Zero
+	// ends the loop once the hardware's count has been tried.
+	for (unsigned int threadCount = 1; threadCount != 0; threadCount = (threadCount == hardwareThreadCount) ? 0 : (threadCount * 2 < hardwareThreadCount) ? threadCount * 2 : hardwareThreadCount) {
+
+		for (std::size_t chunkSize = MINIMUM_CHUNK_SIZE; chunkSize <= MAXIMUM_CHUNK_SIZE && chunkSize <= length; chunkSize *= 4) {
+
+			time = timeParallelEnciphering (text.data (), length, &output[0], threadCount, chunkSize);
+
+			if (bestTime < 0.0 || time < bestTime) {
+
+				bestTime = time;
+				profile.threadCount = threadCount;
+				profile.chunkSize = chunkSize;
+
+			}
+
+		}
+
+	}
+
+	// Threads pay off from the smallest input that enciphers faster split
+	// over them than whole on one thread.
+	profile.parallelThreshold = NEVER_PARALLEL;
+
+	for (std::size_t size = MINIMUM_CHUNK_SIZE; profile.threadCount > 1 && profile.parallelThreshold == NEVER_PARALLEL && size <= length; size *= 2) {
+
+		const std::size_t chunkSize = (size / profile.threadCount < profile.chunkSize) ? size / profile.threadCount : static_cast<std::size_t> (profile.chunkSize);
+
+		if (timeParallelEnciphering (text.data (), size, &output[0], profile.threadCount, chunkSize) < timeEnciphering (text.data (), size, &output[0])) {
+
+			profile.parallelThreshold = size;
+
+		}
+
+	}
+
+	SubstitutionCipher::setTranslationKernel (previousTranslationKernel);
+	CaesarCipher::setCountingKernel (previousCountingKernel);
+
+	return profile;
+
+}
+
+//****************************************************************************
+void Autotuner::apply (const Profile& profile) {
+
+	SubstitutionCipher::setTranslationKernel (profile.translationKernel);
+	CaesarCipher::setCountingKernel (profile.countingKernel);
+
+}
+
+//****************************************************************************
+unsigned int Autotuner::getThreadCount (const Profile& profile, const unsigned long long inputLength) {
+
+	return (inputLength < profile.parallelThreshold) ? 1 : profile.threadCount;
+
+}
+
+//****************************************************************************
+bool Autotuner::load (const std::string& filename, Profile& profile) {
+
+	std::string contents;
+	std::string::size_type offset = sizeof (MAGIC);
+	unsigned long long size = 0;
+	unsigned long long formatVersion = 0;
+	unsigned long long translationKernel = 0;
+	unsigned long long countingKernel = 0;
+	unsigned long long threadCount = 0;
+	Profile loadedProfile;
+
+	if (filename.empty () || !FileSystem::getFileSize (filename, size) || !FileSystem::readFileRange (filename, 0, size, contents) ||
+		contents.compare (0, sizeof (MAGIC), MAGIC, sizeof (MAGIC)) != 0 || !BinaryFormat::verifyChecksum (contents) ||
+		!BinaryFormat::readInteger (contents, offset, 2, formatVersion) || formatVersion != FORMAT_VERSION ||
+		!BinaryFormat::readInteger (contents, offset, 1, translationKernel) || translationKernel > SubstitutionCipher::AVX512_TRANSLATION ||
+		!BinaryFormat::readInteger (contents, offset, 1, countingKernel) || countingKernel > CaesarCipher::INTERLEAVED_COUNTING ||
+		!BinaryFormat::readInteger (contents, offset, 2, threadCount) || threadCount == 0 ||
+		!BinaryFormat::readInteger (contents, offset, 8, loadedProfile.chunkSize) || loadedProfile.chunkSize == 0 ||
+		!BinaryFormat::readInteger (contents, offset, 8, loadedProfile.parallelThreshold)) {
+
+		return false;
+
+	}
+
+	loadedProfile.translationKernel = static_cast<SubstitutionCipher::TranslationKernel> (translationKernel);
+	loadedProfile.countingKernel = static_cast<CaesarCipher::CountingKernel> (countingKernel);
+	loadedProfile.threadCount = static_cast<unsigned int> (threadCount);
+
+	if (!SubstitutionCipher::isTranslationKernelSupported (loadedProfile.translationKernel)) {
+
+		loadedProfile.translationKernel = SubstitutionCipher::getWidestTranslationKernel ();
+
+	}
+
+	profile = loadedProfile;
+	return true;
+
+}
+
+//****************************************************************************
+bool Autotuner::save (const Profile& profile, const std::string& filename) {
+
+	const std::string temporaryFilename = filename + ".tmp";
+	std::string buffer;
+
+	buffer.append (MAGIC, sizeof (MAGIC));
+	BinaryFormat::appendInteger (buffer, FORMAT_VERSION, 2);
+	BinaryFormat::appendInteger (buffer, profile.translationKernel, 1);
+	BinaryFormat::appendInteger (buffer, profile.countingKernel, 1);
+	BinaryFormat::appendInteger (buffer, profile.threadCount, 2);
+	BinaryFormat::appendInteger (buffer, profile.chunkSize, 8);
+	BinaryFormat::appendInteger (buffer, profile.parallelThreshold, 8);
+	BinaryFormat::appendChecksum (buffer);
+
+	// Written aside and renamed over, so that a CCUtil starting meanwhile
+	// reads the old profile or the new one but never half of one.
+	return FileSystem::writeFile (temporaryFilename, buffer) && FileSystem::replaceFile (temporaryFilename, filename);
+
+}
+
+//****************************************************************************
+std::string Autotuner::getDefaultFilename (void) {
+
+#ifdef _WIN32
+	const char* const directory = getenv ("LOCALAPPDATA");
+#else
+	const char* const directory = getenv ("HOME");
+#endif
+
+	if (directory == nullptr || directory[0] == '\0') {
+
+		return "";
+
+	}
+
+	return FileSystem::joinPath (directory, ".ccutil_tuning");
+
+}
+
+//****************************************************************************
+std::string Autotuner::getKernelName (const SubstitutionCipher::TranslationKernel kernel) {
+
+	switch (kernel) {
+
+	case SubstitutionCipher::SSSE3_TRANSLATION:
+		return "ssse3";
+
+	case SubstitutionCipher::AVX512_TRANSLATION:
+		return "avx512";
+
+	default:
+		return "scalar";
+
+	}
+
+}
+
+//****************************************************************************
+std::string Autotuner::getKernelName (const CaesarCipher::CountingKernel kernel) {
+
+	return (kernel == CaesarCipher::INTERLEAVED_COUNTING) ? "interleaved" : "simple";
+
+}
+
+//****************************************************************************
+bool Autotuner::parseKernelName (const std::string& name, SubstitutionCipher::TranslationKernel& kernel) {
+
+	const SubstitutionCipher::TranslationKernel kernels[] = { SubstitutionCipher::SCALAR_TRANSLATION, SubstitutionCipher::SSSE3_TRANSLATION, SubstitutionCipher::AVX512_TRANSLATION };
+
+	for (const SubstitutionCipher::TranslationKernel candidate : kernels) {
+
+		if (name == getKernelName (candidate)) {
+
+			kernel = candidate;
+			return true;
+
+		}
+
+	}
+
+	return false;
+
+}
+
+//****************************************************************************
+double Autotuner::timeEnciphering (const char* const text, const std::size_t length, char* const output) {
+
+	double bestTime = 0.0;
+
+	for (unsigned int run = 0; run < TIMING_RUNS; run++) {
+
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+
+		CaesarCipher::encipher (text, length, 3, output);
+
+		const double time = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+
+		bestTime = (run == 0 || time < bestTime) ? time : bestTime;
+
+	}
+
+	return bestTime;
+
+}
+
+//****************************************************************************
+double Autotuner::timeCounting (const char* const text, const std::size_t length) {
+
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	double bestTime = 0.0;
+
+	for (unsigned int run = 0; run < TIMING_RUNS; run++) {
+
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+
+		CaesarCipher::countLetters (text, length, letterCounts);
+
+		const double time = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+
+		bestTime = (run == 0 || time < bestTime) ? time : bestTime;
+
+	}
+
+	return bestTime;
+
+}
+
+//****************************************************************************
+double Autotuner::timeParallelEnciphering (const char* const text, const std::size_t length, char* const output, const unsigned int threadCount, const std::size_t chunkSize) {
+
+	WorkStealingPool pool (threadCount);
+	double bestTime = 0.0;
+
+	for (unsigned int run = 0; run < TIMING_RUNS; run++) {
+
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+
+		for (std::size_t offset = 0; offset < length; offset += chunkSize) {
+
+			const std::size_t count = (length - offset < chunkSize) ? length - offset : chunkSize;
+
+			pool.submit ([text, output, offset, count] (void) {
+
+				CaesarCipher::encipher (text + offset, count, 3, output + offset);
+
+			});
+
+		}
+
+		pool.wait ();
+
+		const double time = std::chrono::duration<double> (std::chrono::steady_clock::now () - start).count ();
+
+		bestTime = (run == 0 || time < bestTime) ? time : bestTime;
+
+	}
+
+	return bestTime;
+
+}
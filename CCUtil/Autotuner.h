@@ -0,0 +1,194 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Auto-tuning overview from:		https://en.wikipedia.org/wiki/Auto-tuning
+ * Various function lookups from:	http://www.cplusplus.com/reference/chrono/steady_clock/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "CaesarCipher.h"
+#include "SubstitutionCipher.h"
+
+#ifndef AUTOTUNER_H
+#define AUTOTUNER_H
+
+/**
+ * Static class that measures which kernels, thread count and chunk size are
+ * fastest on this machine and keeps the result as a tuning profile. Which of
+ * them wins depends on the processor and on the size of the input, so the
+ * profile also records the input size from which splitting work over threads
+ * pays for itself. Profiles are small binary files, loaded at startup and
+ * applied before any work is done.
+ */
+class Autotuner {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Choices that make CCUtil fastest on one machine.
+	 */
+	struct Profile {
+
+		SubstitutionCipher::TranslationKernel	translationKernel;	/**< Kernel enciphering and deciphering translate letters with. */
+		CaesarCipher::CountingKernel			countingKernel;		/**< Kernel letters are counted with. */
+		unsigned int							threadCount;		/**< Number of threads parallel work is spread over. */
+		unsigned long long						chunkSize;			/**< Bytes of a large input handed to each task. */
+		unsigned long long						parallelThreshold;	/**< Smallest input worth spreading over threads. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const std::size_t DEFAULT_SAMPLE_SIZE = 16 << 20;	/**< Bytes of text each benchmark runs over. */
+	static const unsigned long long NEVER_PARALLEL = ~0ULL;		/**< Parallel threshold of machines where threads never pay off. */
+
+	// Public Methods ********************************************************
+	/**
+	 * Returns the profile used when there is no saved one: the widest
+	 * translation kernel, simple counting, a thread per hardware thread, 1 MiB
+	 * chunks, and threads from 4 MiB.
+	 * @return the default profile.
+	 */
+	static Profile getDefaultProfile (void);
+
+	/**
+	 * Benchmarks every supported kernel, and every power of two thread count
+	 * up to the hardware's with several chunk sizes, on generated text. The
+	 * kernels in use are restored afterwards.
+	 * @param sampleSize, bytes of text to benchmark on. Larger samples take
+	 * longer but time more reliably.
+	 * @return the fastest profile.
+	 */
+	static Profile calibrate (const std::size_t sampleSize);
+
+	/**
+	 * Makes the kernels of a profile the ones used from now on.
+	 * @param profile to apply.
+	 */
+	static void apply (const Profile& profile);
+
+	/**
+	 * Returns how many threads to process an input with.
+	 * @param profile to decide by.
+	 * @param inputLength, number of bytes in the input.
+	 * @return one below the profile's parallel threshold, otherwise its
+	 * thread count.
+	 */
+	static unsigned int getThreadCount (const Profile& profile, const unsigned long long inputLength);
+
+	/**
+	 * Loads a profile: the bytes "CCTP", a 2 byte format version, a 1 byte
+	 * translation kernel, a 1 byte counting kernel, a 2 byte thread count, an
+	 * 8 byte chunk size, an 8 byte parallel threshold and an 8 byte checksum.
+	 * A translation kernel this processor lacks, as in a profile copied from
+	 * another machine, is replaced by the widest one it has.
+	 * @param filename of the profile.
+	 * @param profile, where to store the profile loaded.
+	 * @return true if loaded, otherwise false.
+	 */
+	static bool load (const std::string& filename, Profile& profile);
+
+	/**
+	 * Saves a profile in the format read by load.
+	 * @param profile to save.
+	 * @param filename to save to.
+	 * @return true if saved, otherwise false.
+	 */
+	static bool save (const Profile& profile, const std::string& filename);
+
+	/**
+	 * Returns where the profile is kept when no other file is given: the file
+	 * ".ccutil_tuning" in the user's home directory, or local application data
+	 * directory on Windows.
+	 * @return the filename, or empty if the directory is unknown.
+	 */
+	static std::string getDefaultFilename (void);
+
+	/**
+	 * Returns the name of a translation kernel.
+	 * @param kernel to name.
+	 * @return "scalar", "ssse3" or "avx512".
+	 */
+	static std::string getKernelName (const SubstitutionCipher::TranslationKernel kernel);
+
+	/**
+	 * Returns the name of a counting kernel.
+	 * @param kernel to name.
+	 * @return "simple" or "interleaved".
+	 */
+	static std::string getKernelName (const CaesarCipher::CountingKernel kernel);
+
+	/**
+	 * Finds the translation kernel with the given name.
+	 * @param name of the kernel, as returned by getKernelName.
+	 * @param kernel, where to store the kernel found.
+	 * @return true if found, otherwise false.
+	 */
+	static bool parseKernelName (const std::string& name, SubstitutionCipher::TranslationKernel& kernel);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;			/**< Version of the profile format. */
+	static const unsigned int TIMING_RUNS = 3;				/**< Times each benchmark is run; the fastest run counts. */
+	static const std::size_t MINIMUM_CHUNK_SIZE = 1 << 16;	/**< Smallest chunk size and input size tried. */
+	static const std::size_t MAXIMUM_CHUNK_SIZE = 1 << 22;	/**< Largest chunk size tried. */
+	static const char MAGIC[4];								/**< Bytes every profile starts with. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Times enciphering a text on one thread with the kernels in use.
+	 * @param text to encipher.
+	 * @param length, number of characters in text.
+	 * @param output, where to store the ciphertext. Must hold length characters.
+	 * @return the fastest of TIMING_RUNS runs, in seconds.
+	 */
+	static double timeEnciphering (const char* const text, const std::size_t length, char* const output);
+
+	/**
+	 * Times counting the letters of a text with the kernels in use.
+	 * @param text to count.
+	 * @param length, number of characters in text.
+	 * @return the fastest of TIMING_RUNS runs, in seconds.
+	 */
+	static double timeCounting (const char* const text, const std::size_t length);
+
+	/**
+	 * Times enciphering a text split into chunks over a pool of threads.
+	 * @param text to encipher.
+	 * @param length, number of characters in text.
+	 * @param output, where to store the ciphertext. Must hold length characters.
+	 * @param threadCount, number of threads in the pool.
+	 * @param chunkSize, characters enciphered by each task.
+	 * @return the fastest of TIMING_RUNS runs, in seconds, including
+	 * scheduling but not starting the threads.
+	 */
+	static double timeParallelEnciphering (const char* const text, const std::size_t length, char* const output, const unsigned int threadCount, const std::size_t chunkSize);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	Autotuner (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param autotuner to copy from.
+	 */
+	Autotuner (const Autotuner& autotuner);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param autotuner to copy from.
+	 * @return this Autotuner.
+	 */
+	Autotuner& operator= (const Autotuner& autotuner);
+
+};
+
+#endif
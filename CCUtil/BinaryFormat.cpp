@@ -0,0 +1,148 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Endianness reference from:	https://en.wikipedia.org/wiki/Endianness
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "BinaryFormat.h"
+#include "ContentHash.h"
+
+// Method Definitions ********************************************************
+void BinaryFormat::appendInteger (std::string& buffer, const unsigned long long value, const unsigned int byteCount) {
+
+	for (unsigned int i = 0; i < byteCount; i++) {
+
+		buffer += static_cast<char> ((value >> (i * 8)) & 0xFF);
+
+	}
+
+}
+
+//****************************************************************************
+void BinaryFormat::storeInteger (char* const data, const unsigned long long value, const unsigned int byteCount) {
+
+	for (unsigned int i = 0; i < byteCount; i++) {
+
+		data[i] = static_cast<char> ((value >> (i * 8)) & 0xFF);
+
+	}
+
+}
+
+//****************************************************************************
+void BinaryFormat::appendDouble (std::string& buffer, const double value) {
+
+	unsigned long long bits = 0;
+
+	memcpy (&bits, &value, sizeof (bits));
+	appendInteger (buffer, bits, sizeof (bits));
+
+}
+
+//****************************************************************************
+bool BinaryFormat::readInteger (const std::string& buffer, std::string::size_type& offset, const unsigned int byteCount, unsigned long long& value) {
+
+	return readInteger (buffer.data (), buffer.length (), offset, byteCount, value);
+
+}
+
+//****************************************************************************
+bool BinaryFormat::readInteger (const char* const data, const std::size_t length, std::size_t& offset, const unsigned int byteCount, unsigned long long& value) {
+
+	if (offset > length || length - offset < byteCount) {
+
+		return false;
+
+	}
+
+	value = 0;
+
+	for (unsigned int i = 0; i < byteCount; i++) {
+
+		value |= static_cast<unsigned long long> (static_cast<unsigned char> (data[offset + i])) << (i * 8);
+
+	}
+
+	offset += byteCount;
+	return true;
+
+}
+
+//****************************************************************************
+bool BinaryFormat::readDouble (const std::string& buffer, std::string::size_type& offset, double& value) {
+
+	unsigned long long bits = 0;
+
+	if (!readInteger (buffer, offset, sizeof (bits), bits)) {
+
+		return false;
+
+	}
+
+	memcpy (&value, &bits, sizeof (value));
+	return true;
+
+}
+
+//****************************************************************************
+void BinaryFormat::appendChecksum (std::string& buffer) {
+
+	appendInteger (buffer, ContentHash::hash64 (buffer), 8);
+
+}
+
+//****************************************************************************
+bool BinaryFormat::verifyChecksum (const std::string& buffer) {
+
+	return verifyChecksum (buffer.data (), buffer.length ());
+
+}
+
+//****************************************************************************
+bool BinaryFormat::verifyChecksum (const char* const data, const std::size_t length) {
+
+	std::size_t offset = 0;
+	unsigned long long checksum = 0;
+
+	if (length < 8) {
+
+		return false;
+
+	}
+
+	offset = length - 8;
+	readInteger (data, length, offset, 8, checksum);
+
+	return checksum == ContentHash::hash64 (data, length - 8, 0);
+
+}
+
+//****************************************************************************
+BinaryFormat::BinaryFormat (void) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+BinaryFormat::BinaryFormat (const BinaryFormat& binaryFormat) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+BinaryFormat& BinaryFormat::operator= (const BinaryFormat& binaryFormat) {
+
+	// Dummy
+	return *this;
+
+}
@@ -0,0 +1,125 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Endianness reference from:	https://en.wikipedia.org/wiki/Endianness
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+
+#ifndef BINARY_FORMAT_H
+#define BINARY_FORMAT_H
+
+/**
+ * Static class with utilities for writing and reading the fields of CCUtil's
+ * binary files. Every integer is stored little endian regardless of the
+ * machine, so files may be shared between machines.
+ */
+class BinaryFormat {
+
+public:
+	// Public Methods ********************************************************
+	/**
+	 * Appends an unsigned integer to a buffer.
+	 * @param buffer to append to.
+	 * @param value to append.
+	 * @param byteCount, number of bytes to store the value in.
+	 */
+	static void appendInteger (std::string& buffer, const unsigned long long value, const unsigned int byteCount);
+
+	/**
+	 * Stores an unsigned integer in bytes that are already allocated, such as
+	 * a region of a buffer filled by several threads at once.
+	 * @param data, where to store the integer. Must hold byteCount bytes.
+	 * @param value to store.
+	 * @param byteCount, number of bytes to store the value in.
+	 */
+	static void storeInteger (char* const data, const unsigned long long value, const unsigned int byteCount);
+
+	/**
+	 * Appends a double to a buffer as its 8 byte IEEE 754 representation.
+	 * @param buffer to append to.
+	 * @param value to append.
+	 */
+	static void appendDouble (std::string& buffer, const double value);
+
+	/**
+	 * Reads an unsigned integer from a buffer.
+	 * @param buffer to read from.
+	 * @param offset of the first byte, advanced past the integer if read.
+	 * @param byteCount, number of bytes the value is stored in.
+	 * @param value, where to store the integer read.
+	 * @return true if the buffer held enough bytes, otherwise false.
+	 */
+	static bool readInteger (const std::string& buffer, std::string::size_type& offset, const unsigned int byteCount, unsigned long long& value);
+
+	/**
+	 * Reads an unsigned integer from raw bytes, such as a mapped file.
+	 * @param data, the bytes to read from.
+	 * @param length, number of bytes in data.
+	 * @param offset of the first byte, advanced past the integer if read.
+	 * @param byteCount, number of bytes the value is stored in.
+	 * @param value, where to store the integer read.
+	 * @return true if the data held enough bytes, otherwise false.
+	 */
+	static bool readInteger (const char* const data, const std::size_t length, std::size_t& offset, const unsigned int byteCount, unsigned long long& value);
+
+	/**
+	 * Reads a double from a buffer.
+	 * @param buffer to read from.
+	 * @param offset of the first byte, advanced past the double if read.
+	 * @param value, where to store the double read.
+	 * @return true if the buffer held enough bytes, otherwise false.
+	 */
+	static bool readDouble (const std::string& buffer, std::string::size_type& offset, double& value);
+
+	/**
+	 * Appends a checksum of everything in the buffer so far.
+	 * @param buffer to checksum and append to.
+	 */
+	static void appendChecksum (std::string& buffer);
+
+	/**
+	 * Checks the checksum at the end of a buffer written with appendChecksum.
+	 * @param buffer to check.
+	 * @return true if the buffer is intact, otherwise false.
+	 */
+	static bool verifyChecksum (const std::string& buffer);
+
+	/**
+	 * Checks the checksum at the end of raw bytes written with appendChecksum.
+	 * @param data, the bytes to check.
+	 * @param length, number of bytes in data, including the checksum.
+	 * @return true if the bytes are intact, otherwise false.
+	 */
+	static bool verifyChecksum (const char* const data, const std::size_t length);
+
+private:
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	BinaryFormat (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param binaryFormat to copy from.
+	 */
+	BinaryFormat (const BinaryFormat& binaryFormat);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param binaryFormat to copy from.
+	 * @return this BinaryFormat.
+	 */
+	BinaryFormat& operator= (const BinaryFormat& binaryFormat);
+
+};
+
+#endif
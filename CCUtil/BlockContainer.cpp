@@ -0,0 +1,310 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Block layout inspired by:	https://en.wikipedia.org/wiki/ZIP_(file_format)#Structure
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "BlockContainer.h"
+#include "CaesarCipher.h"
+#include "ContentHash.h"
+#include "FileSystem.h"
+#include "WorkStealingPool.h"
+
+// Static Constant Definitions ***********************************************
+const char BlockContainer::MAGIC[4] = { 'C', 'C', 'B', 'C' };
+
+// Method Definitions ********************************************************
+BlockContainer::BlockContainer (void) :
+	data (nullptr),
+	length (0) {
+
+}
+
+//****************************************************************************
+const std::vector<BlockContainer::Block>& BlockContainer::getBlocks (void) const {
+
+	return blocks;
+
+}
+
+//****************************************************************************
+unsigned long long BlockContainer::getLength (void) const {
+
+	return length;
+
+}
+
+//****************************************************************************
+bool BlockContainer::open (const std::string& filename) {
+
+	contents.clear ();
+
+	if (!mappedFile.open (filename)) {
+
+		return attach (nullptr, 0);
+
+	}
+
+	return attach (mappedFile.getData (), mappedFile.getSize ());
+
+}
+
+//****************************************************************************
+bool BlockContainer::load (const std::string& contents) {
+
+	mappedFile.close ();
+	this->contents = contents;
+
+	return attach (this->contents.data (), this->contents.length ());
+
+}
+
+//****************************************************************************
+bool BlockContainer::decipherRange (const unsigned long long offset, const std::size_t length, char* const plaintext) const {
+
+	std::size_t first = 0;
+	std::size_t last = blocks.size ();
+	std::size_t written = 0;
+
+	if (offset > this->length || this->length - offset < length) {
+
+		return false;
+
+	}
+
+	// Blocks are in text order, so the first block of the range is found by
+	// bisecting rather than by walking from the start.
+	while (last - first > 1) {
+
+		const std::size_t middle = first + (last - first) / 2;
+
+		if (blocks[middle].plaintextOffset <= offset) {
+
+			first = middle;
+
+		} else {
+
+			last = middle;
+
+		}
+
+	}
+
+	for (std::size_t i = first; written < length; i++) {
+
+		const std::size_t start = static_cast<std::size_t> (offset + written - blocks[i].plaintextOffset);
+		const std::size_t count = (blocks[i].length - start < length - written) ? blocks[i].length - start : length - written;
+
+		if (!decipherBlock (blocks[i], start, count, plaintext + written)) {
+
+			return false;
+
+		}
+
+		written += count;
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+bool BlockContainer::decipher (std::string& plaintext, WorkStealingPool& pool) const {
+
+	std::atomic<bool> isIntact (true);
+
+	plaintext.assign (static_cast<std::size_t> (length), '\0');
+
+	// Each block deciphers straight into its own part of the plaintext, so
+	// tasks share nothing but the read only container.
+	for (const Block& block : blocks) {
+
+		pool.submit ([this, &block, &plaintext, &isIntact] (void) {
+
+			if (!decipherBlock (block, 0, block.length, &plaintext[static_cast<std::size_t> (block.plaintextOffset)])) {
+
+				isIntact = false;
+
+			}
+
+		});
+
+	}
+
+	pool.wait ();
+
+	return isIntact;
+
+}
+
+//****************************************************************************
+std::string BlockContainer::encipher (const char* const plaintext, const std::size_t length, const std::vector<unsigned int>& keys, const std::size_t blockSize, WorkStealingPool& pool) {
+
+	const std::size_t blockCount = (length + blockSize - 1) / blockSize;
+	const std::size_t indexOffset = HEADER_LENGTH + blockCount * BLOCK_HEADER_LENGTH + length;
+	std::string container (indexOffset + blockCount * INDEX_ENTRY_LENGTH + 16 + TRAILER_LENGTH, '\0');
+	char* const output = &container[0];
+
+	memcpy (output, MAGIC, sizeof (MAGIC));
+	BinaryFormat::storeInteger (output + sizeof (MAGIC), FORMAT_VERSION, 2);
+	BinaryFormat::storeInteger (output + sizeof (MAGIC) + 2, blockSize, 4);
+
+	// Every block but the last is full, so where each one goes is known up
+	// front and blocks are enciphered in any order.
+	for (std::size_t i = 0; i < blockCount; i++) {
+
+		pool.submit ([plaintext, length, &keys, blockSize, output, i] (void) {
+
+			const std::size_t plaintextOffset = i * blockSize;
+			const std::size_t blockLength = (length - plaintextOffset < blockSize) ? length - plaintextOffset : blockSize;
+			const unsigned int key = keys[i % keys.size ()] % CaesarCipher::ALPHABET_LENGTH;
+			char* const header = output + HEADER_LENGTH + i * (BLOCK_HEADER_LENGTH + blockSize);
+
+			CaesarCipher::encipher (plaintext + plaintextOffset, blockLength, key, header + BLOCK_HEADER_LENGTH);
+			BinaryFormat::storeInteger (header, key, 1);
+			BinaryFormat::storeInteger (header + 1, blockLength, 4);
+			BinaryFormat::storeInteger (header + 5, ContentHash::hash64 (header + BLOCK_HEADER_LENGTH, blockLength, 0), 8);
+
+		});
+
+	}
+
+	pool.wait ();
+
+	for (std::size_t i = 0; i < blockCount; i++) {
+
+		const std::size_t headerOffset = HEADER_LENGTH + i * (BLOCK_HEADER_LENGTH + blockSize);
+		char* const entry = output + indexOffset + i * INDEX_ENTRY_LENGTH;
+
+		BinaryFormat::storeInteger (entry, headerOffset + BLOCK_HEADER_LENGTH, 8);
+		memcpy (entry + 8, output + headerOffset + 1, 4);
+		memcpy (entry + 12, output + headerOffset, 1);
+
+	}
+
+	BinaryFormat::storeInteger (output + indexOffset + blockCount * INDEX_ENTRY_LENGTH, blockCount, 8);
+	BinaryFormat::storeInteger (output + indexOffset + blockCount * INDEX_ENTRY_LENGTH + 8, ContentHash::hash64 (output + indexOffset, blockCount * INDEX_ENTRY_LENGTH + 8, 0), 8);
+	BinaryFormat::storeInteger (output + container.length () - TRAILER_LENGTH, indexOffset, 8);
+	memcpy (output + container.length () - sizeof (MAGIC), MAGIC, sizeof (MAGIC));
+
+	return container;
+
+}
+
+//****************************************************************************
+bool BlockContainer::isContainerFile (const std::string& filename) {
+
+	std::string start;
+
+	return FileSystem::readFileRange (filename, 0, sizeof (MAGIC), start) && start.compare (0, sizeof (MAGIC), MAGIC, sizeof (MAGIC)) == 0;
+
+}
+
+//****************************************************************************
+bool BlockContainer::attach (const char* const data, const std::size_t length) {
+
+	std::size_t offset = sizeof (MAGIC);
+	unsigned long long formatVersion = 0;
+	unsigned long long indexOffset = 0;
+	unsigned long long blockCount = 0;
+	unsigned long long plaintextOffset = 0;
+	unsigned long long value = 0;
+	Block block;
+
+	this->data = nullptr;
+	this->length = 0;
+	blocks.clear ();
+
+	if (data == nullptr || length < HEADER_LENGTH + TRAILER_LENGTH || memcmp (data, MAGIC, sizeof (MAGIC)) != 0 || memcmp (data + length - sizeof (MAGIC), MAGIC, sizeof (MAGIC)) != 0 ||
+		!BinaryFormat::readInteger (data, length, offset, 2, formatVersion) || formatVersion != FORMAT_VERSION) {
+
+		return false;
+
+	}
+
+	// The index lies between the blocks and the trailer, and ends with its own
+	// block count and checksum.
+	offset = length - TRAILER_LENGTH;
+	BinaryFormat::readInteger (data, length, offset, 8, indexOffset);
+
+	if (indexOffset < HEADER_LENGTH || indexOffset + 16 > length - TRAILER_LENGTH || !BinaryFormat::verifyChecksum (data + indexOffset, static_cast<std::size_t> (length - TRAILER_LENGTH - indexOffset))) {
+
+		return false;
+
+	}
+
+	offset = length - TRAILER_LENGTH - 16;
+	BinaryFormat::readInteger (data, length, offset, 8, blockCount);
+
+	if (blockCount != (length - TRAILER_LENGTH - 16 - indexOffset) / INDEX_ENTRY_LENGTH || blockCount * INDEX_ENTRY_LENGTH != length - TRAILER_LENGTH - 16 - indexOffset) {
+
+		return false;
+
+	}
+
+	blocks.reserve (static_cast<std::size_t> (blockCount));
+	offset = static_cast<std::size_t> (indexOffset);
+
+	for (unsigned long long i = 0; i < blockCount; i++) {
+
+		BinaryFormat::readInteger (data, length, offset, 8, block.offset);
+		BinaryFormat::readInteger (data, length, offset, 4, value);
+		block.length = static_cast<std::size_t> (value);
+		BinaryFormat::readInteger (data, length, offset, 1, value);
+		block.key = static_cast<unsigned int> (value);
+		block.plaintextOffset = plaintextOffset;
+
+		// Each block must lie before the index, and agree with its own header.
+		if (block.key >= CaesarCipher::ALPHABET_LENGTH || block.offset < HEADER_LENGTH + BLOCK_HEADER_LENGTH || block.offset > indexOffset || indexOffset - block.offset < block.length ||
+			static_cast<unsigned char> (data[block.offset - BLOCK_HEADER_LENGTH]) != block.key || memcmp (data + block.offset - BLOCK_HEADER_LENGTH + 1, data + offset - 5, 4) != 0) {
+
+			blocks.clear ();
+			return false;
+
+		}
+
+		blocks.push_back (block);
+		plaintextOffset += block.length;
+
+	}
+
+	this->data = data;
+	this->length = plaintextOffset;
+
+	return true;
+
+}
+
+//****************************************************************************
+bool BlockContainer::decipherBlock (const Block& block, const std::size_t start, const std::size_t length, char* const plaintext) const {
+
+	const char* const ciphertext = data + block.offset;
+	std::size_t offset = static_cast<std::size_t> (block.offset) - 8;
+	unsigned long long checksum = 0;
+
+	// The whole block is checked even when only part of it is wanted, since
+	// a checksum cannot vouch for a part.
+	BinaryFormat::readInteger (data, static_cast<std::size_t> (block.offset), offset, 8, checksum);
+
+	if (checksum != ContentHash::hash64 (ciphertext, block.length, 0)) {
+
+		return false;
+
+	}
+
+	CaesarCipher::decipher (ciphertext + start, length, block.key, plaintext);
+	return true;
+
+}
@@ -0,0 +1,183 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Block layout inspired by:	https://en.wikipedia.org/wiki/ZIP_(file_format)#Structure
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+#include "WorkStealingPool.h"
+
+#ifndef BLOCK_CONTAINER_H
+#define BLOCK_CONTAINER_H
+
+/**
+ * Archive of a long ciphertext split into fixed-size blocks, each enciphered
+ * under its own key. Every block starts with its key, length and a checksum of
+ * its bytes, and an index at the end of the container locates every block, so
+ * a reader can decipher any range of the text by touching only the blocks
+ * that cover it, or decipher every block at once on a pool of threads.
+ * Containers on disk are memory mapped rather than read, so opening one costs
+ * no more than checking its index.
+ */
+class BlockContainer {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Where a block is and how to decipher it.
+	 */
+	struct Block {
+
+		unsigned long long	offset;				/**< Offset of the block's first ciphertext byte in the container. */
+		unsigned long long	plaintextOffset;	/**< Offset of the block's first byte in the whole text. */
+		std::size_t			length;				/**< Number of bytes in the block. */
+		unsigned int		key;				/**< Key the block was enciphered with. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const std::size_t DEFAULT_BLOCK_SIZE = 1 << 20;		/**< Bytes of text in each block but the last. */
+	static const std::size_t MAXIMUM_BLOCK_SIZE = 0xFFFFFFFF;	/**< Largest block a block header can describe. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Creates an empty container.
+	 */
+	BlockContainer (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the blocks of the container in order.
+	 * @return the blocks.
+	 */
+	const std::vector<Block>& getBlocks (void) const;
+
+	/**
+	 * Returns the length of the whole text.
+	 * @return the number of bytes in every block together.
+	 */
+	unsigned long long getLength (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Opens a container file by mapping it into memory and reading its index.
+	 * Blocks are checked when they are deciphered.
+	 * @param filename of the container.
+	 * @return true if opened, otherwise false.
+	 */
+	bool open (const std::string& filename);
+
+	/**
+	 * Replaces the container with one held in memory.
+	 * @param contents of a container.
+	 * @return true if loaded, otherwise false.
+	 */
+	bool load (const std::string& contents);
+
+	/**
+	 * Deciphers a range of the text, reading only the blocks that cover it.
+	 * Does not allocate from the heap.
+	 * @param offset of the first byte to decipher.
+	 * @param length, number of bytes to decipher.
+	 * @param plaintext, where to store the result. Must hold length bytes.
+	 * @return true if deciphered, otherwise false, such as when the range runs
+	 * past the end of the text or a block it covers is corrupt.
+	 */
+	bool decipherRange (const unsigned long long offset, const std::size_t length, char* const plaintext) const;
+
+	/**
+	 * Deciphers the whole text, one task per block.
+	 * @param plaintext, where to store the result.
+	 * @param pool to decipher on.
+	 * @return true if deciphered, otherwise false if any block is corrupt.
+	 */
+	bool decipher (std::string& plaintext, WorkStealingPool& pool) const;
+
+	/**
+	 * Enciphers a text into a container: the bytes "CCBC", a 2 byte format
+	 * version and a 4 byte block size, then every block as a 1 byte key, a 4
+	 * byte length, an 8 byte checksum and its ciphertext, then the index as
+	 * the 8 byte offset, 4 byte length and 1 byte key of every block, an 8
+	 * byte block count and an 8 byte checksum, and finally the 8 byte offset
+	 * of the index followed by "CCBC" again. Blocks are enciphered one task
+	 * each, straight into their place in the container.
+	 * @param plaintext to encipher.
+	 * @param length, number of bytes in plaintext.
+	 * @param keys to encipher with, used in turn, so block i is enciphered
+	 * with keys[i % keys.size ()]. Must not be empty.
+	 * @param blockSize, number of bytes in each block but the last. Must not
+	 * be zero or more than MAXIMUM_BLOCK_SIZE.
+	 * @param pool to encipher on.
+	 * @return the container.
+	 */
+	static std::string encipher (const char* const plaintext, const std::size_t length, const std::vector<unsigned int>& keys, const std::size_t blockSize, WorkStealingPool& pool);
+
+	/**
+	 * Checks whether a file starts like a container, without reading the rest.
+	 * @param filename of the file to check.
+	 * @return true if the file starts with "CCBC", otherwise false.
+	 */
+	static bool isContainerFile (const std::string& filename);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;			/**< Version of the container format. */
+	static const std::size_t HEADER_LENGTH = 10;			/**< Bytes before the first block. */
+	static const std::size_t BLOCK_HEADER_LENGTH = 13;		/**< Bytes before each block's ciphertext. */
+	static const std::size_t INDEX_ENTRY_LENGTH = 13;		/**< Bytes of each block's index entry. */
+	static const std::size_t TRAILER_LENGTH = 12;			/**< Bytes after the index. */
+	static const char MAGIC[4];								/**< Bytes every container starts and ends with. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Points the container at container bytes after checking its index.
+	 * @param data, the container, which must outlive the view.
+	 * @param length, number of bytes in data.
+	 * @return true if the index is intact, otherwise false.
+	 */
+	bool attach (const char* const data, const std::size_t length);
+
+	/**
+	 * Checks a block's checksum and deciphers part of it.
+	 * @param block to decipher.
+	 * @param start, offset of the first byte to decipher within the block.
+	 * @param length, number of bytes to decipher.
+	 * @param plaintext, where to store the result. Must hold length bytes.
+	 * @return true if the block is intact, otherwise false.
+	 */
+	bool decipherBlock (const Block& block, const std::size_t start, const std::size_t length, char* const plaintext) const;
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the container, which may point into its
+	 * own members, from being copied.
+	 * @param blockContainer to copy from.
+	 */
+	BlockContainer (const BlockContainer& blockContainer);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the container from being copied.
+	 * @param blockContainer to copy from.
+	 * @return this BlockContainer.
+	 */
+	BlockContainer& operator= (const BlockContainer& blockContainer);
+
+	// Private Members *******************************************************
+	MappedFile			mappedFile;		/**< Mapping of an opened container file. */
+	std::string			contents;		/**< Container, when loaded in memory. */
+	const char*			data;			/**< Bytes of the container. */
+	std::vector<Block>	blocks;			/**< Blocks in order. */
+	unsigned long long	length;			/**< Length of the whole text. */
+
+};
+
+#endif
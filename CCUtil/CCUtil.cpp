@@ -16,12 +16,47 @@
  *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
+#include "AffineCipher.h"
+#include "Autotuner.h"
+#include "BlockContainer.h"
 #include "CaesarCipher.h"
+#include "ContentHash.h"
+#include "CrackCache.h"
+#include "Deduplicator.h"
+#include "FileFollower.h"
+#include "FileSystem.h"
+#include "JobRunner.h"
+#include "KeyClusterer.h"
+#include "KeyFanOut.h"
+#include "KeySegmenter.h"
+#include "LanguageProfile.h"
+#include "MappedFile.h"
+#include "MonotonicArena.h"
+#include "NgramProfile.h"
+#include "ProseFilter.h"
+#include "RecordProcessor.h"
+#include "SubstitutionCipher.h"
+#include "TreeProcessor.h"
+#include "Triage.h"
+#include "WordDictionary.h"
+#include "WorkStealingPool.h"
 
 // Global Constants **********************************************************
 static const char HELP_ARG = 'h';				/**< Command line argument for requesting help text. >*/
@@ -32,6 +67,39 @@ static const char BRUTE_FORCE_ARG = 'b';		/**< Command line argument for brute f
 static const char INPUT_FILENAME_ARG = 'i';		/**< Command line argument for loading text from a file. >*/
 static const char OUTPUT_FILENAME_ARG = 'o';	/**< Command line argument for specifying a save file. >*/
 static const char INPUT_TEXT_ARG = 't';			/**< Command line argument for specifying raw cipher/plain text. >*/
+static const char INPUT_DIRECTORY_ARG = 'r';	/**< Command line argument for processing every file in a directory tree. >*/
+static const char MANIFEST_FILENAME_ARG = 'm';	/**< Command line argument for specifying a manifest file for a directory tree. >*/
+static const char CHECKPOINT_FILENAME_ARG = 'p';	/**< Command line argument for specifying a checkpoint file to resume from. >*/
+static const char RECORDS_ARG = 'l';			/**< Command line argument for treating each line as a separate message. >*/
+static const char LANGUAGE_ARG = 'g';			/**< Command line argument for cracking against a language profile. >*/
+static const char CACHE_DIRECTORY_ARG = 's';	/**< Command line argument for specifying a directory to cache crack results in. >*/
+static const char TRIAGE_ARG = 'a';				/**< Command line argument for guessing whether inputs are enciphered. >*/
+static const char SUBSTITUTION_CRACK_ARG = 'u';	/**< Command line argument for cracking a general substitution cipher. >*/
+static const char SEGMENT_ARG = 'k';			/**< Command line argument for cracking a text whose key changes partway through. >*/
+static const char DICTIONARY_ARG = 'w';			/**< Command line argument for verifying cracked keys against a word list. >*/
+static const char COMPILE_DICTIONARY_ARG = 'n';	/**< Command line argument for compiling a word list into a dictionary. >*/
+static const char FOLLOW_ARG = 'f';				/**< Command line argument for following a file as it grows. >*/
+static const char CONTAINER_ARG = 'x';			/**< Command line argument for writing a blocked container. >*/
+static const char CALIBRATE_ARG = 'z';			/**< Command line argument for tuning CCUtil to this machine. >*/
+static const char THREADS_ARG = 'j';			/**< Command line argument for overriding the tuned thread count. >*/
+static const char KERNEL_ARG = 'v';				/**< Command line argument for overriding the tuned translation kernel. >*/
+static const char TRAIN_ARG = 'y';				/**< Command line argument for training an n-gram profile on a corpus. >*/
+static const char NGRAM_PROFILE_ARG = 'q';		/**< Command line argument for cracking against an n-gram profile. >*/
+static const char DEDUPLICATE_ARG = 'D';		/**< Command line argument for cracking each group of duplicate ciphertexts once. >*/
+static const char CLUSTER_ARG = 'K';			/**< Command line argument for cracking short messages that share keys together. >*/
+static const char PROSE_ARG = 'P';				/**< Command line argument for cracking on the letters of prose alone. >*/
+static const char AFFINE_CRACK_ARG = 'A';		/**< Command line argument for cracking an affine cipher. >*/
+static const char FAN_OUT_ARG = 'F';			/**< Command line argument for enciphering a text under many keys at once. >*/
+static const unsigned int AFFINE_CANDIDATE_COUNT = 5;	/**< Number of best affine keys listed after a crack. >*/
+
+// Globals *******************************************************************
+static volatile std::sig_atomic_t isStopRequested = 0;	/**< Set by an interrupt to end following a file. >*/
+static Autotuner::Profile tuningProfile = Autotuner::getDefaultProfile ();	/**< Kernels, threads and chunk size work is done with. >*/
+
+#ifdef _DEBUG
+// Debug Globals *************************************************************
+static std::atomic<unsigned long long> heapAllocationCount (0);	/**< Number of heap allocations made so far, counted for unit tests. >*/
+#endif
 
 // Function Declarations *****************************************************
 /**
@@ -48,6 +116,120 @@ int main (int argc, char* argv[]);
  */
 std::string caesarCipherUnitTests ();
 
+/**
+ * Runs unit tests on the class WorkStealingPool.
+ * @return whether unit tests have passed or failed.
+ */
+std::string workStealingPoolUnitTests ();
+
+/**
+ * Runs unit tests on the class TreeProcessor.
+ * @return whether unit tests have passed or failed.
+ */
+std::string treeProcessorUnitTests ();
+
+/**
+ * Runs unit tests on the classes ContentHash and CrackCache.
+ * @return whether unit tests have passed or failed.
+ */
+std::string crackCacheUnitTests ();
+
+/**
+ * Runs unit tests on the classes MonotonicArena and RecordProcessor.
+ * @return whether unit tests have passed or failed.
+ */
+std::string recordProcessorUnitTests ();
+
+/**
+ * Runs unit tests on the class LanguageProfile.
+ * @return whether unit tests have passed or failed.
+ */
+std::string languageProfileUnitTests ();
+
+/**
+ * Runs unit tests on the static class Triage.
+ * @return whether unit tests have passed or failed.
+ */
+std::string triageUnitTests ();
+
+/**
+ * Runs unit tests on the static class SubstitutionCipher.
+ * @return whether unit tests have passed or failed.
+ */
+std::string substitutionCipherUnitTests ();
+
+/**
+ * Runs unit tests on the class KeySegmenter.
+ * @return whether unit tests have passed or failed.
+ */
+std::string keySegmenterUnitTests ();
+
+/**
+ * Runs unit tests on the classes MappedFile and WordDictionary.
+ * @return whether unit tests have passed or failed.
+ */
+std::string wordDictionaryUnitTests ();
+
+/**
+ * Runs unit tests on the class FileFollower.
+ * @return whether unit tests have passed or failed.
+ */
+std::string fileFollowerUnitTests ();
+
+/**
+ * Runs unit tests on the class BlockContainer.
+ * @return whether unit tests have passed or failed.
+ */
+std::string blockContainerUnitTests ();
+
+/**
+ * Runs unit tests on the class JobRunner.
+ * @return whether unit tests have passed or failed.
+ */
+std::string jobRunnerUnitTests ();
+
+/**
+ * Runs unit tests on the static class Autotuner.
+ * @return whether unit tests have passed or failed.
+ */
+std::string autotunerUnitTests ();
+
+/**
+ * Runs unit tests on the class NgramProfile.
+ * @return whether unit tests have passed or failed.
+ */
+std::string ngramProfileUnitTests ();
+
+/**
+ * Runs unit tests on the static class Deduplicator.
+ * @return whether unit tests have passed or failed.
+ */
+std::string deduplicatorUnitTests ();
+
+/**
+ * Runs unit tests on the static class KeyClusterer.
+ * @return whether unit tests have passed or failed.
+ */
+std::string keyClustererUnitTests ();
+
+/**
+ * Runs unit tests on the static class ProseFilter.
+ * @return whether unit tests have passed or failed.
+ */
+std::string proseFilterUnitTests ();
+
+/**
+ * Runs unit tests on the static class AffineCipher.
+ * @return whether unit tests have passed or failed.
+ */
+std::string affineCipherUnitTests ();
+
+/**
+ * Runs unit tests on the static class KeyFanOut.
+ * @return whether unit tests have passed or failed.
+ */
+std::string keyFanOutUnitTests ();
+
 /**
  * Parses the given command line arguments.
  * @param argc, number of command line arguments.
@@ -74,6 +256,50 @@ void printUsageError (void);
  */
 bool parseCStringAsKey (const char* const cString, unsigned int& key);
 
+/**
+ * Attempts to extract an affine key, written as the multiplier and the shift
+ * separated by a comma, from the given string.
+ * @param cString to parse.
+ * @param alphabet, where to store the substitution alphabet equivalent to the
+ * key, in uppercase.
+ * @return true if parsed and the multiplier is valid, otherwise false.
+ */
+bool parseCStringAsAffineKey (const char* const cString, std::string& alphabet);
+
+/**
+ * Attempts to extract a list of keys, separated by commas, from the given
+ * string. Ranges of keys, such as 1-25, may be listed too.
+ * @param cString to parse.
+ * @param keys, where to store each distinct key once, in the order listed.
+ * @return true if parsed and at least one key was listed, otherwise false.
+ */
+bool parseCStringAsKeyList (const char* const cString, std::vector<unsigned int>& keys);
+
+/**
+ * Attempts to extract a substitution alphabet from the given string.
+ * @param cString to parse.
+ * @param alphabet, where to store the parsed alphabet in uppercase.
+ * @return true if the string holds each letter exactly once, otherwise false.
+ */
+bool parseCStringAsAlphabet (const char* const cString, std::string& alphabet);
+
+/**
+ * Attempts to extract a count of at least one from the given string.
+ * @param cString to parse.
+ * @param count, where to store the parsed count.
+ * @return true if parsed, otherwise false.
+ */
+bool parseCStringAsCount (const char* const cString, unsigned int& count);
+
+/**
+ * Enciphers the given string with the given key, split into chunks over the
+ * tuned number of threads when it is large enough to gain from them.
+ * @param plaintext to encipher.
+ * @param key to encipher with.
+ * @return ciphertext.
+ */
+std::string encipherInParallel (const std::string& plaintext, const unsigned int key);
+
 /**
  * Enciphers the given string with the given key and outputs the result to
  * the console.
@@ -83,6 +309,15 @@ bool parseCStringAsKey (const char* const cString, unsigned int& key);
  */
 std::string encipherAndPrint (const std::string& plaintext, const unsigned int key);
 
+/**
+ * Enciphers the given string with the given substitution alphabet and outputs
+ * the result to the console.
+ * @param plaintext to encipher.
+ * @param alphabet to encipher with.
+ * @return ciphertext.
+ */
+std::string encipherAndPrint (const std::string& plaintext, const std::string& alphabet);
+
 /**
  * Deciphers the given string with the given key and outputs the result to
  * the console.
@@ -92,13 +327,180 @@ std::string encipherAndPrint (const std::string& plaintext, const unsigned int k
  */
 std::string decipherAndPrint (const std::string& ciphertext, const unsigned int key);
 
+/**
+ * Enciphers the given string with the given key into a blocked container,
+ * one block per task, and outputs a summary to the console.
+ * @param plaintext to encipher.
+ * @param key to encipher every block with.
+ * @return the container.
+ */
+std::string encipherContainerAndPrint (const std::string& plaintext, const unsigned int key);
+
+/**
+ * Deciphers every block of a container file with its own key and outputs
+ * the result to the console.
+ * @param filename of the container.
+ * @param plaintext, where to store the result.
+ * @return true if deciphered, otherwise false if the container could not be
+ * opened or a block is corrupt.
+ */
+bool decipherContainerAndPrint (const std::string& filename, std::string& plaintext);
+
+/**
+ * Deciphers the given string with the given substitution alphabet and outputs
+ * the result to the console.
+ * @param ciphertext to decipher.
+ * @param alphabet to decipher with.
+ * @return plaintext.
+ */
+std::string decipherAndPrint (const std::string& ciphertext, const std::string& alphabet);
+
 /**
  * Attempts to guess the correct key for a ciphertext, decipher with it,
  * and print the result to the console.
  * @param ciphertext to analyze and decipher.
+ * @param cacheDirectory, directory of cached crack results. May be empty.
+ * @param profiles, languages to crack against. If empty the ciphertext is
+ * assumed to be English.
+ * @param dictionary to re-rank the best keys with. May be nullptr.
+ * @param ngramProfile to rank keys by in place of letter frequencies. May be
+ * nullptr.
+ * @param isProseOnly, whether to count only the letters of prose, leaving out
+ * URLs, encoded blobs, identifiers and binary data.
+ * @return estimated plaintext.
+ */
+std::string crackAndPrint (const std::string& ciphertext, const std::string& cacheDirectory, const std::vector<LanguageProfile>& profiles, const WordDictionary* const dictionary, const NgramProfile* const ngramProfile, const bool isProseOnly);
+
+/**
+ * Compiles a word list into a dictionary file and prints its size to the
+ * console.
+ * @param wordList to compile.
+ * @param filename to save the dictionary to.
+ * @return true if saved, otherwise false.
+ */
+bool compileDictionaryAndPrint (const std::string& wordList, const std::string& filename);
+
+/**
+ * Benchmarks this machine, saves the fastest profile found and prints it to
+ * the console.
+ * @param filename to save the profile to.
+ * @return true if saved, otherwise false.
+ */
+bool calibrateAndPrint (const std::string& filename);
+
+/**
+ * Trains an n-gram profile on a corpus across the tuned number of threads,
+ * saves it and prints its size to the console.
+ * @param corpusFilename of the corpus, which is memory mapped. If empty the
+ * corpus is taken from text instead.
+ * @param text, the corpus when no file is given.
+ * @param filename to save the profile to.
+ * @return true if saved, otherwise false.
+ */
+bool trainAndPrint (const std::string& corpusFilename, const std::string& text, const std::string& filename);
+
+/**
+ * Enciphers a text under every key of a list in a single sweep, writing one
+ * file per key into a directory, and prints the files to the console.
+ * @param inputFilename of the text, which is memory mapped. If empty the text
+ * is taken from text instead.
+ * @param text, the text when no file is given.
+ * @param keys to encipher with.
+ * @param outputDirectory to write the ciphertexts into, created if missing.
+ * @return true if every ciphertext was written, otherwise false.
+ */
+bool fanOutAndPrint (const std::string& inputFilename, const std::string& text, const std::vector<unsigned int>& keys, const std::string& outputDirectory);
+
+/**
+ * Applies the given mode to the bytes appended to a file for as long as it
+ * grows, until interrupted, appending the results to an output file or
+ * printing them to the console.
+ * @param mode, the selected command line mode (-e, -d or -c).
+ * @param key to encipher or decipher with. Ignored when cracking.
+ * @param inputFilename of the file to follow.
+ * @param outputFilename of the file to append results to. May be empty.
+ * @param checkpointFilename, file to save progress in. May be empty.
+ * @return true if followed until interrupted, otherwise false.
+ */
+bool followAndPrint (const char mode, const unsigned int key, const std::string& inputFilename, const std::string& outputFilename, const std::string& checkpointFilename);
+
+/**
+ * Requests that following a file stop. Installed as the interrupt handler.
+ * @param signalNumber of the signal received.
+ */
+void requestStop (int signalNumber);
+
+/**
+ * Resolves the language names given on the command line into profiles.
+ * @param languages, each the name of a bundled profile, "all" for every
+ * bundled profile, or the filename of a binary profile file.
+ * @param profiles, where to store the profiles.
+ * @return true if every language was resolved, otherwise false.
+ */
+bool loadLanguageProfiles (const std::vector<std::string>& languages, std::vector<LanguageProfile>& profiles);
+
+/**
+ * Attempts to guess the substitution alphabet of a ciphertext, decipher with
+ * it, and print the result to the console.
+ * @param ciphertext to analyze and decipher.
+ * @return estimated plaintext.
+ */
+std::string substitutionCrackAndPrint (const std::string& ciphertext);
+
+/**
+ * Ranks every affine key of a ciphertext from its letter counts, deciphers
+ * with the best, and prints the result and the best few keys to the console.
+ * @param ciphertext to analyze and decipher.
+ * @return estimated plaintext.
+ */
+std::string affineCrackAndPrint (const std::string& ciphertext);
+
+/**
+ * Splits a ciphertext into segments enciphered under different keys, cracks
+ * each, and prints the segments and the result to the console.
+ * @param ciphertext to analyze and decipher.
+ * @param profiles, at most one language to crack against. If empty the
+ * ciphertext is assumed to be English.
  * @return estimated plaintext.
  */
-std::string crackAndPrint (const std::string& ciphertext);
+std::string segmentAndPrint (const std::string& ciphertext, const std::vector<LanguageProfile>& profiles);
+
+/**
+ * Prints the triage of a single input to the console.
+ * @param result of the triage.
+ * @return the triage as a table row.
+ */
+std::string triageAndPrint (const Triage::Result& result);
+
+/**
+ * Triages the start of every file beneath a directory, listing each file's
+ * classification and printing a count of each classification to the console.
+ * @param inputDirectory, root of the tree to triage.
+ * @param manifestFilename, file to list each file's classification in. If
+ * empty the list is printed to the console instead.
+ * @return true if every file was triaged, otherwise false.
+ */
+bool triageTreeAndPrint (const std::string& inputDirectory, const std::string& manifestFilename);
+
+/**
+ * Groups the files beneath a directory that hold the same message under any
+ * Caesar key, cracks one file of each group and works out the key of every
+ * other from it, listing each file's group and key and printing a summary to
+ * the console.
+ * @param inputDirectory, root of the tree to deduplicate.
+ * @param manifestFilename, file to list each file's group and key in. If
+ * empty the list is printed to the console instead.
+ * @return true if every file was read, otherwise false.
+ */
+bool deduplicateTreeAndPrint (const std::string& inputDirectory, const std::string& manifestFilename);
+
+/**
+ * Formats a triage result as a tab separated table row, without a newline.
+ * @param result to format.
+ * @return the row: classification, key, confidence, index of coincidence and
+ * letter density.
+ */
+std::string formatTriageResult (const Triage::Result& result);
 
 /**
  * Prints every possible translation of the given ciphertext to the console.
@@ -107,6 +509,42 @@ std::string crackAndPrint (const std::string& ciphertext);
  */
 std::string bruteForceAndPrint (const std::string& ciphertext);
 
+/**
+ * Applies the given mode to each line of the given text as a separate message
+ * and prints the results to the console, one per line.
+ * @param mode, the selected command line mode (-e, -d or -c).
+ * @param key to encipher or decipher with. Ignored when cracking.
+ * @param records, the text to process.
+ * @param dictionary to re-rank the best keys of each record with when
+ * cracking. May be nullptr.
+ * @return the processed records.
+ */
+std::string processRecordsAndPrint (const char mode, const unsigned int key, const std::string& records, const WordDictionary* const dictionary);
+
+/**
+ * Cracks each line of the given text as a separate short message, clustering
+ * the messages that share a key and cracking each cluster on the letters of
+ * all its messages together. Prints the results to the console, one per
+ * line, followed by the clusters.
+ * @param messages, the text to crack, one message per line.
+ * @return the key and plaintext of each message, tab separated, one per line.
+ */
+std::string clusterKeysAndPrint (const std::string& messages);
+
+/**
+ * Applies the given mode to every file beneath a directory and prints a summary
+ * to the console.
+ * @param mode, the selected command line mode (-e, -d or -c).
+ * @param key to encipher or decipher with. Ignored when cracking.
+ * @param inputDirectory, root of the tree to process.
+ * @param outputDirectory, root of the mirrored output tree. May be empty.
+ * @param manifestFilename, file to list each file's key in. May be empty.
+ * @param checkpointFilename, file to journal completed files in. May be empty.
+ * @param cacheDirectory, directory of cached crack results. May be empty.
+ * @return true if the tree was processed without errors, otherwise false.
+ */
+bool processTreeAndPrint (const char mode, const unsigned int key, const std::string& inputDirectory, const std::string& outputDirectory, const std::string& manifestFilename, const std::string& checkpointFilename, const std::string& cacheDirectory);
+
 /**
  * Attempts to load the text of a file.
  * @param filename of the desired file.
@@ -140,6 +578,25 @@ int main (int argc, char* argv[]) {
 
 #ifdef _DEBUG
 	std::cout << caesarCipherUnitTests () << std::endl;
+	std::cout << workStealingPoolUnitTests () << std::endl;
+	std::cout << treeProcessorUnitTests () << std::endl;
+	std::cout << crackCacheUnitTests () << std::endl;
+	std::cout << recordProcessorUnitTests () << std::endl;
+	std::cout << languageProfileUnitTests () << std::endl;
+	std::cout << triageUnitTests () << std::endl;
+	std::cout << substitutionCipherUnitTests () << std::endl;
+	std::cout << keySegmenterUnitTests () << std::endl;
+	std::cout << wordDictionaryUnitTests () << std::endl;
+	std::cout << fileFollowerUnitTests () << std::endl;
+	std::cout << blockContainerUnitTests () << std::endl;
+	std::cout << jobRunnerUnitTests () << std::endl;
+	std::cout << autotunerUnitTests () << std::endl;
+	std::cout << ngramProfileUnitTests () << std::endl;
+	std::cout << deduplicatorUnitTests () << std::endl;
+	std::cout << keyClustererUnitTests () << std::endl;
+	std::cout << proseFilterUnitTests () << std::endl;
+	std::cout << affineCipherUnitTests () << std::endl;
+	std::cout << keyFanOutUnitTests () << std::endl;
 #endif
 
 	if (!parseArgs (argc, argv)) {
@@ -160,13 +617,34 @@ bool parseArgs (const int argc, const char* const argv[]) {
 	char argCharacter = '\0';
 	char selectedMode = '\0';
 	unsigned int key = 0;
+	std::string alphabet;
+	std::vector<unsigned int> fanOutKeys;
 	std::string input;
 	std::string output;
 	std::string inputFile;
 	std::string outputFile;
+	std::string inputDirectory;
+	std::string manifestFile;
+	std::string checkpointFile;
+	std::string cacheDirectory;
+	std::string dictionaryFile;
+	std::string ngramFile;
+	std::vector<std::string> languages;
+	std::vector<LanguageProfile> profiles;
+	WordDictionary dictionary;
+	NgramProfile ngramProfile;
+	Triage::Result triageResult;
 	bool hasInput = false;
 	bool hasOutputFile = false;
 	bool hasInputFile = false;
+	bool hasInputDirectory = false;
+	bool hasRecords = false;
+	bool isFollowing = false;
+	bool writesContainer = false;
+	bool isProseOnly = false;
+	unsigned int threadCount = 0;
+	bool hasKernel = false;
+	SubstitutionCipher::TranslationKernel kernel = SubstitutionCipher::SCALAR_TRANSLATION;
 	bool usageErrorOccured = false;
 
 	if (argc <= 1) {
@@ -208,14 +686,15 @@ bool parseArgs (const int argc, const char* const argv[]) {
 
 				break;
 
-			case OUTPUT_FILENAME_ARG:
+			case INPUT_DIRECTORY_ARG:
 
 				argumentIndex++;
 
-				if (argumentIndex < static_cast<unsigned int> (argc) && !hasOutputFile && selectedMode != HELP_ARG) {
+				if (argumentIndex < static_cast<unsigned int> (argc) && !hasInput && selectedMode != HELP_ARG) {
 
-					outputFile = argv[argumentIndex];
-					hasOutputFile = true;
+					inputDirectory = argv[argumentIndex];
+					hasInputDirectory = true;
+					hasInput = true;
 
 				} else {
 
@@ -225,14 +704,13 @@ bool parseArgs (const int argc, const char* const argv[]) {
 
 				break;
 
-			case INPUT_TEXT_ARG:
+			case MANIFEST_FILENAME_ARG:
 
 				argumentIndex++;
 
-				if (argumentIndex < static_cast<unsigned int> (argc) && !hasInput && selectedMode != HELP_ARG) {
+				if (argumentIndex < static_cast<unsigned int> (argc) && manifestFile.empty () && selectedMode != HELP_ARG) {
 
-					input = argv[argumentIndex];
-					hasInput = true;
+					manifestFile = argv[argumentIndex];
 
 				} else {
 
@@ -242,29 +720,27 @@ bool parseArgs (const int argc, const char* const argv[]) {
 
 				break;
 
-			case ENCIPHER_ARG:
-			case DECIPHER_ARG:
-
-				// Assume that a mode has not been selected already and check for a valid key.
-				// We do not break so that we roll into the next cases and check if our assumption
-				// on the selected mode was right, if not we exit anyways.
+			case CHECKPOINT_FILENAME_ARG:
 
 				argumentIndex++;
 
-				if (!((argumentIndex < static_cast<unsigned int> (argc)) && parseCStringAsKey (argv[argumentIndex], key))) {
+				if (argumentIndex < static_cast<unsigned int> (argc) && checkpointFile.empty () && selectedMode != HELP_ARG) {
+
+					checkpointFile = argv[argumentIndex];
+
+				} else {
 
 					usageErrorOccured = true;
-					break;
 
 				}
 
-			case CRACK_ARG:
-			case BRUTE_FORCE_ARG:
+				break;
 
-				if (selectedMode == '\0') {
+			case RECORDS_ARG:
 
-					selectedMode = argCharacter;
-					break;
+				if (!hasRecords && selectedMode != HELP_ARG) {
+
+					hasRecords = true;
 
 				} else {
 
@@ -274,12 +750,11 @@ bool parseArgs (const int argc, const char* const argv[]) {
 
 				break;
 
-			case HELP_ARG:
+			case FOLLOW_ARG:
 
-				if (selectedMode == '\0' && !hasInput && !hasOutputFile && !hasInputFile) {
+				if (!isFollowing && selectedMode != HELP_ARG) {
 
-					selectedMode = argCharacter;
-					break;
+					isFollowing = true;
 
 				} else {
 
@@ -289,63 +764,625 @@ bool parseArgs (const int argc, const char* const argv[]) {
 
 				break;
 
-			default:
+			case CONTAINER_ARG:
 
-				usageErrorOccured = true;
-				break;
+				if (!writesContainer && selectedMode != HELP_ARG) {
 
-			}
+					writesContainer = true;
 
-		} else {
+				} else {
 
-			// Not enough arguments.
-			usageErrorOccured = true;
+					usageErrorOccured = true;
 
-		}
+				}
 
-		argumentIndex++;
-		
-	}
+				break;
 
-	if (usageErrorOccured) {
+			case PROSE_ARG:
 
-		printUsageError ();
-		return false;
+				if (!isProseOnly && selectedMode != HELP_ARG) {
 
-	}
+					isProseOnly = true;
 
-	if (hasInputFile) {
+				} else {
 
-		if (!loadFileContents (inputFile, input)) {
+					usageErrorOccured = true;
 
-			printFileLoadingError (inputFile);
-			return false;
+				}
 
-		}
+				break;
 
-	}
+			case THREADS_ARG:
 
-	switch (selectedMode) {
+				argumentIndex++;
 
-	case HELP_ARG:
-		printHelp ();
-		break;
+				if (argumentIndex < static_cast<unsigned int> (argc) && threadCount == 0 && selectedMode != HELP_ARG && parseCStringAsCount (argv[argumentIndex], threadCount)) {
 
-	case ENCIPHER_ARG:
-		output = encipherAndPrint (input, key);
-		break;
+					break;
 
-	case DECIPHER_ARG:
-		output = decipherAndPrint (input, key);
-		break;
+				} else {
 
-	case BRUTE_FORCE_ARG:
-		output = bruteForceAndPrint (input);
-		break;
+					usageErrorOccured = true;
 
-	case CRACK_ARG:
-		output = crackAndPrint (input);
-		break;
+				}
+
+				break;
+
+			case KERNEL_ARG:
+
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && !hasKernel && selectedMode != HELP_ARG && Autotuner::parseKernelName (argv[argumentIndex], kernel)) {
+
+					hasKernel = true;
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case LANGUAGE_ARG:
+
+				argumentIndex++;
+
+				// May be given several times to crack against several languages at once.
+				if (argumentIndex < static_cast<unsigned int> (argc) && selectedMode != HELP_ARG) {
+
+					languages.push_back (argv[argumentIndex]);
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case CACHE_DIRECTORY_ARG:
+
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && cacheDirectory.empty () && selectedMode != HELP_ARG) {
+
+					cacheDirectory = argv[argumentIndex];
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case DICTIONARY_ARG:
+
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && dictionaryFile.empty () && selectedMode != HELP_ARG) {
+
+					dictionaryFile = argv[argumentIndex];
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case NGRAM_PROFILE_ARG:
+
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && ngramFile.empty () && selectedMode != HELP_ARG) {
+
+					ngramFile = argv[argumentIndex];
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case OUTPUT_FILENAME_ARG:
+
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && !hasOutputFile && selectedMode != HELP_ARG) {
+
+					outputFile = argv[argumentIndex];
+					hasOutputFile = true;
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case INPUT_TEXT_ARG:
+
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && !hasInput && selectedMode != HELP_ARG) {
+
+					input = argv[argumentIndex];
+					hasInput = true;
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case FAN_OUT_ARG:
+
+				// The key list follows the flag, as a key follows -e.
+				argumentIndex++;
+
+				if (argumentIndex < static_cast<unsigned int> (argc) && selectedMode == '\0' && parseCStringAsKeyList (argv[argumentIndex], fanOutKeys)) {
+
+					selectedMode = argCharacter;
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case ENCIPHER_ARG:
+			case DECIPHER_ARG:
+
+				// Assume that a mode has not been selected already and check for a valid key.
+				// We do not break so that we roll into the next cases and check if our assumption
+				// on the selected mode was right, if not we exit anyways. A key with a comma is
+				// affine alone, since a Caesar key would parse its multiplier and ignore the rest.
+
+				argumentIndex++;
+
+				if (!((argumentIndex < static_cast<unsigned int> (argc)) && ((strchr (argv[argumentIndex], ',') != nullptr) ? parseCStringAsAffineKey (argv[argumentIndex], alphabet) : (parseCStringAsKey (argv[argumentIndex], key) || parseCStringAsAlphabet (argv[argumentIndex], alphabet))))) {
+
+					usageErrorOccured = true;
+					break;
+
+				}
+
+			case CRACK_ARG:
+			case BRUTE_FORCE_ARG:
+			case TRIAGE_ARG:
+			case SUBSTITUTION_CRACK_ARG:
+			case AFFINE_CRACK_ARG:
+			case SEGMENT_ARG:
+			case COMPILE_DICTIONARY_ARG:
+			case CALIBRATE_ARG:
+			case TRAIN_ARG:
+			case DEDUPLICATE_ARG:
+			case CLUSTER_ARG:
+
+				if (selectedMode == '\0') {
+
+					selectedMode = argCharacter;
+					break;
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			case HELP_ARG:
+
+				if (selectedMode == '\0' && !hasInput && !hasOutputFile && !hasInputFile && manifestFile.empty () && checkpointFile.empty () && cacheDirectory.empty () && !hasRecords && languages.empty () && dictionaryFile.empty () && !isFollowing && !writesContainer && !isProseOnly && threadCount == 0 && !hasKernel && ngramFile.empty ()) {
+
+					selectedMode = argCharacter;
+					break;
+
+				} else {
+
+					usageErrorOccured = true;
+
+				}
+
+				break;
+
+			default:
+
+				usageErrorOccured = true;
+				break;
+
+			}
+
+		} else {
+
+			// Not enough arguments.
+			usageErrorOccured = true;
+
+		}
+
+		argumentIndex++;
+		
+	}
+
+	// Manifests and checkpoints only apply to directory trees, which in turn
+	// support only enciphering, deciphering, cracking, triage and
+	// deduplicating. Enciphering and deciphering need somewhere to write the
+	// tree to. Triage and deduplicating only read, listing their results in
+	// the manifest or on the console.
+	if (hasInputDirectory) {
+
+		if (selectedMode == TRIAGE_ARG || selectedMode == DEDUPLICATE_ARG) {
+
+			if (hasOutputFile || !checkpointFile.empty ()) {
+
+				usageErrorOccured = true;
+
+			}
+
+		} else if ((selectedMode != ENCIPHER_ARG && selectedMode != DECIPHER_ARG && selectedMode != CRACK_ARG) ||
+			(selectedMode != CRACK_ARG && !hasOutputFile) || (!hasOutputFile && manifestFile.empty ())) {
+
+			usageErrorOccured = true;
+
+		}
+
+	} else if (!manifestFile.empty () || (!checkpointFile.empty () && !isFollowing)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Only cracking scores keys, so only cracking has results to cache.
+	if (!cacheDirectory.empty () && selectedMode != CRACK_ARG) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Records are messages of a single text, each cracked on its own.
+	if (hasRecords && (hasInputDirectory || !cacheDirectory.empty () ||
+		(selectedMode != ENCIPHER_ARG && selectedMode != DECIPHER_ARG && selectedMode != CRACK_ARG))) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Directory trees and records carry Caesar keys alone.
+	if (!alphabet.empty () && (hasInputDirectory || hasRecords)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Segmenting applies to a single text.
+	if (selectedMode == SEGMENT_ARG && (hasInputDirectory || hasRecords)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Language profiles apply to cracking a single text.
+	if (!languages.empty () && ((selectedMode != CRACK_ARG && selectedMode != SEGMENT_ARG) || hasInputDirectory || hasRecords)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Dictionaries verify cracked keys of a single text or of records.
+	if (!dictionaryFile.empty () && (selectedMode != CRACK_ARG || hasInputDirectory)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// N-gram profiles rank the keys of a single text, in place of the letter
+	// frequencies that languages and cached results rank them by.
+	if (!ngramFile.empty () && (selectedMode != CRACK_ARG || hasInputDirectory || hasRecords || isFollowing || !languages.empty () || !cacheDirectory.empty ())) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Prose is picked out of a single text to build its histogram, which
+	// cached results and n-gram profiles do not use.
+	if (isProseOnly && (selectedMode != CRACK_ARG || hasInputDirectory || hasRecords || isFollowing || !cacheDirectory.empty () || !ngramFile.empty ())) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Following reads a file as it grows, a byte at a time as far as the
+	// cipher is concerned, so it takes a Caesar key and nothing that needs
+	// the whole text at once.
+	if (isFollowing && (!hasInputFile || hasRecords || !alphabet.empty () || !cacheDirectory.empty () || !languages.empty () || !dictionaryFile.empty () ||
+		(selectedMode != ENCIPHER_ARG && selectedMode != DECIPHER_ARG && selectedMode != CRACK_ARG))) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Containers hold a single text enciphered with Caesar keys, and being
+	// binary have nowhere to go but a file.
+	if (writesContainer && (selectedMode != ENCIPHER_ARG || !alphabet.empty () || !hasOutputFile || hasInputDirectory || hasRecords || isFollowing)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// A compiled dictionary is binary and has nowhere to go but a file.
+	if (selectedMode == COMPILE_DICTIONARY_ARG && (!hasOutputFile || hasInputDirectory || hasRecords)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Duplicates are found among the files of a tree.
+	if (selectedMode == DEDUPLICATE_ARG && !hasInputDirectory) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// A trained profile is binary too, and its corpus is a single text or file.
+	if (selectedMode == TRAIN_ARG && (!hasOutputFile || hasInputDirectory || hasRecords || isFollowing)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Fanning out writes a file per key, so it needs a directory to write them
+	// into, and a single text.
+	if (selectedMode == FAN_OUT_ARG && !hasOutputFile) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// Calibrating measures this machine rather than processing a text, and
+	// overriding what it measures would defeat it. The profile is only ever
+	// loaded from its default file, so it may not be saved anywhere else.
+	if (selectedMode == CALIBRATE_ARG && (hasInput || hasInputFile || hasOutputFile || hasInputDirectory || hasRecords || !languages.empty () || !dictionaryFile.empty () || threadCount != 0 || hasKernel)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	// The kernel must exist on this processor.
+	if (hasKernel && !SubstitutionCipher::isTranslationKernelSupported (kernel)) {
+
+		usageErrorOccured = true;
+
+	}
+
+	if (usageErrorOccured) {
+
+		printUsageError ();
+		return false;
+
+	}
+
+	if (selectedMode == CALIBRATE_ARG) {
+
+		return calibrateAndPrint (Autotuner::getDefaultFilename ());
+
+	}
+
+	// Without a saved profile, or with one that cannot be read, the defaults
+	// are used instead.
+	if (!Autotuner::load (Autotuner::getDefaultFilename (), tuningProfile)) {
+
+		tuningProfile = Autotuner::getDefaultProfile ();
+
+	}
+
+	if (threadCount != 0) {
+
+		tuningProfile.threadCount = threadCount;
+
+	}
+
+	if (hasKernel) {
+
+		tuningProfile.translationKernel = kernel;
+
+	}
+
+	Autotuner::apply (tuningProfile);
+
+	if (!loadLanguageProfiles (languages, profiles)) {
+
+		return false;
+
+	}
+
+	if (!dictionaryFile.empty () && !dictionary.open (dictionaryFile)) {
+
+		printFileLoadingError (dictionaryFile);
+		return false;
+
+	}
+
+	if (!ngramFile.empty () && !ngramProfile.open (ngramFile)) {
+
+		printFileLoadingError (ngramFile);
+		return false;
+
+	}
+
+	// Segments are scored against a single language.
+	if (selectedMode == SEGMENT_ARG && profiles.size () > 1) {
+
+		printUsageError ();
+		return false;
+
+	}
+
+	if (hasInputDirectory && selectedMode == TRIAGE_ARG) {
+
+		return triageTreeAndPrint (inputDirectory, manifestFile);
+
+	}
+
+	if (hasInputDirectory && selectedMode == DEDUPLICATE_ARG) {
+
+		return deduplicateTreeAndPrint (inputDirectory, manifestFile);
+
+	}
+
+	if (isFollowing) {
+
+		return followAndPrint (selectedMode, key, inputFile, outputFile, checkpointFile);
+
+	}
+
+	if (hasInputDirectory) {
+
+		return processTreeAndPrint (selectedMode, key, inputDirectory, outputFile, manifestFile, checkpointFile, cacheDirectory);
+
+	}
+
+	if (selectedMode == TRAIN_ARG) {
+
+		return trainAndPrint (hasInputFile ? inputFile : std::string (), input, outputFile);
+
+	}
+
+	if (selectedMode == FAN_OUT_ARG) {
+
+		return fanOutAndPrint (hasInputFile ? inputFile : std::string (), input, fanOutKeys, outputFile);
+
+	}
+
+	// Triage only needs the start of a file, however large it is.
+	if (selectedMode == TRIAGE_ARG) {
+
+		if (hasInputFile) {
+
+			triageResult = Triage::classifyFile (inputFile, Triage::DEFAULT_SAMPLE_SIZE);
+
+			if (triageResult.classification == Triage::UNREADABLE) {
+
+				printFileLoadingError (inputFile);
+				return false;
+
+			}
+
+		} else {
+
+			triageResult = Triage::classify (input.data (), (input.length () < Triage::DEFAULT_SAMPLE_SIZE) ? input.length () : Triage::DEFAULT_SAMPLE_SIZE);
+
+		}
+
+		output = triageAndPrint (triageResult);
+		selectedMode = '\0';
+
+	} else if (hasInputFile && selectedMode == DECIPHER_ARG && alphabet.empty () && !hasRecords && BlockContainer::isContainerFile (inputFile)) {
+
+		// Every block carries its own key, so the key given is not needed.
+		if (!decipherContainerAndPrint (inputFile, output)) {
+
+			printFileLoadingError (inputFile);
+			return false;
+
+		}
+
+		selectedMode = '\0';
+
+	} else if (hasInputFile) {
+
+		if (!loadFileContents (inputFile, input)) {
+
+			printFileLoadingError (inputFile);
+			return false;
+
+		}
+
+	}
+
+	if (selectedMode == COMPILE_DICTIONARY_ARG) {
+
+		return compileDictionaryAndPrint (input, outputFile);
+
+	}
+
+	if (hasRecords) {
+
+		output = processRecordsAndPrint (selectedMode, key, input, dictionaryFile.empty () ? nullptr : &dictionary);
+		selectedMode = '\0';
+
+	}
+
+	switch (selectedMode) {
+
+	case HELP_ARG:
+		printHelp ();
+		break;
+
+	case ENCIPHER_ARG:
+		if (writesContainer) {
+
+			output = encipherContainerAndPrint (input, key);
+
+			// The container is binary, and its offsets and checksums would no
+			// longer match it if saveFile translated its newlines.
+			if (!FileSystem::writeFile (outputFile, output)) {
+
+				printFileSavingError (outputFile);
+				return false;
+
+			}
+
+			return true;
+
+		} else {
+
+			output = alphabet.empty () ? encipherAndPrint (input, key) : encipherAndPrint (input, alphabet);
+
+		}
+		break;
+
+	case DECIPHER_ARG:
+		output = alphabet.empty () ? decipherAndPrint (input, key) : decipherAndPrint (input, alphabet);
+		break;
+
+	case BRUTE_FORCE_ARG:
+		output = bruteForceAndPrint (input);
+		break;
+
+	case CRACK_ARG:
+		output = crackAndPrint (input, cacheDirectory, profiles, dictionaryFile.empty () ? nullptr : &dictionary, ngramFile.empty () ? nullptr : &ngramProfile, isProseOnly);
+		break;
+
+	case SUBSTITUTION_CRACK_ARG:
+		output = substitutionCrackAndPrint (input);
+		break;
+
+	case AFFINE_CRACK_ARG:
+		output = affineCrackAndPrint (input);
+		break;
+
+	case SEGMENT_ARG:
+		output = segmentAndPrint (input, profiles);
+		break;
+
+	case CLUSTER_ARG:
+		output = clusterKeysAndPrint (input);
+		break;
+
+		// Already processed as records, triaged or read from a container.
+	case '\0':
+		break;
 
 		// Shouldn't happen.
 	default:
@@ -354,335 +1391,3274 @@ bool parseArgs (const int argc, const char* const argv[]) {
 
 	}
 
-	if (hasOutputFile) {
+	if (hasOutputFile) {
+
+		if (!saveFile (outputFile, output)) {
+
+			printFileSavingError (outputFile);
+			return false;
+
+		}
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+bool parseCStringAsKey (const char* const cString, unsigned int& key) {
+
+	int rawInt = 0;
+
+	try {
+
+		rawInt = std::stoi (cString);
+		
+		if (rawInt < 0) {
+
+			return false;
+
+		}
+
+		// Though not necessary, wrapping the key to the proper domain
+		// is good practice.
+		key = rawInt % CaesarCipher::getAlphabetLength ();
+		return true;
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+	return false;
+
+}
+
+//****************************************************************************
+bool parseCStringAsAffineKey (const char* const cString, std::string& alphabet) {
+
+	const char* const comma = strchr (cString, ',');
+	AffineCipher::Key affineKey;
+	int rawMultiplier = 0;
+	int rawShift = 0;
+
+	if (comma == nullptr) {
+
+		return false;
+
+	}
+
+	try {
+
+		rawMultiplier = std::stoi (std::string (cString, comma));
+		rawShift = std::stoi (std::string (comma + 1));
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+	if (rawMultiplier < 0 || rawShift < 0) {
+
+		return false;
+
+	}
+
+	affineKey.multiplier = rawMultiplier % CaesarCipher::ALPHABET_LENGTH;
+	affineKey.shift = rawShift % CaesarCipher::ALPHABET_LENGTH;
+
+	if (!AffineCipher::isValidKey (affineKey)) {
+
+		return false;
+
+	}
+
+	// An affine key is a substitution alphabet, and is carried as one from
+	// here on.
+	alphabet = AffineCipher::getAlphabet (affineKey);
+	return true;
+
+}
+
+//****************************************************************************
+bool parseCStringAsKeyList (const char* const cString, std::vector<unsigned int>& keys) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	std::stringstream stream (cString);
+	std::string item;
+	bool isListed[ALPHABET_LENGTH] = {};
+	std::size_t dash = 0;
+	int rawFirst = 0;
+	int rawLast = 0;
+	unsigned int key = 0;
+
+	keys.clear ();
+
+	while (std::getline (stream, item, ',')) {
+
+		dash = item.find ('-');
+
+		try {
+
+			rawFirst = std::stoi (item.substr (0, dash));
+			rawLast = (dash == std::string::npos) ? rawFirst : std::stoi (item.substr (dash + 1));
+
+		} catch (...) {
+
+			return false;
+
+		}
+
+		if (rawFirst < 0 || rawLast < rawFirst) {
+
+			return false;
+
+		}
+
+		// Keys wrap around the alphabet, so a range never needs more than 26
+		// of them, and a key listed twice would write the same file twice.
+		for (int rawKey = rawFirst; rawKey <= rawLast && rawKey - rawFirst < static_cast<int> (ALPHABET_LENGTH); rawKey++) {
+
+			key = static_cast<unsigned int> (rawKey) % ALPHABET_LENGTH;
+
+			if (!isListed[key]) {
+
+				isListed[key] = true;
+				keys.push_back (key);
+
+			}
+
+		}
+
+	}
+
+	return !keys.empty ();
+
+}
+
+//****************************************************************************
+bool parseCStringAsAlphabet (const char* const cString, std::string& alphabet) {
+
+	const std::string candidate = cString;
+
+	if (!SubstitutionCipher::isValidAlphabet (candidate)) {
+
+		return false;
+
+	}
+
+	alphabet = candidate;
+
+	for (char& character : alphabet) {
+
+		character = static_cast<char> (toupper (static_cast<unsigned char> (character)));
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+bool parseCStringAsCount (const char* const cString, unsigned int& count) {
+
+	int rawInt = 0;
+
+	try {
+
+		rawInt = std::stoi (cString);
+
+		if (rawInt < 1) {
+
+			return false;
+
+		}
+
+		count = static_cast<unsigned int> (rawInt);
+		return true;
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+}
+
+//****************************************************************************
+void printFileLoadingError (const std::string& filename) {
+
+	std::cout << "Failed to load file \"" << filename << "\"." << std::endl;
+
+}
+
+//****************************************************************************
+void printFileSavingError (const std::string& filename) {
+
+	std::cout << "Failed to save to file \"" << filename << "\"." << std::endl;
+
+}
+
+//****************************************************************************
+void printUsageError (void) {
+
+	std::cout << "Invalid arguments. For usage help, type: CCUtil -" << HELP_ARG << std::endl;
+
+}
+
+//****************************************************************************
+void printHelp (void) {
+
+	std::cout << "To encipher, type:\t\t\tCCUtil -" << ENCIPHER_ARG << " KEY" << std::endl
+			  << "To decipher, type:\t\t\tCCUtil -" << DECIPHER_ARG << " KEY" << std::endl
+			  << "To crack key, type:\t\t\tCCUtil -" << CRACK_ARG << std::endl
+			  << "To brute force, type:\t\t\tCCUtil -" << BRUTE_FORCE_ARG << std::endl
+			  << "To triage, type:\t\t\tCCUtil -" << TRIAGE_ARG << std::endl
+			  << "To crack duplicates once, type:\t\tCCUtil -" << DEDUPLICATE_ARG << " -" << INPUT_DIRECTORY_ARG << " \"DIRECTORY\"" << std::endl
+			  << "To crack a substitution, type:\t\tCCUtil -" << SUBSTITUTION_CRACK_ARG << std::endl
+			  << "To crack an affine cipher, type:\tCCUtil -" << AFFINE_CRACK_ARG << std::endl
+			  << "To crack changing keys, type:\t\tCCUtil -" << SEGMENT_ARG << std::endl
+			  << "To crack short messages, type:\t\tCCUtil -" << CLUSTER_ARG << std::endl
+			  << "To encipher under many keys, type:\tCCUtil -" << FAN_OUT_ARG << " KEYS (such as 1,3,5-9) -" << INPUT_FILENAME_ARG << " \"FILENAME\" -" << OUTPUT_FILENAME_ARG << " \"DIRECTORY\"" << std::endl
+			  << "To compile a dictionary, type:\t\tCCUtil -" << COMPILE_DICTIONARY_ARG << " -" << INPUT_FILENAME_ARG << " \"FILENAME\" -" << OUTPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To train an n-gram profile, type:\tCCUtil -" << TRAIN_ARG << " -" << INPUT_FILENAME_ARG << " \"FILENAME\" -" << OUTPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To tune for this machine, type:\t\tCCUtil -" << CALIBRATE_ARG << std::endl
+			  << "To get help, type:\t\t\tCCUtil -" << HELP_ARG << std::endl
+			  << "To specify input text, append:\t\t-" << INPUT_TEXT_ARG << " \"TEXT\"" << std::endl
+			  << "To specify input file, append:\t\t-" << INPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To specify output file, append:\t\t-" << OUTPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To process a directory tree, append:\t-" << INPUT_DIRECTORY_ARG << " \"DIRECTORY\" -" << OUTPUT_FILENAME_ARG << " \"DIRECTORY\"" << std::endl
+			  << "To list a tree's keys, append:\t\t-" << MANIFEST_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To resume from a checkpoint, append:\t-" << CHECKPOINT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To cache crack results, append:\t\t-" << CACHE_DIRECTORY_ARG << " \"DIRECTORY\"" << std::endl
+			  << "To process each line, append:\t\t-" << RECORDS_ARG << std::endl
+			  << "To follow a growing file, append:\t-" << FOLLOW_ARG << " -" << INPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To crack in other languages, append:\t-" << LANGUAGE_ARG << " LANGUAGE (en, de, fr, es, all or \"FILENAME\")" << std::endl
+			  << "To verify keys with words, append:\t-" << DICTIONARY_ARG << " \"FILENAME\"" << std::endl
+			  << "To crack with n-grams, append:\t\t-" << NGRAM_PROFILE_ARG << " \"FILENAME\"" << std::endl
+			  << "To count only prose, append:\t\t-" << PROSE_ARG << std::endl
+			  << "To write a blocked container, append:\t-" << CONTAINER_ARG << " -" << OUTPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
+			  << "To set the thread count, append:\t-" << THREADS_ARG << " COUNT" << std::endl
+			  << "To pick a kernel, append:\t\t-" << KERNEL_ARG << " KERNEL (scalar, ssse3 or avx512)" << std::endl
+			  << "Note: KEY must be a positive integer, an affine key A,B with A odd and not 13, or an ALPHABET of all 26 letters and text/filenames should be in quotes." << std::endl;
+
+}
+
+//****************************************************************************
+std::string encipherInParallel (const std::string& plaintext, const unsigned int key) {
+
+	const std::size_t length = plaintext.length ();
+	const unsigned int threadCount = Autotuner::getThreadCount (tuningProfile, length);
+	std::size_t chunkSize = 0;
+	std::string ciphertext;
+
+	if (threadCount <= 1) {
+
+		return CaesarCipher::encipher (plaintext, key);
+
+	}
+
+	// No chunk is larger than an even share, so that every thread has work.
+	chunkSize = (length + threadCount - 1) / threadCount;
+
+	if (tuningProfile.chunkSize < chunkSize) {
+
+		chunkSize = static_cast<std::size_t> (tuningProfile.chunkSize);
+
+	}
+
+	ciphertext.assign (length, '\0');
+	WorkStealingPool pool (threadCount);
+
+	for (std::size_t offset = 0; offset < length; offset += chunkSize) {
+
+		const std::size_t count = (length - offset < chunkSize) ? length - offset : chunkSize;
+
+		pool.submit ([&plaintext, &ciphertext, key, offset, count] (void) {
+
+			CaesarCipher::encipher (plaintext.data () + offset, count, key, &ciphertext[offset]);
+
+		});
+
+	}
+
+	pool.wait ();
+
+	return ciphertext;
+
+}
+
+//****************************************************************************
+std::string encipherAndPrint (const std::string& plaintext, const unsigned int key) {
+
+	std::string ciphertext;
+
+	ciphertext = encipherInParallel (plaintext, key);
+
+	std::cout << "Plaintext:\t" << plaintext << std::endl
+			  << "Ciphertext:\t" << ciphertext << std::endl
+			  << "Key:\t\t" << key << std::endl;
+
+	return ciphertext;
+
+}
+
+//****************************************************************************
+std::string decipherAndPrint (const std::string& ciphertext, const unsigned int key) {
+
+	std::string plaintext;
+
+	// Deciphering is enciphering with the inverse key.
+	plaintext = encipherInParallel (ciphertext, (CaesarCipher::ALPHABET_LENGTH - key % CaesarCipher::ALPHABET_LENGTH) % CaesarCipher::ALPHABET_LENGTH);
+
+	std::cout << "Ciphertext:\t" << ciphertext << std::endl
+			  << "Plaintext:\t" << plaintext << std::endl
+			  << "Key:\t\t" << key << std::endl;
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+std::string encipherContainerAndPrint (const std::string& plaintext, const unsigned int key) {
+
+	WorkStealingPool pool (tuningProfile.threadCount);
+	std::string container;
+
+	container = BlockContainer::encipher (plaintext.data (), plaintext.length (), std::vector<unsigned int> (1, key), BlockContainer::DEFAULT_BLOCK_SIZE, pool);
+
+	std::cout << "Plaintext:\t" << plaintext << std::endl
+			  << "Blocks:\t\t" << (plaintext.length () + BlockContainer::DEFAULT_BLOCK_SIZE - 1) / BlockContainer::DEFAULT_BLOCK_SIZE << std::endl
+			  << "Key:\t\t" << key << std::endl;
+
+	return container;
+
+}
+
+//****************************************************************************
+bool decipherContainerAndPrint (const std::string& filename, std::string& plaintext) {
+
+	BlockContainer container;
+	WorkStealingPool pool (tuningProfile.threadCount);
+
+	if (!container.open (filename) || !container.decipher (plaintext, pool)) {
+
+		return false;
+
+	}
+
+	std::cout << "Plaintext:\t" << plaintext << std::endl
+			  << "Blocks:\t\t" << container.getBlocks ().size () << std::endl;
+
+	return true;
+
+}
+
+//****************************************************************************
+std::string encipherAndPrint (const std::string& plaintext, const std::string& alphabet) {
+
+	std::string ciphertext;
+
+	ciphertext = SubstitutionCipher::encipher (plaintext, alphabet);
+
+	std::cout << "Plaintext:\t" << plaintext << std::endl
+			  << "Ciphertext:\t" << ciphertext << std::endl
+			  << "Alphabet:\t" << alphabet << std::endl;
+
+	return ciphertext;
+
+}
+
+//****************************************************************************
+std::string decipherAndPrint (const std::string& ciphertext, const std::string& alphabet) {
+
+	std::string plaintext;
+
+	plaintext = SubstitutionCipher::decipher (ciphertext, alphabet);
+
+	std::cout << "Ciphertext:\t" << ciphertext << std::endl
+			  << "Plaintext:\t" << plaintext << std::endl
+			  << "Alphabet:\t" << alphabet << std::endl;
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+std::string crackAndPrint (const std::string& ciphertext, const std::string& cacheDirectory, const std::vector<LanguageProfile>& profiles, const WordDictionary* const dictionary, const NgramProfile* const ngramProfile, const bool isProseOnly) {
+
+	unsigned int estimatedKey = 0;
+	unsigned long long classBytes[ProseFilter::CLASS_COUNT];
+	std::string plaintext;
+	CrackCache::Entry entry;
+	LanguageProfile::Estimate estimate = {};
+	std::vector<double> scores;
+	WordDictionary::Candidate candidates[WordDictionary::DEFAULT_CANDIDATE_COUNT];
+
+	try {
+
+		if (!cacheDirectory.empty ()) {
+
+			CrackCache crackCache (cacheDirectory, CrackCache::DEFAULT_MAXIMUM_SIZE);
+
+			crackCache.crack (ciphertext, entry);
+			estimatedKey = entry.rankedKeys[0];
+
+		} else if (ngramProfile != nullptr) {
+
+			ngramProfile->rankKeys (ciphertext.data (), ciphertext.length (), entry.rankedKeys, entry.rankedScores);
+			estimatedKey = entry.rankedKeys[0];
+
+		} else if (isProseOnly) {
+
+			ProseFilter::countProseLetters (ciphertext, entry.letterCounts, classBytes);
+			estimatedKey = CaesarCipher::crackKey (entry.letterCounts);
+
+		} else if (!profiles.empty ()) {
+
+			CaesarCipher::countLetters (ciphertext, entry.letterCounts);
+
+		} else {
+
+			estimatedKey = CaesarCipher::crackKey (ciphertext);
+
+		}
+
+		// Every language is scored from the same histogram, cached or not.
+		if (!profiles.empty ()) {
+
+			estimate = LanguageProfile::crackKey (entry.letterCounts, profiles, scores);
+			estimatedKey = estimate.key;
+
+		}
+
+		// The dictionary has the final say among the best few keys, ranked by
+		// the best language, the n-gram profile, the cache, or English, in
+		// that order.
+		if (dictionary != nullptr) {
+
+			if (!profiles.empty ()) {
+
+				const double* const row = scores.data () + estimate.profileIndex * CaesarCipher::ALPHABET_LENGTH;
+
+				for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+					entry.rankedKeys[i] = i;
+
+				}
+
+				std::stable_sort (entry.rankedKeys, entry.rankedKeys + CaesarCipher::ALPHABET_LENGTH, [row] (const unsigned int left, const unsigned int right) {
+
+					return row[left] < row[right];
+
+				});
+
+				for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+					entry.rankedScores[i] = row[entry.rankedKeys[i]];
+
+				}
+
+			} else if (cacheDirectory.empty () && ngramProfile == nullptr) {
+
+				if (!isProseOnly) {
+
+					CaesarCipher::countLetters (ciphertext, entry.letterCounts);
+
+				}
+
+				CaesarCipher::rankKeys (entry.letterCounts, entry.rankedKeys, entry.rankedScores);
+
+			}
+
+			for (unsigned int i = 0; i < WordDictionary::DEFAULT_CANDIDATE_COUNT; i++) {
+
+				candidates[i].key = entry.rankedKeys[i];
+				candidates[i].score = entry.rankedScores[i];
+
+			}
+
+			dictionary->verifyKeys (ciphertext.data (), ciphertext.length (), candidates, WordDictionary::DEFAULT_CANDIDATE_COUNT);
+			estimatedKey = candidates[0].key;
+
+		}
+
+	} catch (const std::logic_error& e) {
+
+		// While it is technically possible for any std::logic_error to be caught here,
+		// it is highly likely that the exception is for an invalid alphabet frequency
+		// and even if it wasn't, there is no reason to report it to the user.
+		std::cout << "Internal Error: " << e.what () << std::endl << "Please report this error to the supplier of this utility." << std::endl;
+		return "Internal Error. " + std::string (e.what ()) + "Please report this error to the supplier of this utility.";
+
+	}
+
+	plaintext = CaesarCipher::decipher (ciphertext, estimatedKey);
+
+	std::cout << "Ciphertext:\t\t" << ciphertext << std::endl
+			  << "Most Likely Plaintext:\t" << plaintext << std::endl
+			  << "Estimated Key:\t\t" << estimatedKey << std::endl;
+
+	if (ngramProfile != nullptr) {
+
+		std::cout << "N-gram Cost:\t\t" << ngramProfile->scoreKey (ciphertext.data (), ciphertext.length (), estimatedKey) << " bits" << std::endl;
+
+	}
+
+	if (isProseOnly) {
+
+		std::cout << "Class\t\tBytes" << std::endl;
+
+		for (unsigned int i = 0; i < ProseFilter::CLASS_COUNT; i++) {
+
+			std::cout << std::left << std::setw (10) << ProseFilter::getClassName (static_cast<ProseFilter::SpanClass> (i)) << std::right << '\t' << classBytes[i] << std::endl;
+
+		}
+
+	}
+
+	if (!profiles.empty ()) {
+
+		std::cout << "Estimated Language:\t" << profiles[estimate.profileIndex].getName () << std::endl
+				  << "Language\tKey\tScore" << std::endl;
+
+		// The best key of every language, so that close calls are visible.
+		for (unsigned int i = 0; i < profiles.size (); i++) {
+
+			const std::vector<double>::const_iterator row = scores.begin () + i * CaesarCipher::ALPHABET_LENGTH;
+			const std::vector<double>::const_iterator best = std::min_element (row, row + CaesarCipher::ALPHABET_LENGTH);
+
+			std::cout << profiles[i].getName () << "\t\t" << std::setw (3) << (best - row) << '\t' << *best << std::endl;
+
+		}
+
+	}
+
+	if (dictionary != nullptr) {
+
+		std::cout << "Key\tScore\t\tWords" << std::endl;
+
+		for (const WordDictionary::Candidate& candidate : candidates) {
+
+			std::cout << std::setw (3) << candidate.key << '\t' << std::left << std::setw (10) << candidate.score << std::right << '\t' << candidate.hitRatio << std::endl;
+
+		}
+
+	}
+
+	// With a dictionary, only a plaintext that is mostly not words needs a second look.
+	if (dictionary == nullptr || candidates[0].hitRatio < WordDictionary::READABLE_HIT_RATIO) {
+
+		std::cout << "If the plaintext does not look correct, try a brute force crack (-" << BRUTE_FORCE_ARG << ") of all possible translations." << std::endl;
+
+	}
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+bool compileDictionaryAndPrint (const std::string& wordList, const std::string& filename) {
+
+	const std::string compiled = WordDictionary::compile (wordList);
+	WordDictionary dictionary;
+
+	// Written as is, since saveFile would translate newlines in the binary.
+	if (!FileSystem::writeFile (filename, compiled) || !dictionary.open (filename)) {
+
+		printFileSavingError (filename);
+		return false;
+
+	}
+
+	std::cout << "Words:\t\t" << dictionary.getWordCount () << std::endl
+			  << "Size:\t\t" << compiled.length () << " bytes" << std::endl;
+
+	return true;
+
+}
+
+//****************************************************************************
+bool calibrateAndPrint (const std::string& filename) {
+
+	const Autotuner::Profile profile = Autotuner::calibrate (Autotuner::DEFAULT_SAMPLE_SIZE);
+
+	if (filename.empty () || !Autotuner::save (profile, filename)) {
+
+		printFileSavingError (filename);
+		return false;
+
+	}
+
+	std::cout << "Translation:\t" << Autotuner::getKernelName (profile.translationKernel) << std::endl
+			  << "Counting:\t" << Autotuner::getKernelName (profile.countingKernel) << std::endl
+			  << "Threads:\t" << profile.threadCount << std::endl
+			  << "Chunk size:\t" << profile.chunkSize << " bytes" << std::endl;
+
+	if (profile.parallelThreshold == Autotuner::NEVER_PARALLEL) {
+
+		std::cout << "Threads from:\tnever" << std::endl;
+
+	} else {
+
+		std::cout << "Threads from:\t" << profile.parallelThreshold << " bytes" << std::endl;
+
+	}
+
+	std::cout << "Saved to:\t" << filename << std::endl;
+
+	return true;
+
+}
+
+//****************************************************************************
+bool trainAndPrint (const std::string& corpusFilename, const std::string& text, const std::string& filename) {
+
+	MappedFile corpusFile;
+	WorkStealingPool pool (tuningProfile.threadCount);
+	NgramProfile profile;
+	std::string trained;
+
+	// A corpus file is mapped rather than read, since it may be many times
+	// the size of the profile trained from it.
+	if (!corpusFilename.empty () && !corpusFile.open (corpusFilename)) {
+
+		printFileLoadingError (corpusFilename);
+		return false;
+
+	}
+
+	if (corpusFilename.empty ()) {
+
+		trained = NgramProfile::train (text.data (), text.length (), pool);
+
+	} else {
+
+		trained = NgramProfile::train (corpusFile.getData (), corpusFile.getSize (), pool);
+
+	}
+
+	// Written as is, since saveFile would translate newlines in the binary.
+	if (!FileSystem::writeFile (filename, trained) || !profile.open (filename)) {
+
+		printFileSavingError (filename);
+		return false;
+
+	}
+
+	std::cout << "Letters:\t" << profile.getLetterCount () << std::endl
+			  << "Size:\t\t" << trained.length () << " bytes" << std::endl;
+
+	return true;
+
+}
+
+//****************************************************************************
+bool fanOutAndPrint (const std::string& inputFilename, const std::string& text, const std::vector<unsigned int>& keys, const std::string& outputDirectory) {
+
+	MappedFile inputFile;
+	WorkStealingPool pool (tuningProfile.threadCount);
+	std::vector<std::string> filenames;
+	const char* data = text.data ();
+	std::size_t length = text.length ();
+
+	// The input is mapped rather than read, as a corpus is when training, and
+	// is swept once however many keys there are.
+	if (!inputFilename.empty ()) {
+
+		if (!inputFile.open (inputFilename)) {
+
+			printFileLoadingError (inputFilename);
+			return false;
+
+		}
+
+		data = inputFile.getData ();
+		length = inputFile.getSize ();
+
+	}
+
+	for (const unsigned int key : keys) {
+
+		filenames.push_back (FileSystem::joinPath (outputDirectory, KeyFanOut::getOutputName (key)));
+
+	}
+
+	if (!FileSystem::makeDirectories (outputDirectory) || !KeyFanOut::encipher (data, length, keys, filenames, static_cast<std::size_t> (tuningProfile.chunkSize), pool)) {
+
+		printFileSavingError (outputDirectory);
+		return false;
+
+	}
+
+	std::cout << "Key\tCiphertext" << std::endl;
+
+	for (std::size_t i = 0; i < keys.size (); i++) {
+
+		std::cout << std::setw (3) << keys[i] << '\t' << filenames[i] << std::endl;
+
+	}
+
+	std::cout << "Bytes:\t\t" << static_cast<unsigned long long> (length) * keys.size () << std::endl;
+
+	return true;
+
+}
+
+//****************************************************************************
+bool loadLanguageProfiles (const std::vector<std::string>& languages, std::vector<LanguageProfile>& profiles) {
+
+	const std::vector<LanguageProfile> bundledProfiles = LanguageProfile::getBundledProfiles ();
+	bool isBundled = false;
+
+	for (const std::string& language : languages) {
+
+		isBundled = false;
+
+		for (const LanguageProfile& bundledProfile : bundledProfiles) {
+
+			if (language == "all" || language == bundledProfile.getName ()) {
+
+				profiles.push_back (bundledProfile);
+				isBundled = true;
+
+			}
+
+		}
+
+		if (!isBundled && !LanguageProfile::loadProfiles (language, profiles)) {
+
+			printFileLoadingError (language);
+			return false;
+
+		}
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+std::string substitutionCrackAndPrint (const std::string& ciphertext) {
+
+	WorkStealingPool pool (tuningProfile.threadCount);
+	SubstitutionCipher::Estimate estimate;
+	std::string plaintext;
+
+	estimate = SubstitutionCipher::crackKey (ciphertext, SubstitutionCipher::DEFAULT_RESTARTS, pool);
+	plaintext = SubstitutionCipher::decipher (ciphertext, estimate.alphabet);
+
+	std::cout << "Ciphertext:\t\t" << ciphertext << std::endl
+			  << "Most Likely Plaintext:\t" << plaintext << std::endl
+			  << "Estimated Alphabet:\t" << estimate.alphabet << std::endl
+			  << "Score:\t\t\t" << estimate.score << std::endl
+			  << "Short ciphertexts may leave rare letters wrong; decipher (-" << DECIPHER_ARG << ") with a corrected alphabet to fix them." << std::endl;
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+std::string affineCrackAndPrint (const std::string& ciphertext) {
+
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	AffineCipher::Key rankedKeys[AffineCipher::KEY_COUNT];
+	double rankedScores[AffineCipher::KEY_COUNT];
+	std::string plaintext;
+
+	try {
+
+		// The text is read once; every key is scored from its letter counts.
+		CaesarCipher::countLetters (ciphertext, letterCounts);
+		AffineCipher::rankKeys (letterCounts, rankedKeys, rankedScores);
+
+	} catch (const std::logic_error& e) {
+
+		std::cout << "Internal Error: " << e.what () << std::endl << "Please report this error to the supplier of this utility." << std::endl;
+		return "Internal Error. " + std::string (e.what ()) + "Please report this error to the supplier of this utility.";
+
+	}
+
+	plaintext = AffineCipher::decipher (ciphertext, rankedKeys[0]);
+
+	std::cout << "Ciphertext:\t\t" << ciphertext << std::endl
+			  << "Most Likely Plaintext:\t" << plaintext << std::endl
+			  << "Estimated Key:\t\t" << rankedKeys[0].multiplier << ',' << rankedKeys[0].shift << std::endl
+			  << "Key\tScore" << std::endl;
+
+	for (unsigned int i = 0; i < AFFINE_CANDIDATE_COUNT; i++) {
+
+		std::cout << rankedKeys[i].multiplier << ',' << rankedKeys[i].shift << '\t' << rankedScores[i] << std::endl;
+
+	}
+
+	std::cout << "If the plaintext does not look correct, decipher (-" << DECIPHER_ARG << ") with another of the keys listed." << std::endl;
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+std::string segmentAndPrint (const std::string& ciphertext, const std::vector<LanguageProfile>& profiles) {
+
+	const LanguageProfile profile = profiles.empty () ? LanguageProfile::getBundledProfiles ()[0] : profiles[0];
+	KeySegmenter keySegmenter (profile, KeySegmenter::DEFAULT_WINDOW_LENGTH);
+	WorkStealingPool pool (tuningProfile.threadCount);
+	std::vector<KeySegmenter::Segment> segments;
+	std::string plaintext (ciphertext.length (), '\0');
+
+	segments = keySegmenter.segment (ciphertext.data (), ciphertext.length (), pool);
+
+	for (const KeySegmenter::Segment& segment : segments) {
+
+		CaesarCipher::decipher (ciphertext.data () + segment.offset, segment.length, segment.key, &plaintext[segment.offset]);
+
+	}
+
+	std::cout << "Ciphertext:\t\t" << ciphertext << std::endl
+			  << "Most Likely Plaintext:\t" << plaintext << std::endl
+			  << "Offset\t\tLength\t\tKey" << std::endl;
+
+	for (const KeySegmenter::Segment& segment : segments) {
+
+		std::cout << std::setw (10) << segment.offset << '\t' << std::setw (10) << segment.length << '\t' << std::setw (3) << segment.key << std::endl;
+
+	}
+
+	std::cout << "Segments shorter than about " << KeySegmenter::DEFAULT_WINDOW_LENGTH << " letters blend into their neighbours." << std::endl;
+
+	return plaintext;
+
+}
+
+//****************************************************************************
+std::string triageAndPrint (const Triage::Result& result) {
+
+	std::cout << "Classification:\t\t" << Triage::getClassificationName (result.classification) << std::endl
+			  << "Estimated Key:\t\t" << result.estimatedKey << std::endl
+			  << "Confidence:\t\t" << result.confidence << std::endl
+			  << "Index of Coincidence:\t" << result.indexOfCoincidence << std::endl
+			  << "Letter Density:\t\t" << result.letterDensity << std::endl
+			  << "Bytes Sampled:\t\t" << result.bytesSampled << std::endl;
+
+	if (result.classification == Triage::CAESAR) {
+
+		std::cout << "To read it, try cracking the key (-" << CRACK_ARG << ")." << std::endl;
+
+	} else if (result.classification == Triage::SUBSTITUTION) {
+
+		std::cout << "To read it, try cracking the substitution (-" << SUBSTITUTION_CRACK_ARG << ")." << std::endl;
+
+	}
+
+	return "Class\tKey\tConfidence\tCoincidence\tDensity\n" + formatTriageResult (result) + '\n';
+
+}
+
+//****************************************************************************
+bool triageTreeAndPrint (const std::string& inputDirectory, const std::string& manifestFilename) {
+
+	std::vector<std::string> relativePaths;
+	std::vector<Triage::Result> results;
+	unsigned int classificationCounts[Triage::CLASSIFICATION_COUNT] = { 0 };
+	std::string listing = "Class\tKey\tConfidence\tCoincidence\tDensity\tFile\n";
+	WorkStealingPool pool (tuningProfile.threadCount);
+
+	if (!FileSystem::listFiles (inputDirectory, relativePaths)) {
+
+		std::cout << "Failed to process directory \"" << inputDirectory << "\". Check that it exists." << std::endl;
+		return false;
+
+	}
+
+	Triage::classifyFiles (inputDirectory, relativePaths, Triage::DEFAULT_SAMPLE_SIZE, pool, results);
+
+	for (std::size_t i = 0; i < results.size (); i++) {
+
+		classificationCounts[results[i].classification]++;
+		listing += formatTriageResult (results[i]) + '\t' + relativePaths[i] + '\n';
+
+	}
+
+	if (manifestFilename.empty ()) {
+
+		std::cout.write (listing.data (), listing.length ());
+
+	} else if (!saveFile (manifestFilename, listing)) {
+
+		printFileSavingError (manifestFilename);
+		return false;
+
+	}
+
+	std::cout << "Class\t\tFiles" << std::endl;
+
+	for (unsigned int i = 0; i < Triage::CLASSIFICATION_COUNT; i++) {
+
+		const char* const name = Triage::getClassificationName (static_cast<Triage::Classification> (i));
+
+		// Pad short names out to the second column.
+		std::cout << name << ((std::strlen (name) < 8) ? "\t\t" : "\t") << classificationCounts[i] << std::endl;
+
+	}
+
+	for (std::size_t i = 0; i < results.size (); i++) {
+
+		if (results[i].classification == Triage::UNREADABLE) {
+
+			printFileLoadingError (FileSystem::joinPath (inputDirectory, relativePaths[i]));
+
+		}
+
+	}
+
+	return classificationCounts[Triage::UNREADABLE] == 0;
+
+}
+
+//****************************************************************************
+bool deduplicateTreeAndPrint (const std::string& inputDirectory, const std::string& manifestFilename) {
+
+	std::vector<std::string> relativePaths;
+	std::vector<Deduplicator::Fingerprint> fingerprints;
+	std::vector<std::size_t> representatives;
+	std::vector<unsigned int> keys;
+	std::vector<std::size_t> groupNumbers;
+	std::size_t groupCount = 0;
+	std::size_t unreadableCount = 0;
+	std::ostringstream listing;
+	WorkStealingPool pool (tuningProfile.threadCount);
+
+	if (!FileSystem::listFiles (inputDirectory, relativePaths)) {
+
+		std::cout << "Failed to process directory \"" << inputDirectory << "\". Check that it exists." << std::endl;
+		return false;
+
+	}
+
+	Deduplicator::fingerprintFiles (inputDirectory, relativePaths, pool, fingerprints);
+	groupCount = Deduplicator::groupDuplicates (fingerprints, representatives);
+	keys.resize (fingerprints.size ());
+	groupNumbers.resize (fingerprints.size ());
+	listing << "Group\tKey\tFile\n";
+
+	// A representative always comes before its duplicates, so its key is
+	// known by the time theirs are worked out from it.
+	for (std::size_t i = 0, nextGroupNumber = 1; i < fingerprints.size (); i++) {
+
+		const std::size_t representative = representatives[i];
+
+		if (!fingerprints[i].isReadable) {
+
+			unreadableCount++;
+			listing << "-\t-\t" << relativePaths[i] << '\n';
+
+		} else {
+
+			if (representative == i) {
+
+				keys[i] = CaesarCipher::crackKey (fingerprints[i].letterCounts);
+				groupNumbers[i] = nextGroupNumber;
+				nextGroupNumber++;
+
+			} else {
+
+				keys[i] = Deduplicator::propagateKey (fingerprints[representative], keys[representative], fingerprints[i]);
+				groupNumbers[i] = groupNumbers[representative];
+
+			}
+
+			listing << groupNumbers[i] << '\t' << keys[i] << '\t' << relativePaths[i] << '\n';
+
+		}
+
+	}
+
+	if (manifestFilename.empty ()) {
+
+		std::cout << listing.str ();
+
+	} else if (!saveFile (manifestFilename, listing.str ())) {
+
+		printFileSavingError (manifestFilename);
+		return false;
+
+	}
+
+	std::cout << "Files:\t\t" << fingerprints.size () << std::endl
+			  << "Groups:\t\t" << groupCount - unreadableCount << std::endl
+			  << "Cracks saved:\t" << fingerprints.size () - groupCount << std::endl;
+
+	for (std::size_t i = 0; i < fingerprints.size (); i++) {
+
+		if (!fingerprints[i].isReadable) {
+
+			printFileLoadingError (FileSystem::joinPath (inputDirectory, relativePaths[i]));
+
+		}
+
+	}
+
+	return unreadableCount == 0;
+
+}
+
+//****************************************************************************
+std::string formatTriageResult (const Triage::Result& result) {
+
+	std::ostringstream row;
+
+	row << Triage::getClassificationName (result.classification) << '\t' << result.estimatedKey << '\t'
+		<< std::fixed << std::setprecision (2) << result.confidence << '\t'
+		<< std::setprecision (4) << result.indexOfCoincidence << '\t' << result.letterDensity;
+
+	return row.str ();
+
+}
+
+//****************************************************************************
+std::string bruteForceAndPrint (const std::string& ciphertext) {
+
+	std::string plaintext;
+	std::string output;
+	output.reserve (ciphertext.length () * CaesarCipher::getAlphabetLength ());
+	plaintext.reserve (ciphertext.length ());
+
+	std::cout << "Key\tPlaintext" << std::endl;
+
+	for (unsigned int key = 0; key < CaesarCipher::getAlphabetLength (); key++) {
+
+		plaintext = CaesarCipher::decipher (ciphertext, key);
+
+		// A width of 3 is used to pad the key value out to the end of the column
+		// under the word "Key" in the header.
+		std::cout << std::setw (3) << key << '\t' << plaintext << std::endl;
+		output += plaintext + '\n';
+
+	}
+
+	std::cout << "If multiple keys generate plausible plaintext try cracking the key (-" << CRACK_ARG << ") to see the most statistically likely translation." << std::endl;
+	return output;
+
+}
+
+//****************************************************************************
+std::string processRecordsAndPrint (const char mode, const unsigned int key, const std::string& records, const WordDictionary* const dictionary) {
+
+	TreeProcessor::Operation operation = TreeProcessor::CRACK;
+	std::string output;
+
+	if (mode == ENCIPHER_ARG) {
+
+		operation = TreeProcessor::ENCIPHER;
+
+	} else if (mode == DECIPHER_ARG) {
+
+		operation = TreeProcessor::DECIPHER;
+
+	}
+
+	RecordProcessor recordProcessor (operation, key);
+	WorkStealingPool pool (tuningProfile.threadCount);
+
+	recordProcessor.setDictionary (dictionary);
+
+	try {
+
+		output = recordProcessor.run (records, pool);
+
+	} catch (const std::logic_error& e) {
+
+		std::cout << "Internal Error: " << e.what () << std::endl << "Please report this error to the supplier of this utility." << std::endl;
+		return "Internal Error. " + std::string (e.what ()) + "Please report this error to the supplier of this utility.";
+
+	}
+
+	std::cout.write (output.data (), output.length ());
+
+	if (!output.empty () && output[output.length () - 1] != '\n') {
+
+		std::cout << std::endl;
+
+	}
+
+	return output;
+
+}
+
+//****************************************************************************
+std::string clusterKeysAndPrint (const std::string& messages) {
+
+	WorkStealingPool pool (tuningProfile.threadCount);
+	std::vector<std::size_t> lineStarts;
+	std::vector<KeyClusterer::Histogram> histograms;
+	std::vector<KeyClusterer::Cluster> clusters;
+	std::vector<unsigned int> assignments;
+	std::size_t lineEnd = 0;
+	std::size_t unclusteredCount = 0;
+	unsigned int key = 0;
+	std::ostringstream output;
+	std::string plaintext;
+
+	KeyClusterer::countLines (messages, pool, lineStarts, histograms);
+	KeyClusterer::cluster (histograms, pool, clusters, assignments);
+
+	// Messages without letters read the same under every key, so are given
+	// the key zero.
+	for (std::size_t i = 0; i < lineStarts.size (); i++) {
+
+		lineEnd = (i + 1 < lineStarts.size ()) ? lineStarts[i + 1] : messages.length ();
+
+		if (lineEnd > lineStarts[i] && messages[lineEnd - 1] == '\n') {
+
+			lineEnd--;
+
+		}
+
+		key = 0;
+
+		if (assignments[i] != KeyClusterer::UNCLUSTERED) {
+
+			key = clusters[assignments[i]].key;
+
+		} else {
+
+			unclusteredCount++;
+
+		}
+
+		plaintext.resize (lineEnd - lineStarts[i]);
+
+		if (!plaintext.empty ()) {
+
+			CaesarCipher::decipher (messages.data () + lineStarts[i], plaintext.length (), key, &plaintext[0]);
+
+		}
+
+		output << key << '\t' << plaintext << '\n';
+
+	}
+
+	std::cout << output.str ()
+			  << "Cluster\tKey\tMessages\tLetters" << std::endl;
+
+	for (std::size_t i = 0; i < clusters.size (); i++) {
+
+		std::cout << i << '\t' << clusters[i].key << '\t' << clusters[i].messageCount << "\t\t" << clusters[i].letterTotal << std::endl;
+
+	}
+
+	std::cout << "Messages without letters:\t" << unclusteredCount << std::endl;
+
+	return output.str ();
+
+}
+
+//****************************************************************************
+bool processTreeAndPrint (const char mode, const unsigned int key, const std::string& inputDirectory, const std::string& outputDirectory, const std::string& manifestFilename, const std::string& checkpointFilename, const std::string& cacheDirectory) {
+
+	TreeProcessor::Operation operation = TreeProcessor::CRACK;
+
+	if (mode == ENCIPHER_ARG) {
+
+		operation = TreeProcessor::ENCIPHER;
+
+	} else if (mode == DECIPHER_ARG) {
+
+		operation = TreeProcessor::DECIPHER;
+
+	}
+
+	TreeProcessor treeProcessor (operation, key, inputDirectory, outputDirectory, manifestFilename, checkpointFilename);
+	WorkStealingPool pool (tuningProfile.threadCount);
+	std::unique_ptr<CrackCache> crackCache;
+
+	if (!cacheDirectory.empty ()) {
+
+		crackCache.reset (new CrackCache (cacheDirectory, CrackCache::DEFAULT_MAXIMUM_SIZE));
+		treeProcessor.setCrackCache (crackCache.get ());
+
+	}
+
+	if (!treeProcessor.run (pool)) {
+
+		std::cout << "Failed to process directory \"" << inputDirectory << "\". Check that it exists and that any checkpoint was written for the same mode and key." << std::endl;
+		return false;
+
+	}
+
+	std::cout << "Files processed:\t" << treeProcessor.getFilesProcessed () << std::endl
+			  << "Files resumed:\t\t" << treeProcessor.getFilesResumed () << std::endl
+			  << "Files failed:\t\t" << treeProcessor.getFailedFiles ().size () << std::endl;
+
+	for (const std::string& failedFile : treeProcessor.getFailedFiles ()) {
+
+		printFileLoadingError (failedFile);
+
+	}
+
+	return treeProcessor.getFailedFiles ().empty ();
+
+}
+
+//****************************************************************************
+bool followAndPrint (const char mode, const unsigned int key, const std::string& inputFilename, const std::string& outputFilename, const std::string& checkpointFilename) {
+
+	TreeProcessor::Operation operation = TreeProcessor::CRACK;
+	std::string processed;
+	unsigned int reportedKey = 0;
+
+	if (mode == ENCIPHER_ARG) {
+
+		operation = TreeProcessor::ENCIPHER;
+
+	} else if (mode == DECIPHER_ARG) {
+
+		operation = TreeProcessor::DECIPHER;
+
+	}
+
+	FileFollower fileFollower (operation, key, inputFilename, outputFilename, checkpointFilename);
+
+	if (!fileFollower.open ()) {
+
+		std::cout << "Failed to follow file \"" << inputFilename << "\". Check that the output can be written and that any checkpoint was written for the same mode and key." << std::endl;
+		return false;
+
+	}
+
+	reportedKey = fileFollower.getKey ();
+	isStopRequested = 0;
+	std::signal (SIGINT, requestStop);
+
+	// Without an output file, the console carries the plaintext itself, so
+	// the banner and key estimates are printed only when writing to a file.
+	if (!outputFilename.empty ()) {
+
+		std::cout << "Following \"" << inputFilename << "\" from byte " << fileFollower.getInputOffset () << ". Press Ctrl+C to stop." << std::endl;
+
+	}
+
+	try {
+
+		while (isStopRequested == 0) {
+
+			if (!fileFollower.update (processed)) {
+
+				printFileSavingError (outputFilename.empty () ? checkpointFilename : outputFilename);
+				std::signal (SIGINT, SIG_DFL);
+				return false;
+
+			}
+
+			if (outputFilename.empty ()) {
+
+				std::cout.write (processed.data (), processed.length ());
+				std::cout.flush ();
+
+			} else if (fileFollower.getKey () != reportedKey) {
+
+				reportedKey = fileFollower.getKey ();
+				std::cout << "Estimated Key:\t\t" << reportedKey << " from byte " << fileFollower.getInputOffset () << std::endl;
+
+			}
+
+			// Keep reading while there is more; wait only once caught up.
+			if (processed.empty ()) {
+
+				fileFollower.waitForChange (FileFollower::DEFAULT_WAIT_MILLISECONDS);
+
+			}
+
+		}
+
+	} catch (const std::logic_error& e) {
+
+		std::cout << "Internal Error: " << e.what () << std::endl << "Please report this error to the supplier of this utility." << std::endl;
+		std::signal (SIGINT, SIG_DFL);
+		return false;
+
+	}
+
+	std::signal (SIGINT, SIG_DFL);
+
+	if (!outputFilename.empty ()) {
+
+		std::cout << "Stopped at byte " << fileFollower.getInputOffset () << " of \"" << inputFilename << "\"." << std::endl;
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+void requestStop (int) {
+
+	isStopRequested = 1;
+
+}
+
+//****************************************************************************
+bool loadFileContents (const std::string& filename, std::string& outputString) {
+
+	std::ifstream inputStream;
+	int character = 0;
+
+	try {
+
+		inputStream.open (filename);
+
+		outputString.clear ();
+
+		if (!inputStream.good ()) {
+
+			inputStream.close ();
+			return false;
+
+		}
+
+		while (inputStream.good ()) {
+
+			// This is pretty inefficient; however, the goal of this program
+			// is not to process large files but rather simple strings so
+			// this is a case of not overdesigning for the intended purpose.
+			character = inputStream.get ();
+
+			// The final get hits the end of the file and must not be kept,
+			// otherwise the last record of a file gains a stray character.
+			if (inputStream.good ()) {
+
+				outputString += static_cast<char> (character);
+
+			}
+
+		}
+
+		inputStream.close ();
+		return true;
+
+	} catch (...) {
+
+		try {
+
+			inputStream.close ();
+
+		} catch (...) {
+
+			return false;
+
+		}
+
+		return false;
+
+	}
+
+	return false;
+
+}
+
+//****************************************************************************
+bool saveFile (const std::string& filename, const std::string& contents) {
+
+	std::ofstream outputStream;
+
+	try {
+
+		outputStream.open (filename);
+
+		if (outputStream.good ()) {
+
+			outputStream << contents;
+
+		} else {
+
+			outputStream.close ();
+			return false;
+
+		}
+
+		outputStream.close ();
+		return true;
+
+	} catch (...) {
+
+		try {
+
+			outputStream.close ();
+
+		} catch (...) {
+
+			return false;
+
+		}
+
+		return false;
+
+	}
+
+	return false;
+
+}
+
+//****************************************************************************
+std::string caesarCipherUnitTests () {
+
+	// I would have used "Hello World!" however that phrase is not statistically
+	// common and does not result in finding the correct key when cracking. This
+	// phrase is more common and results in the correct key.
+	const std::string TEST_PLAINTEXT = "attack at Dawn!";
+	const std::string TEST_CIPHERTEXT = "leelnv le Olhy!";
+	const std::string EMPTY_TEXT = "";
+	const unsigned int TEST_KEY = 11;
+	const unsigned int TEST_KEY_LONG = 271;
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+
+	if (CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY) != TEST_CIPHERTEXT) {
+
+		return "Failed to encipher string.";
+
+	}
+
+	if (CaesarCipher::decipher (TEST_CIPHERTEXT, TEST_KEY) != TEST_PLAINTEXT) {
+
+		return "Failed to decipher string.";
+
+	}
+
+	if (CaesarCipher::crackKey (TEST_CIPHERTEXT) != TEST_KEY) {
+
+		return "Failed to determine key.";
+
+	}
+
+	if (CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY_LONG) != TEST_CIPHERTEXT) {
+
+		return "Failed to encipher string with long key.";
+
+	}
+
+	if (CaesarCipher::decipher (TEST_CIPHERTEXT, TEST_KEY_LONG) != TEST_PLAINTEXT) {
+
+		std::cout << CaesarCipher::decipher (TEST_CIPHERTEXT, TEST_KEY_LONG) << std::endl;
+
+		return "Failed to decipher string with long key.";
+
+	}
+
+	if (CaesarCipher::crackKey (TEST_CIPHERTEXT) != TEST_KEY) {
+
+		return "Failed to determine long key.";
+
+	}
+
+	if (CaesarCipher::encipher (EMPTY_TEXT, TEST_KEY) != EMPTY_TEXT) {
+
+		return "Failed to encipher empty string.";
+
+	}
+
+	if (CaesarCipher::decipher (EMPTY_TEXT, TEST_KEY) != EMPTY_TEXT) {
+
+		return "Failed to decipher empty string.";
+
+	}
+
+	if (CaesarCipher::crackKey (EMPTY_TEXT) != 0) {
+
+		return "Failed to determine key from empty string.";
+
+	}
+
+	CaesarCipher::countLetters (TEST_CIPHERTEXT, letterCounts);
+
+	if (CaesarCipher::crackKey (letterCounts) != TEST_KEY) {
+
+		return "Failed to determine key from letter counts.";
+
+	}
+
+	return "All unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string workStealingPoolUnitTests () {
+
+	const unsigned int TEST_THREAD_COUNT = 4;
+	const unsigned int TEST_TASK_COUNT = 1000;
+	const unsigned int TEST_NESTED_TASK_COUNT = 10;
+	std::atomic<unsigned int> tasksRun (0);
+	WorkStealingPool pool (TEST_THREAD_COUNT);
+
+	if (pool.getThreadCount () != TEST_THREAD_COUNT) {
+
+		return "Failed to start worker threads.";
+
+	}
+
+	for (unsigned int i = 0; i < TEST_TASK_COUNT; i++) {
+
+		pool.submit ([&pool, &tasksRun] {
+
+			tasksRun++;
+
+			// Tasks submitted from workers must be waited on as well.
+			for (unsigned int j = 0; j < TEST_NESTED_TASK_COUNT; j++) {
+
+				pool.submit ([&tasksRun] { tasksRun++; });
+
+			}
+
+		});
+
+	}
+
+	pool.wait ();
+
+	if (tasksRun != TEST_TASK_COUNT * (TEST_NESTED_TASK_COUNT + 1)) {
+
+		return "Failed to run every submitted task.";
+
+	}
+
+	pool.submit ([] { throw std::runtime_error ("Test exception."); });
+
+	try {
+
+		pool.wait ();
+		return "Failed to report an exception thrown by a task.";
+
+	} catch (const std::runtime_error&) {
+
+		// Expected.
+
+	}
+
+	// A task waiting on its own pool would wait on itself.
+	pool.submit ([&pool] { pool.wait (); });
+
+	try {
+
+		pool.wait ();
+		return "Failed to refuse a wait from inside a task.";
+
+	} catch (const std::logic_error&) {
+
+		// Expected.
+
+	}
+
+	return "All work stealing pool unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string treeProcessorUnitTests () {
+
+	const std::string TEST_PLAINTEXT = "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, it was the epoch of belief, "
+									   "it was the epoch of incredulity, it was the season of Light, it was the season of Darkness, it was the spring of hope. ";
+	const std::string TEST_DIRECTORY = "CCUtilUnitTestTree";
+	const std::string TEST_OUTPUT_DIRECTORY = "CCUtilUnitTestTreeOutput";
+	const std::string TEST_MANIFEST_FILENAME = "CCUtilUnitTestTree.manifest";
+	const std::string TEST_CHECKPOINT_FILENAME = "CCUtilUnitTestTree.checkpoint";
+	const std::string TEST_FILENAMES[] = { "large.txt", "small.txt", "added.txt" };
+	const unsigned int TEST_KEYS[] = { 7, 3, 19 };
+	const unsigned int TEST_ENCIPHER_KEY = 5;
+	const unsigned long long TEST_CHUNK_SIZE = 64;
+	std::string plaintexts[3];
+	std::string ciphertexts[3];
+	std::ostringstream expectedManifest;
+	unsigned long long size = 0;
+	std::string contents;
+	WorkStealingPool pool (4);
+	std::string testResult = "All tree processor unit tests passed.";
+
+	// The large file spans many chunks, so its letters are counted chunk by
+	// chunk before the deciphering pass.
+	plaintexts[0] = TEST_PLAINTEXT + TEST_PLAINTEXT + TEST_PLAINTEXT + TEST_PLAINTEXT;
+	plaintexts[1] = TEST_PLAINTEXT.substr (0, TEST_CHUNK_SIZE / 2);
+	plaintexts[2] = TEST_PLAINTEXT;
+
+	FileSystem::makeDirectories (TEST_DIRECTORY);
+
+	for (unsigned int i = 0; i < 2; i++) {
+
+		ciphertexts[i] = CaesarCipher::encipher (plaintexts[i], TEST_KEYS[i]);
+		FileSystem::writeFile (FileSystem::joinPath (TEST_DIRECTORY, TEST_FILENAMES[i]), ciphertexts[i]);
+
+	}
+
+	TreeProcessor cracker (TreeProcessor::CRACK, 0, TEST_DIRECTORY, TEST_OUTPUT_DIRECTORY, TEST_MANIFEST_FILENAME, TEST_CHECKPOINT_FILENAME);
+
+	cracker.setChunkSize (TEST_CHUNK_SIZE);
+
+	if (!cracker.run (pool) || cracker.getFilesProcessed () != 2 || cracker.getFilesResumed () != 0 || !cracker.getFailedFiles ().empty ()) {
+
+		testResult = "Failed to crack a directory tree.";
+
+	}
+
+	// Keys of chunked files must match a crack of the whole file.
+	expectedManifest << "Key\tFile\n" << CaesarCipher::crackKey (ciphertexts[0]) << '\t' << TEST_FILENAMES[0] << '\n' << CaesarCipher::crackKey (ciphertexts[1]) << '\t' << TEST_FILENAMES[1] << '\n';
+
+	if (!FileSystem::getFileSize (TEST_MANIFEST_FILENAME, size) || !FileSystem::readFileRange (TEST_MANIFEST_FILENAME, 0, size, contents) || contents != expectedManifest.str ()) {
+
+		testResult = "Failed to crack chunked files as whole files.";
+
+	}
+
+	if (!FileSystem::getFileSize (FileSystem::joinPath (TEST_OUTPUT_DIRECTORY, TEST_FILENAMES[0]), size) ||
+		!FileSystem::readFileRange (FileSystem::joinPath (TEST_OUTPUT_DIRECTORY, TEST_FILENAMES[0]), 0, size, contents) || contents != plaintexts[0]) {
+
+		testResult = "Failed to decipher a chunked file.";
+
+	}
+
+	// A second run skips every file the checkpoint journaled.
+	ciphertexts[2] = CaesarCipher::encipher (plaintexts[2], TEST_KEYS[2]);
+	FileSystem::writeFile (FileSystem::joinPath (TEST_DIRECTORY, TEST_FILENAMES[2]), ciphertexts[2]);
+
+	TreeProcessor resumer (TreeProcessor::CRACK, 0, TEST_DIRECTORY, TEST_OUTPUT_DIRECTORY, TEST_MANIFEST_FILENAME, TEST_CHECKPOINT_FILENAME);
+
+	resumer.setChunkSize (TEST_CHUNK_SIZE);
+
+	if (!resumer.run (pool) || resumer.getFilesProcessed () != 1 || resumer.getFilesResumed () != 2 || !resumer.getFailedFiles ().empty ()) {
+
+		testResult = "Failed to resume from a checkpoint.";
+
+	}
+
+	FileSystem::removeFile (TEST_CHECKPOINT_FILENAME);
+	FileSystem::removeFile (TEST_MANIFEST_FILENAME);
+
+	// Enciphering a chunked file writes each chunk in place.
+	TreeProcessor encipherer (TreeProcessor::ENCIPHER, TEST_ENCIPHER_KEY, TEST_DIRECTORY, TEST_OUTPUT_DIRECTORY, std::string (), std::string ());
+
+	encipherer.setChunkSize (TEST_CHUNK_SIZE);
+
+	if (!encipherer.run (pool) || encipherer.getFilesProcessed () != 3 ||
+		!FileSystem::getFileSize (FileSystem::joinPath (TEST_OUTPUT_DIRECTORY, TEST_FILENAMES[0]), size) ||
+		!FileSystem::readFileRange (FileSystem::joinPath (TEST_OUTPUT_DIRECTORY, TEST_FILENAMES[0]), 0, size, contents) || contents != CaesarCipher::encipher (ciphertexts[0], TEST_ENCIPHER_KEY)) {
+
+		testResult = "Failed to encipher a chunked file.";
+
+	}
+
+	for (const std::string& filename : TEST_FILENAMES) {
+
+		FileSystem::removeFile (FileSystem::joinPath (TEST_DIRECTORY, filename));
+		FileSystem::removeFile (FileSystem::joinPath (TEST_OUTPUT_DIRECTORY, filename));
+
+	}
+
+	FileSystem::removeDirectory (TEST_DIRECTORY);
+	FileSystem::removeDirectory (TEST_OUTPUT_DIRECTORY);
+
+	return testResult;
+
+}
+
+//****************************************************************************
+std::string crackCacheUnitTests () {
+
+	const std::string TEST_CIPHERTEXT = "leelnv le Olhy!";
+	const unsigned int TEST_KEY = 11;
+	const std::string TEST_CACHE_DIRECTORY = "CCUtilUnitTestCache";
+	const std::string TEST_STREAM = "Nobody inspects the spammish repetition, nor the spammish repetition of it.";
+	ContentHash::State hashState;
+	CrackCache::Entry entry;
+	CrackCache::Entry cachedEntry;
+
+	// Published xxHash64 test vectors.
+	if (ContentHash::hash64 ("") != 0xEF46DB3751D8E999ULL ||
+		ContentHash::hash64 ("abc") != 0x44BC2CF5AD770999ULL ||
+		ContentHash::hash64 ("Nobody inspects the spammish repetition") != 0xFBCEA83C8A378BF1ULL) {
+
+		return "Failed to hash content.";
+
+	}
+
+	// Hashing in pieces that straddle stripes matches hashing all at once.
+	ContentHash::startHash64 (hashState, 0);
+
+	for (std::size_t offset = 0; offset < TEST_STREAM.length (); offset += 7) {
+
+		ContentHash::updateHash64 (hashState, TEST_STREAM.data () + offset, (TEST_STREAM.length () - offset < 7) ? TEST_STREAM.length () - offset : 7);
+
+	}
+
+	if (ContentHash::finishHash64 (hashState) != ContentHash::hash64 (TEST_STREAM)) {
+
+		return "Failed to hash content in pieces.";
+
+	}
+
+	CrackCache::computeEntry (TEST_CIPHERTEXT, entry);
+
+	if (entry.rankedKeys[0] != CaesarCipher::crackKey (TEST_CIPHERTEXT) || entry.rankedScores[0] > entry.rankedScores[1]) {
+
+		return "Failed to rank keys.";
+
+	}
+
+	CrackCache crackCache (TEST_CACHE_DIRECTORY, CrackCache::DEFAULT_MAXIMUM_SIZE);
+
+	crackCache.store (TEST_CIPHERTEXT, entry);
+
+	if (!crackCache.crack (TEST_CIPHERTEXT, cachedEntry) || cachedEntry.rankedKeys[0] != TEST_KEY ||
+		memcmp (entry.rankedScores, cachedEntry.rankedScores, sizeof (entry.rankedScores)) != 0) {
+
+		return "Failed to read back cached crack results.";
+
+	}
+
+	if (crackCache.lookup (TEST_CIPHERTEXT + " ", cachedEntry)) {
+
+		return "Failed to tell different ciphertexts apart.";
+
+	}
+
+	// Shrinking the limit to nothing must evict the entry.
+	CrackCache emptyCrackCache (TEST_CACHE_DIRECTORY, 0);
+
+	emptyCrackCache.store (TEST_CIPHERTEXT + " ", entry);
+
+	if (emptyCrackCache.lookup (TEST_CIPHERTEXT, cachedEntry)) {
+
+		return "Failed to evict cached crack results.";
+
+	}
+
+	FileSystem::removeDirectory (TEST_CACHE_DIRECTORY);
+
+	return "All crack cache unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string recordProcessorUnitTests () {
+
+	const std::string TEST_RECORDS = "attack at Dawn!\nretreat at dusk\n\nhold the line";
+	const std::string TEST_ENCIPHERED_RECORDS = "leelnv le Olhy!\ncpecple le ofdv\n\nszwo esp wtyp";
+	const unsigned int TEST_KEY = 11;
+	const unsigned int TEST_BATCH_SIZE = 2;
+	const std::size_t TEST_ALLOCATION_SIZE = 100;
+	MonotonicArena arena (MonotonicArena::DEFAULT_BLOCK_SIZE);
+	RecordProcessor encipherer (TreeProcessor::ENCIPHER, TEST_KEY);
+	RecordProcessor cracker (TreeProcessor::CRACK, 0);
+	RecordProcessor::TextSpan batchOutput;
+	WorkStealingPool pool (2);
+	std::size_t capacity = 0;
+	char* allocation = nullptr;
+
+	allocation = arena.allocate (TEST_ALLOCATION_SIZE);
+	capacity = arena.getCapacity ();
+	arena.reset ();
+
+	if (arena.allocate (TEST_ALLOCATION_SIZE) != allocation || arena.getCapacity () != capacity) {
+
+		return "Failed to reuse arena memory after a reset.";
+
+	}
+
+	if (arena.allocate (MonotonicArena::DEFAULT_BLOCK_SIZE * 2) == nullptr || arena.getCapacity () <= capacity) {
+
+		return "Failed to grow arena.";
+
+	}
+
+	encipherer.setBatchSize (TEST_BATCH_SIZE);
+
+	if (encipherer.run (TEST_RECORDS, pool) != TEST_ENCIPHERED_RECORDS) {
+
+		return "Failed to encipher records.";
+
+	}
+
+	batchOutput = cracker.processBatch (TEST_ENCIPHERED_RECORDS.data (), TEST_ENCIPHERED_RECORDS.find ('\n'), arena);
+
+	if (std::string (batchOutput.data, batchOutput.length) != "11\tattack at Dawn!") {
+
+		return "Failed to crack a record.";
+
+	}
+
+#ifdef _DEBUG
+	unsigned long long allocationsBefore = 0;
+
+	// The first batch grows the arena; an identical second batch must not
+	// touch the heap at all.
+	arena.reset ();
+	cracker.processBatch (TEST_ENCIPHERED_RECORDS.data (), TEST_ENCIPHERED_RECORDS.length (), arena);
+	arena.reset ();
+	allocationsBefore = heapAllocationCount;
+	cracker.processBatch (TEST_ENCIPHERED_RECORDS.data (), TEST_ENCIPHERED_RECORDS.length (), arena);
+	encipherer.processBatch (TEST_RECORDS.data (), TEST_RECORDS.length (), arena);
+
+	if (heapAllocationCount != allocationsBefore) {
+
+		return "Failed to process records without heap allocations.";
+
+	}
+#endif
+
+	return "All record processor unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string languageProfileUnitTests () {
+
+	// Long enough for the letter frequencies of each language to show.
+	const std::string TEST_GERMAN_PLAINTEXT = "Die Sonne schien auf das alte Haus am Ende der Strasse, und die Kinder spielten im Garten hinter dem Zaun.";
+	const std::string TEST_SPANISH_PLAINTEXT = "La casa de mi abuela tenia una puerta azul y ventanas grandes que daban a la plaza del pueblo.";
+	const std::string TEST_PROFILE_FILENAME = "CCUtilUnitTestProfiles.bin";
+	const unsigned int TEST_KEY = 7;
+	const std::vector<LanguageProfile> profiles = LanguageProfile::getBundledProfiles ();
+	std::vector<LanguageProfile> loadedProfiles;
+	std::vector<double> scores;
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	LanguageProfile::Estimate estimate;
+	double englishScores[CaesarCipher::ALPHABET_LENGTH];
+
+	// With English alone the matrix form must agree with CaesarCipher.
+	CaesarCipher::countLetters (CaesarCipher::encipher ("attack at Dawn!", TEST_KEY), letterCounts);
+	estimate = LanguageProfile::crackKey (letterCounts, std::vector<LanguageProfile> (1, profiles[0]), scores);
+	CaesarCipher::scoreKeys (letterCounts, englishScores);
+
+	if (estimate.key != TEST_KEY || std::fabs (scores[TEST_KEY] - englishScores[TEST_KEY]) > 0.001) {
+
+		return "Failed to score English like CaesarCipher.";
+
+	}
+
+	CaesarCipher::countLetters (CaesarCipher::encipher (TEST_GERMAN_PLAINTEXT, TEST_KEY), letterCounts);
+	estimate = LanguageProfile::crackKey (letterCounts, profiles, scores);
+
+	if (estimate.key != TEST_KEY || profiles[estimate.profileIndex].getName () != "de" || scores.size () != profiles.size () * CaesarCipher::ALPHABET_LENGTH) {
+
+		return "Failed to crack German.";
+
+	}
+
+	CaesarCipher::countLetters (CaesarCipher::encipher (TEST_SPANISH_PLAINTEXT, TEST_KEY), letterCounts);
+	estimate = LanguageProfile::crackKey (letterCounts, profiles, scores);
+
+	if (estimate.key != TEST_KEY || profiles[estimate.profileIndex].getName () != "es") {
+
+		return "Failed to crack Spanish.";
+
+	}
+
+	if (!LanguageProfile::saveProfiles (TEST_PROFILE_FILENAME, profiles) || !LanguageProfile::loadProfiles (TEST_PROFILE_FILENAME, loadedProfiles) ||
+		loadedProfiles.size () != profiles.size () || loadedProfiles[1].getName () != "de" ||
+		std::fabs (loadedProfiles[1].getFrequencies ()[4] - profiles[1].getFrequencies ()[4]) > 0.000001) {
+
+		FileSystem::removeFile (TEST_PROFILE_FILENAME);
+		return "Failed to save and load profiles.";
+
+	}
+
+	FileSystem::removeFile (TEST_PROFILE_FILENAME);
+
+	if (LanguageProfile::deserializeProfiles ("CCLP", loadedProfiles)) {
+
+		return "Failed to reject a truncated profile file.";
+
+	}
+
+	return "All language profile unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string triageUnitTests () {
+
+	// Long enough for the index of coincidence to settle, even per column.
+	const std::string TEST_PLAINTEXT = "It was a bright cold day in April, and the clocks were striking thirteen. The hallway smelt of boiled cabbage and old rag mats. "
+									   "At one end of it a coloured poster, too large for indoor display, had been tacked to the wall. It depicted simply an enormous face, "
+									   "more than a metre wide: the face of a man of about forty-five, with a heavy black moustache and ruggedly handsome features. "
+									   "Winston made for the stairs. It was no use trying the lift. Even at the best of times it was seldom working, and at present the "
+									   "electric current was cut off during daylight hours. It was part of the economy drive in preparation for Hate Week.";
+	const std::string TEST_SUBSTITUTION_ALPHABET = "QWERTYUIOPASDFGHJKLZXCVBNM";
+	const unsigned int TEST_KEY = 9;
+	const unsigned int TEST_POLYALPHABETIC_KEYS[] = { 11, 4, 12, 14, 13 };
+	const std::string TEST_FILENAME = "CCUtilUnitTestTriage.txt";
+	std::string substitutionText;
+	std::string polyalphabeticText;
+	std::string randomText;
+	std::string binaryText;
+	unsigned int letterIndex = 0;
+	unsigned int seed = 12345;
+	Triage::Result result;
+
+	if (Triage::classify (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length ()).classification != Triage::PLAINTEXT) {
+
+		return "Failed to triage plaintext.";
+
+	}
+
+	const std::string ciphertext = CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY);
+	result = Triage::classify (ciphertext.data (), ciphertext.length ());
+
+	if (result.classification != Triage::CAESAR || result.estimatedKey != TEST_KEY || result.confidence <= 1.0) {
+
+		return "Failed to triage a Caesar ciphertext.";
+
+	}
+
+	for (const char character : TEST_PLAINTEXT) {
+
+		if (isalpha (static_cast<unsigned char> (character))) {
+
+			const unsigned int index = toupper (static_cast<unsigned char> (character)) - 'A';
+
+			substitutionText += TEST_SUBSTITUTION_ALPHABET[index];
+			polyalphabeticText += static_cast<char> ('A' + (index + TEST_POLYALPHABETIC_KEYS[letterIndex % 5]) % CaesarCipher::ALPHABET_LENGTH);
+			letterIndex++;
+
+		} else {
+
+			substitutionText += character;
+			polyalphabeticText += character;
+
+		}
+
+		// A linear congruential generator keeps the test repeatable.
+		seed = seed * 1103515245 + 12345;
+		randomText += static_cast<char> ('A' + (seed >> 16) % CaesarCipher::ALPHABET_LENGTH);
+		binaryText += static_cast<char> (seed >> 24);
+
+	}
+
+	if (Triage::classify (substitutionText.data (), substitutionText.length ()).classification != Triage::SUBSTITUTION) {
+
+		return "Failed to triage a substitution ciphertext.";
+
+	}
+
+	if (Triage::classify (polyalphabeticText.data (), polyalphabeticText.length ()).classification != Triage::POLYALPHABETIC) {
+
+		return "Failed to triage a polyalphabetic ciphertext.";
+
+	}
+
+	if (Triage::classify (randomText.data (), randomText.length ()).classification != Triage::RANDOM ||
+		Triage::classify (binaryText.data (), binaryText.length ()).classification != Triage::RANDOM) {
+
+		return "Failed to triage random data.";
+
+	}
+
+	if (Triage::classify ("attack at dawn", 14).classification != Triage::UNDETERMINED || Triage::classify (nullptr, 0).classification != Triage::UNDETERMINED) {
+
+		return "Failed to leave short text undetermined.";
+
+	}
+
+	// Only the sample at the start of a file is read.
+	if (!FileSystem::writeFile (TEST_FILENAME, ciphertext + std::string (1000, '\0'))) {
+
+		return "Failed to write triage test file.";
+
+	}
+
+	result = Triage::classifyFile (TEST_FILENAME, ciphertext.length ());
+	FileSystem::removeFile (TEST_FILENAME);
+
+	if (result.classification != Triage::CAESAR || result.bytesSampled != ciphertext.length ()) {
+
+		return "Failed to triage the start of a file.";
+
+	}
+
+	if (Triage::classifyFile (TEST_FILENAME, Triage::DEFAULT_SAMPLE_SIZE).classification != Triage::UNREADABLE) {
+
+		return "Failed to report an unreadable file.";
+
+	}
+
+	return "All triage unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string substitutionCipherUnitTests () {
+
+	// Not part of the text the bigram frequencies were counted from.
+	const std::string TEST_PLAINTEXT = "It was a bright cold day in April, and the clocks were striking thirteen. The hallway smelt of boiled cabbage and old rag mats. "
+									   "At one end of it a coloured poster, too large for indoor display, had been tacked to the wall. It depicted simply an enormous face, "
+									   "more than a metre wide: the face of a man of about forty-five, with a heavy black moustache and ruggedly handsome features. "
+									   "Winston made for the stairs. It was no use trying the lift. Even at the best of times it was seldom working, and at present the "
+									   "electric current was cut off during daylight hours. It was part of the economy drive in preparation for Hate Week.";
+	const std::string TEST_ALPHABET = "qwertyuiopasdfghjklzxcvbnm";
+	const unsigned int TEST_KEY = 11;
+	unsigned int bigramCounts[SubstitutionCipher::BIGRAM_COUNT];
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	std::string mixedText;
+	std::string expectedText;
+	unsigned int correctLetters = 0;
+	WorkStealingPool pool (0);
+	SubstitutionCipher::Estimate estimate;
+
+	if (!SubstitutionCipher::isValidAlphabet (TEST_ALPHABET) || SubstitutionCipher::isValidAlphabet ("QWERTYUIOPASDFGHJKLZXCVBNQ") ||
+		SubstitutionCipher::isValidAlphabet ("QWERTY") || SubstitutionCipher::isValidAlphabet ("QWERTYUIOPASDFGHJKLZXCVBN1")) {
+
+		return "Failed to validate alphabets.";
+
+	}
+
+	if (SubstitutionCipher::encipher (TEST_PLAINTEXT, SubstitutionCipher::getCaesarAlphabet (TEST_KEY)) != CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY)) {
+
+		return "Failed to encipher a Caesar alphabet like CaesarCipher.";
+
+	}
+
+	// Every byte value, at a length that leaves a tail for each kernel width.
+	for (unsigned int i = 0; i < 1000; i++) {
+
+		const unsigned char character = static_cast<unsigned char> (i * 7);
+
+		mixedText += static_cast<char> (character);
+
+		if (isupper (character) && character < 0x80) {
+
+			expectedText += static_cast<char> (toupper (TEST_ALPHABET[character - 'A']));
+
+		} else if (islower (character) && character < 0x80) {
+
+			expectedText += TEST_ALPHABET[character - 'a'];
+
+		} else {
+
+			expectedText += static_cast<char> (character);
+
+		}
+
+	}
+
+	if (SubstitutionCipher::encipher (mixedText, TEST_ALPHABET) != expectedText || SubstitutionCipher::decipher (expectedText, TEST_ALPHABET) != mixedText) {
+
+		return "Failed to encipher and decipher every byte.";
+
+	}
+
+	if (SubstitutionCipher::invertAlphabet (SubstitutionCipher::invertAlphabet (TEST_ALPHABET)) != "QWERTYUIOPASDFGHJKLZXCVBNM") {
+
+		return "Failed to invert alphabet.";
+
+	}
+
+	try {
+
+		SubstitutionCipher::encipher (TEST_PLAINTEXT, "ABC");
+		return "Failed to reject an invalid alphabet.";
+
+	} catch (const std::logic_error&) {
+
+		// Expected.
+
+	}
+
+	if (SubstitutionCipher::countBigrams ("ab, Ab!", 7, bigramCounts) != 2 || bigramCounts[1] != 2) {
+
+		return "Failed to count bigrams.";
+
+	}
+
+	const std::string ciphertext = SubstitutionCipher::encipher (TEST_PLAINTEXT, TEST_ALPHABET);
+	estimate = SubstitutionCipher::crackKey (ciphertext, SubstitutionCipher::DEFAULT_RESTARTS, pool);
+	const std::string plaintext = SubstitutionCipher::decipher (ciphertext, estimate.alphabet);
+
+	// Rare letters may be swapped in a text this short, but little else.
+	for (std::size_t i = 0; i < plaintext.length (); i++) {
+
+		if (isalpha (static_cast<unsigned char> (plaintext[i])) && plaintext[i] == TEST_PLAINTEXT[i]) {
+
+			correctLetters++;
+
+		}
+
+	}
+
+	if (correctLetters < CaesarCipher::countLetters (TEST_PLAINTEXT, letterCounts) * 95 / 100) {
+
+		return "Failed to crack a substitution.";
+
+	}
+
+	return "All substitution cipher unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string keySegmenterUnitTests () {
+
+	const std::string TEST_PLAINTEXT = "It was a bright cold day in April, and the clocks were striking thirteen. The hallway smelt of boiled cabbage and old rag mats. "
+									   "At one end of it a coloured poster, too large for indoor display, had been tacked to the wall. It depicted simply an enormous face, "
+									   "more than a metre wide: the face of a man of about forty-five, with a heavy black moustache and ruggedly handsome features. ";
+	const unsigned int TEST_KEYS[] = { 3, 17, 8 };
+	const std::size_t SEGMENT_COUNT = sizeof (TEST_KEYS) / sizeof (TEST_KEYS[0]);
+	const LanguageProfile english = LanguageProfile::getBundledProfiles ()[0];
+	KeySegmenter keySegmenter (english, KeySegmenter::DEFAULT_WINDOW_LENGTH);
+	WorkStealingPool pool (4);
+	std::vector<KeySegmenter::Segment> segments;
+	std::vector<KeySegmenter::Segment> chunkedSegments;
+	std::string ciphertext;
+
+	for (std::size_t i = 0; i < SEGMENT_COUNT; i++) {
+
+		ciphertext += CaesarCipher::encipher (TEST_PLAINTEXT + TEST_PLAINTEXT, TEST_KEYS[i]);
+
+	}
+
+	segments = keySegmenter.segment (ciphertext.data (), ciphertext.length (), pool);
+
+	if (segments.size () != SEGMENT_COUNT) {
+
+		return "Failed to find every key change.";
+
+	}
+
+	for (std::size_t i = 0; i < SEGMENT_COUNT; i++) {
+
+		const std::size_t expectedOffset = i * TEST_PLAINTEXT.length () * 2;
+
+		// A boundary may drift over letters that read alike under both keys.
+		if (segments[i].key != TEST_KEYS[i] || segments[i].offset + 8 < expectedOffset || segments[i].offset > expectedOffset + 8) {
+
+			return "Failed to place a key change.";
+
+		}
+
+	}
+
+	// Chunks start from their own window, so how the scan is split must not matter.
+	keySegmenter.setChunkLength (37);
+	chunkedSegments = keySegmenter.segment (ciphertext.data (), ciphertext.length (), pool);
+
+	if (chunkedSegments.size () != segments.size ()) {
+
+		return "Failed to segment the same in chunks.";
+
+	}
+
+	for (std::size_t i = 0; i < segments.size (); i++) {
+
+		if (chunkedSegments[i].offset != segments[i].offset || chunkedSegments[i].length != segments[i].length || chunkedSegments[i].key != segments[i].key) {
+
+			return "Failed to segment the same in chunks.";
+
+		}
+
+	}
+
+	ciphertext = CaesarCipher::encipher (TEST_PLAINTEXT + TEST_PLAINTEXT + TEST_PLAINTEXT, TEST_KEYS[1]);
+	segments = keySegmenter.segment (ciphertext.data (), ciphertext.length (), pool);
+
+	if (segments.size () != 1 || segments[0].key != TEST_KEYS[1] || segments[0].length != ciphertext.length ()) {
+
+		return "Failed to keep a single key whole.";
+
+	}
+
+	segments = keySegmenter.segment ("Khoor", 5, pool);
+
+	if (segments.size () != 1 || segments[0].offset != 0 || segments[0].length != 5) {
+
+		return "Failed to segment text shorter than a window.";
+
+	}
+
+	return "All key segmenter unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string wordDictionaryUnitTests () {
+
+	const std::string TEST_WORD_LIST = "box\nof\nHot\nsoup\nbread\nthe\nan\nof\n";
+	const std::string TEST_PLAINTEXT = "box of hot soup";
+	const std::string TEST_DICTIONARY_FILENAME = "CCUtilUnitTestDictionary.bin";
+	const unsigned int TEST_KEY = 3;
+	const unsigned int TEST_GENERATED_WORD_COUNT = 20000;
+	const std::string ciphertext = CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY);
+	std::string compiled = WordDictionary::compile (TEST_WORD_LIST);
+	std::string generatedWordList;
+	std::string generatedWord;
+	WordDictionary dictionary;
+	WordDictionary generatedDictionary;
+	MappedFile mappedFile;
+	RecordProcessor cracker (TreeProcessor::CRACK, 0);
+	MonotonicArena arena (MonotonicArena::DEFAULT_BLOCK_SIZE);
+	RecordProcessor::TextSpan batchOutput;
+	WordDictionary::Candidate candidates[WordDictionary::DEFAULT_CANDIDATE_COUNT];
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int rankedKeys[CaesarCipher::ALPHABET_LENGTH];
+	double rankedScores[CaesarCipher::ALPHABET_LENGTH];
+
+	if (!FileSystem::writeFile (TEST_DICTIONARY_FILENAME, compiled) || !mappedFile.open (TEST_DICTIONARY_FILENAME) ||
+		mappedFile.getSize () != compiled.length () || memcmp (mappedFile.getData (), compiled.data (), compiled.length ()) != 0) {
+
+		FileSystem::removeFile (TEST_DICTIONARY_FILENAME);
+		return "Failed to map a file.";
+
+	}
+
+	mappedFile.close ();
+
+	if (!dictionary.open (TEST_DICTIONARY_FILENAME) || dictionary.getWordCount () != 7 ||
+		!dictionary.contains ("SOUP", 4) || !dictionary.contains ("hot", 3) || dictionary.contains ("hoot", 4) || dictionary.contains ("", 0)) {
+
+		FileSystem::removeFile (TEST_DICTIONARY_FILENAME);
+		return "Failed to open a compiled dictionary.";
+
+	}
+
+	FileSystem::removeFile (TEST_DICTIONARY_FILENAME);
+
+	// Plain word lists are compiled on load.
+	if (!dictionary.load (TEST_WORD_LIST) || dictionary.getWordCount () != 7 || !dictionary.contains ("Bread", 5)) {
+
+		return "Failed to load a word list.";
+
+	}
+
+	if (dictionary.computeHitRatio (ciphertext.data (), ciphertext.length (), TEST_KEY) != 1.0 ||
+		dictionary.computeHitRatio (ciphertext.data (), ciphertext.length (), 0) != 0.0 ||
+		dictionary.computeHitRatio (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length (), 0) != 1.0) {
+
+		return "Failed to measure hit ratios.";
+
+	}
+
+	// Letter frequencies alone rank the right key of so short a text third.
+	CaesarCipher::countLetters (ciphertext, letterCounts);
+	CaesarCipher::rankKeys (letterCounts, rankedKeys, rankedScores);
+
+	for (unsigned int i = 0; i < WordDictionary::DEFAULT_CANDIDATE_COUNT; i++) {
+
+		candidates[i].key = rankedKeys[i];
+		candidates[i].score = rankedScores[i];
+
+	}
+
+	dictionary.verifyKeys (ciphertext.data (), ciphertext.length (), candidates, WordDictionary::DEFAULT_CANDIDATE_COUNT);
+
+	if (rankedKeys[0] == TEST_KEY || candidates[0].key != TEST_KEY || candidates[0].hitRatio != 1.0 || candidates[1].hitRatio > candidates[0].hitRatio) {
+
+		return "Failed to re-rank keys by their words.";
+
+	}
+
+	cracker.setDictionary (&dictionary);
+	batchOutput = cracker.processBatch (ciphertext.data (), ciphertext.length (), arena);
+
+	if (std::string (batchOutput.data, batchOutput.length) != "3\t" + TEST_PLAINTEXT) {
+
+		return "Failed to verify the key of a record.";
+
+	}
+
+#ifdef _DEBUG
+	unsigned long long allocationsBefore = 0;
+
+	arena.reset ();
+	allocationsBefore = heapAllocationCount;
+	cracker.processBatch (ciphertext.data (), ciphertext.length (), arena);
+
+	if (heapAllocationCount != allocationsBefore) {
+
+		return "Failed to verify records without heap allocations.";
+
+	}
+#endif
+
+	// Every distinct letter string of a large list must be found.
+	for (unsigned int i = 0; i < TEST_GENERATED_WORD_COUNT; i++) {
+
+		generatedWord.clear ();
+
+		for (unsigned int value = i + CaesarCipher::ALPHABET_LENGTH; value != 0; value /= CaesarCipher::ALPHABET_LENGTH) {
+
+			generatedWord += static_cast<char> ('a' + value % CaesarCipher::ALPHABET_LENGTH);
+
+		}
+
+		generatedWordList += generatedWord + ' ';
+
+	}
+
+	if (!generatedDictionary.load (generatedWordList) || generatedDictionary.getWordCount () != TEST_GENERATED_WORD_COUNT ||
+		!generatedDictionary.contains ("ab", 2) || !generatedDictionary.contains (generatedWord.data (), generatedWord.length ()) ||
+		generatedDictionary.contains ("abcdefghij", 10)) {
+
+		return "Failed to compile a large word list.";
+
+	}
+
+	compiled[compiled.length () / 2] ^= 0x01;
+
+	if (dictionary.load (compiled) || dictionary.getWordCount () != 0 || dictionary.contains ("soup", 4)) {
+
+		return "Failed to reject a corrupt dictionary.";
+
+	}
+
+	return "All word dictionary unit tests passed.";
+
+}
+
+//****************************************************************************
+std::string fileFollowerUnitTests () {
+
+	const std::string TEST_INPUT_FILENAME = "CCUtilUnitTestFollowed.txt";
+	const std::string TEST_OUTPUT_FILENAME = "CCUtilUnitTestFollowed.out";
+	const std::string TEST_CHECKPOINT_FILENAME = "CCUtilUnitTestFollowed.checkpoint";
+	const std::string TEST_LINES[] = { "attack at Dawn!\n", "retreat at dusk\n", "hold the line\n" };
+	const std::string TEST_PLAINTEXT = "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness.\n";
+	const unsigned int TEST_KEY = 11;
+	std::string processed;
+	std::string output;
+	unsigned long long size = 0;
+	std::string result = "All file follower unit tests passed.";
+
+	FileSystem::writeFile (TEST_INPUT_FILENAME, TEST_LINES[0]);
+
+	{
+
+		FileFollower fileFollower (TreeProcessor::ENCIPHER, TEST_KEY, TEST_INPUT_FILENAME, TEST_OUTPUT_FILENAME, TEST_CHECKPOINT_FILENAME);
+
+		if (!fileFollower.open () || !fileFollower.update (processed) || processed != CaesarCipher::encipher (TEST_LINES[0], TEST_KEY)) {
+
+			result = "Failed to process a followed file.";
+
+		}
+
+		// Only what was appended since is processed.
+		FileSystem::writeFileRange (TEST_INPUT_FILENAME, TEST_LINES[0].length (), TEST_LINES[1]);
+		fileFollower.waitForChange (0);
+
+		if (!fileFollower.update (processed) || processed != CaesarCipher::encipher (TEST_LINES[1], TEST_KEY) ||
+			!fileFollower.update (processed) || !processed.empty ()) {
+
+			result = "Failed to process appended bytes alone.";
+
+		}
+
+	}
+
+	// A new follower resumes from the checkpoint.
+	FileSystem::writeFileRange (TEST_INPUT_FILENAME, TEST_LINES[0].length () + TEST_LINES[1].length (), TEST_LINES[2]);
+
+	{
+
+		FileFollower fileFollower (TreeProcessor::ENCIPHER, TEST_KEY, TEST_INPUT_FILENAME, TEST_OUTPUT_FILENAME, TEST_CHECKPOINT_FILENAME);
+
+		FileSystem::getFileSize (TEST_OUTPUT_FILENAME, size);
+
+		if (!fileFollower.open () || fileFollower.getInputOffset () != TEST_LINES[0].length () + TEST_LINES[1].length () || !fileFollower.update (processed) ||
+			!FileSystem::readFileRange (TEST_OUTPUT_FILENAME, 0, size + TEST_LINES[2].length (), output) ||
+			output != CaesarCipher::encipher (TEST_LINES[0] + TEST_LINES[1] + TEST_LINES[2], TEST_KEY)) {
+
+			result = "Failed to resume following from a checkpoint.";
+
+		}
+
+		// A truncated file is read again from its start.
+		FileSystem::writeFile (TEST_INPUT_FILENAME, TEST_LINES[1]);
+
+		if (!fileFollower.update (processed) || processed != CaesarCipher::encipher (TEST_LINES[1], TEST_KEY) || fileFollower.getInputOffset () != TEST_LINES[1].length ()) {
+
+			result = "Failed to follow a truncated file.";
+
+		}
+
+	}
+
+	{
+
+		FileFollower fileFollower (TreeProcessor::DECIPHER, TEST_KEY, TEST_INPUT_FILENAME, TEST_OUTPUT_FILENAME, TEST_CHECKPOINT_FILENAME);
+
+		if (fileFollower.open ()) {
+
+			result = "Failed to reject a checkpoint of another mode.";
+
+		}
+
+	}
+
+	FileSystem::removeFile (TEST_CHECKPOINT_FILENAME);
+	FileSystem::writeFile (TEST_INPUT_FILENAME, CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY));
+
+	// Letter counts survive a restart, so the key does too.
+	{
+
+		FileFollower fileFollower (TreeProcessor::CRACK, 0, TEST_INPUT_FILENAME, "", TEST_CHECKPOINT_FILENAME);
+
+		if (!fileFollower.open () || !fileFollower.update (processed) || processed != TEST_PLAINTEXT || fileFollower.getKey () != TEST_KEY) {
+
+			result = "Failed to crack a followed file.";
+
+		}
+
+	}
+
+	{
+
+		FileFollower fileFollower (TreeProcessor::CRACK, 0, TEST_INPUT_FILENAME, "", TEST_CHECKPOINT_FILENAME);
+
+		if (!fileFollower.open () || fileFollower.getKey () != TEST_KEY) {
+
+			result = "Failed to resume cracking from a checkpoint.";
+
+		}
+
+	}
+
+	FileSystem::removeFile (TEST_INPUT_FILENAME);
+	FileSystem::removeFile (TEST_OUTPUT_FILENAME);
+	FileSystem::removeFile (TEST_CHECKPOINT_FILENAME);
+
+	return result;
+
+}
+
+//****************************************************************************
+std::string blockContainerUnitTests () {
+
+	const std::string TEST_FILENAME = "CCUtilUnitTestContainer.ccbc";
+	const std::string TEST_PLAINTEXT = "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness.";
+	const std::size_t TEST_BLOCK_SIZE = 16;
+	const unsigned int TEST_KEYS[] = { 3, 7, 11 };
+	const std::vector<unsigned int> keys (TEST_KEYS, TEST_KEYS + 3);
+	WorkStealingPool pool (4);
+	BlockContainer container;
+	std::string contents;
+	std::string plaintext;
+	char range[64];
+	std::string result = "All block container unit tests passed.";
+
+	contents = BlockContainer::encipher (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length (), keys, TEST_BLOCK_SIZE, pool);
+
+	if (!container.load (contents) || container.getLength () != TEST_PLAINTEXT.length () ||
+		container.getBlocks ().size () != (TEST_PLAINTEXT.length () + TEST_BLOCK_SIZE - 1) / TEST_BLOCK_SIZE || container.getBlocks ()[4].key != TEST_KEYS[1]) {
+
+		result = "Failed to load a container.";
+
+	}
+
+	if (!container.decipher (plaintext, pool) || plaintext != TEST_PLAINTEXT) {
+
+		result = "Failed to decipher a container.";
+
+	}
+
+	// Ranges may start and end anywhere, including across several blocks.
+	for (std::size_t offset = 0; offset < TEST_PLAINTEXT.length (); offset += 5) {
+
+		const std::size_t length = (TEST_PLAINTEXT.length () - offset < sizeof (range)) ? TEST_PLAINTEXT.length () - offset : sizeof (range);
+#ifdef _DEBUG
+		const unsigned long long allocationsBefore = heapAllocationCount;
+#endif
+
+		if (!container.decipherRange (offset, length, range) || TEST_PLAINTEXT.compare (offset, length, range, length) != 0) {
+
+			result = "Failed to decipher a range of a container.";
+
+		}
+
+#ifdef _DEBUG
+		if (heapAllocationCount != allocationsBefore) {
+
+			result = "Failed to decipher a range of a container without heap allocations.";
+
+		}
+#endif
+
+	}
+
+	if (container.decipherRange (TEST_PLAINTEXT.length () - 1, 2, range)) {
+
+		result = "Failed to reject a range past the end of a container.";
+
+	}
+
+	// A corrupt block fails alone; ranges that avoid it still decipher.
+	contents[30] ^= 1;
+
+	if (!container.load (contents) || container.decipher (plaintext, pool) || container.decipherRange (TEST_BLOCK_SIZE - 1, 2, range) ||
+		!container.decipherRange (2 * TEST_BLOCK_SIZE, TEST_BLOCK_SIZE, range)) {
+
+		result = "Failed to detect a corrupt block.";
+
+	}
+
+	contents[30] ^= 1;
+	contents[contents.length () - 20] ^= 1;
+
+	if (container.load (contents)) {
+
+		result = "Failed to detect a corrupt index.";
+
+	}
+
+	contents = BlockContainer::encipher ("", 0, keys, TEST_BLOCK_SIZE, pool);
+
+	if (!container.load (contents) || !container.getBlocks ().empty () || !container.decipher (plaintext, pool) || !plaintext.empty ()) {
+
+		result = "Failed to round trip an empty container.";
+
+	}
+
+	FileSystem::writeFile (TEST_FILENAME, BlockContainer::encipher (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length (), keys, BlockContainer::DEFAULT_BLOCK_SIZE, pool));
+
+	if (!BlockContainer::isContainerFile (TEST_FILENAME) || !container.open (TEST_FILENAME) || !container.decipher (plaintext, pool) || plaintext != TEST_PLAINTEXT) {
+
+		result = "Failed to open a container file.";
+
+	}
+
+	FileSystem::writeFile (TEST_FILENAME, TEST_PLAINTEXT);
+
+	if (BlockContainer::isContainerFile (TEST_FILENAME) || container.open (TEST_FILENAME)) {
+
+		result = "Failed to reject a file that is not a container.";
+
+	}
+
+	FileSystem::removeFile (TEST_FILENAME);
+
+	return result;
+
+}
+
+//****************************************************************************
+std::string jobRunnerUnitTests () {
+
+	const std::string TEST_PLAINTEXT = "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness.";
+	const std::size_t TEST_CHUNK_SIZE = 16;
+	const unsigned int TEST_KEY = 11;
+	const unsigned int TEST_JOB_COUNT = 20;
+	const std::string ciphertext = CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY);
+	const std::size_t chunkCount = (TEST_PLAINTEXT.length () + TEST_CHUNK_SIZE - 1) / TEST_CHUNK_SIZE;
+	WorkStealingPool pool (2);
+	JobRunner jobRunner (pool);
+	JobRunner::CancellationToken token;
+	JobRunner::CancellationToken cancelledToken;
+	std::vector<std::future<JobRunner::Result> > futures;
+	std::atomic<unsigned int> progressCalls (0);
+	std::atomic<unsigned long long> lastProcessed (0);
+	std::string bruteForceOutput;
+	JobRunner::Result result;
+	std::string testResult = "All job runner unit tests passed.";
+
+	jobRunner.setChunkSize (TEST_CHUNK_SIZE);
+
+	result = jobRunner.submit (JobRunner::ENCIPHER, TEST_PLAINTEXT, TEST_KEY, token, [&progressCalls, &lastProcessed] (const unsigned long long processed, const unsigned long long total) {
+
+		progressCalls++;
+		lastProcessed = (processed <= total) ? processed : 0;
+
+	}).get ();
+
+	if (result.isCancelled || result.output != ciphertext || result.key != TEST_KEY) {
+
+		testResult = "Failed to encipher with a job.";
+
+	}
+
+	if (progressCalls != chunkCount || lastProcessed != TEST_PLAINTEXT.length ()) {
+
+		testResult = "Failed to report the progress of a job.";
+
+	}
+
+	result = jobRunner.submit (JobRunner::CRACK, ciphertext, 0, token, JobRunner::ProgressCallback ()).get ();
+
+	if (result.output != TEST_PLAINTEXT || result.key != TEST_KEY) {
+
+		testResult = "Failed to crack with a job.";
+
+	}
+
+	for (unsigned int key = 0; key < CaesarCipher::ALPHABET_LENGTH; key++) {
+
+		bruteForceOutput += CaesarCipher::decipher (ciphertext, key) + '\n';
+
+	}
+
+	if (jobRunner.submit (JobRunner::BRUTE_FORCE, ciphertext, 0, token, JobRunner::ProgressCallback ()).get ().output != bruteForceOutput) {
+
+		testResult = "Failed to brute force with a job.";
+
+	}
+
+	// Many more jobs than workers all finish, in whatever order they run.
+	for (unsigned int i = 0; i < TEST_JOB_COUNT; i++) {
+
+		futures.push_back (jobRunner.submit (JobRunner::DECIPHER, CaesarCipher::encipher (TEST_PLAINTEXT, i), i, token, JobRunner::ProgressCallback ()));
+
+	}
+
+	for (std::future<JobRunner::Result>& future : futures) {
+
+		if (future.get ().output != TEST_PLAINTEXT) {
+
+			testResult = "Failed to run many jobs on a shared pool.";
+
+		}
+
+	}
+
+	// Cancelling between chunks stops the job before the next chunk.
+	progressCalls = 0;
+	result = jobRunner.submit (JobRunner::ENCIPHER, TEST_PLAINTEXT, TEST_KEY, cancelledToken, [&progressCalls, &cancelledToken] (const unsigned long long, const unsigned long long) {
+
+		progressCalls++;
+		cancelledToken.cancel ();
+
+	}).get ();
+
+	if (!result.isCancelled || !result.output.empty () || progressCalls != 1) {
+
+		testResult = "Failed to cancel a job.";
+
+	}
+
+	if (!jobRunner.submit (JobRunner::CRACK, ciphertext, 0, cancelledToken, JobRunner::ProgressCallback ()).get ().isCancelled) {
+
+		testResult = "Failed to cancel a job before it started.";
+
+	}
+
+	// A throwing callback fails its own job, and only its own job.
+	try {
+
+		jobRunner.submit (JobRunner::DECIPHER, ciphertext, TEST_KEY, token, [] (const unsigned long long, const unsigned long long) {
+
+			throw std::runtime_error ("Test exception.");
+
+		}).get ();
+
+		testResult = "Failed to pass an exception to a job's future.";
+
+	} catch (const std::runtime_error&) {
+
+		// Expected.
+
+	}
+
+	pool.wait ();
+
+	return testResult;
+
+}
+
+//****************************************************************************
+std::string autotunerUnitTests () {
+
+	const std::string TEST_FILENAME = "CCUtilAutotunerTest.tmp";
+	const std::size_t TEST_SAMPLE_SIZE = 1 << 16;
+	const unsigned int TEST_KEY = 7;
+	const SubstitutionCipher::TranslationKernel previousTranslationKernel = SubstitutionCipher::getTranslationKernel ();
+	const CaesarCipher::CountingKernel previousCountingKernel = CaesarCipher::getCountingKernel ();
+	const Autotuner::Profile previousProfile = tuningProfile;
+	const SubstitutionCipher::TranslationKernel translationKernels[] = { SubstitutionCipher::SCALAR_TRANSLATION, SubstitutionCipher::SSSE3_TRANSLATION, SubstitutionCipher::AVX512_TRANSLATION };
+	std::string text;
+	std::string expected;
+	std::string contents;
+	unsigned long long size = 0;
+	unsigned int simpleCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int interleavedCounts[CaesarCipher::ALPHABET_LENGTH];
+	Autotuner::Profile profile;
+	Autotuner::Profile loadedProfile;
+	std::string testResult = "All autotuner unit tests passed.";
+
+	// Every byte value, in runs long enough to reach each kernel's wide path
+	// and with a ragged tail for its scalar one.
+	for (unsigned int i = 0; i < 1000; i++) {
+
+		text += static_cast<char> ((i * 37) & 0xFF);
+
+	}
+
+	SubstitutionCipher::setTranslationKernel (SubstitutionCipher::SCALAR_TRANSLATION);
+	expected = CaesarCipher::encipher (text, TEST_KEY);
+
+	for (const SubstitutionCipher::TranslationKernel kernel : translationKernels) {
+
+		if (SubstitutionCipher::setTranslationKernel (kernel) != SubstitutionCipher::isTranslationKernelSupported (kernel)) {
+
+			testResult = "Failed to refuse an unsupported translation kernel.";
+
+		} else if (SubstitutionCipher::getTranslationKernel () == kernel && CaesarCipher::encipher (text, TEST_KEY) != expected) {
+
+			testResult = "Failed to encipher the same with every translation kernel.";
+
+		}
+
+	}
+
+	CaesarCipher::setCountingKernel (CaesarCipher::SIMPLE_COUNTING);
+	CaesarCipher::countLetters (text.data (), text.length (), simpleCounts);
+	CaesarCipher::setCountingKernel (CaesarCipher::INTERLEAVED_COUNTING);
+	CaesarCipher::countLetters (text.data (), text.length (), interleavedCounts);
+
+	if (memcmp (simpleCounts, interleavedCounts, sizeof (simpleCounts)) != 0) {
+
+		testResult = "Failed to count the same with every counting kernel.";
+
+	}
+
+	SubstitutionCipher::setTranslationKernel (previousTranslationKernel);
+	CaesarCipher::setCountingKernel (previousCountingKernel);
 
-		if (!saveFile (outputFile, output)) {
+	profile = Autotuner::calibrate (TEST_SAMPLE_SIZE);
 
-			printFileSavingError (outputFile);
-			return false;
+	if (!SubstitutionCipher::isTranslationKernelSupported (profile.translationKernel) || profile.threadCount == 0 || profile.chunkSize == 0 ||
+		SubstitutionCipher::getTranslationKernel () != previousTranslationKernel || CaesarCipher::getCountingKernel () != previousCountingKernel) {
 
-		}
+		testResult = "Failed to calibrate.";
 
 	}
 
-	return true;
+	if (!Autotuner::save (profile, TEST_FILENAME) || !Autotuner::load (TEST_FILENAME, loadedProfile) || loadedProfile.translationKernel != profile.translationKernel ||
+		loadedProfile.countingKernel != profile.countingKernel || loadedProfile.threadCount != profile.threadCount || loadedProfile.chunkSize != profile.chunkSize ||
+		loadedProfile.parallelThreshold != profile.parallelThreshold) {
 
-}
+		testResult = "Failed to save and load a profile.";
 
-//****************************************************************************
-bool parseCStringAsKey (const char* const cString, unsigned int& key) {
+	}
 
-	int rawInt = 0;
+	// A flipped byte fails the checksum, and a missing file fails to load.
+	if (FileSystem::getFileSize (TEST_FILENAME, size) && FileSystem::readFileRange (TEST_FILENAME, 0, size, contents) && !contents.empty ()) {
 
-	try {
+		contents[contents.length () / 2] ^= 0x01;
+		FileSystem::writeFile (TEST_FILENAME, contents);
 
-		rawInt = std::stoi (cString);
-		
-		if (rawInt < 0) {
+		if (Autotuner::load (TEST_FILENAME, loadedProfile)) {
 
-			return false;
+			testResult = "Failed to reject a corrupt profile.";
 
 		}
 
-		// Though not necessary, wrapping the key to the proper domain
-		// is good practice.
-		key = rawInt % CaesarCipher::getAlphabetLength ();
-		return true;
+	}
 
-	} catch (...) {
+	FileSystem::removeFile (TEST_FILENAME);
 
-		return false;
+	if (Autotuner::load (TEST_FILENAME, loadedProfile)) {
+
+		testResult = "Failed to reject a missing profile.";
 
 	}
 
-	return false;
+	// Inputs below the threshold stay on one thread, and larger inputs split
+	// over threads encipher and decipher as they would on one.
+	profile.threadCount = 4;
+	profile.chunkSize = 64;
+	profile.parallelThreshold = 256;
 
-}
+	if (Autotuner::getThreadCount (profile, 255) != 1 || Autotuner::getThreadCount (profile, 256) != 4) {
 
-//****************************************************************************
-void printFileLoadingError (const std::string& filename) {
+		testResult = "Failed to choose a thread count by input size.";
 
-	std::cout << "Failed to load file \"" << filename << "\"." << std::endl;
+	}
 
-}
+	tuningProfile = profile;
 
-//****************************************************************************
-void printFileSavingError (const std::string& filename) {
+	if (encipherInParallel (text, TEST_KEY) != expected || encipherInParallel (expected, CaesarCipher::ALPHABET_LENGTH - TEST_KEY) != text) {
 
-	std::cout << "Failed to save to file \"" << filename << "\"." << std::endl;
+		testResult = "Failed to encipher over several threads.";
 
-}
+	}
 
-//****************************************************************************
-void printUsageError (void) {
+	tuningProfile = previousProfile;
 
-	std::cout << "Invalid arguments. For usage help, type: CCUtil -" << HELP_ARG << std::endl;
+	return testResult;
 
 }
 
 //****************************************************************************
-void printHelp (void) {
+std::string ngramProfileUnitTests () {
+
+	const std::string TEST_CORPUS = "It was a bright cold day in April, and the clocks were striking thirteen. The hallway smelt of boiled cabbage and old rag mats. "
+									"At one end of it a coloured poster, too large for indoor display, had been tacked to the wall. It depicted simply an enormous face, "
+									"more than a metre wide: the face of a man of about forty-five, with a heavy black moustache and ruggedly handsome features. ";
+	const std::string TEST_MESSAGE = "a heavy face";
+	const std::string TEST_FILENAME = "CCUtilUnitTestNgrams.bin";
+	const unsigned int TEST_KEY = 19;
+	const std::string ciphertext = CaesarCipher::encipher (TEST_MESSAGE, TEST_KEY);
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	const unsigned int letterCount = CaesarCipher::countLetters (TEST_CORPUS, letterCounts);
+	WorkStealingPool singlePool (1);
+	WorkStealingPool pool (3);
+	const std::string trained = NgramProfile::train (TEST_CORPUS.data (), TEST_CORPUS.length (), singlePool);
+	std::string corrupted = trained;
+	NgramProfile profile;
+	NgramProfile openedProfile;
+	unsigned int rankedKeys[CaesarCipher::ALPHABET_LENGTH];
+	double rankedScores[CaesarCipher::ALPHABET_LENGTH];
+	std::string testResult = "All n-gram profile unit tests passed.";
+
+	// Spans count the n-grams across their boundaries exactly once, so any
+	// number of threads trains the same profile.
+	if (NgramProfile::train (TEST_CORPUS.data (), TEST_CORPUS.length (), pool) != trained) {
+
+		testResult = "Failed to train the same profile on several threads.";
 
-	std::cout << "To encipher, type:\t\t\tCCUtil -" << ENCIPHER_ARG << " KEY" << std::endl
-			  << "To decipher, type:\t\t\tCCUtil -" << DECIPHER_ARG << " KEY" << std::endl
-			  << "To crack key, type:\t\t\tCCUtil -" << CRACK_ARG << std::endl
-			  << "To brute force, type:\t\t\tCCUtil -" << BRUTE_FORCE_ARG << std::endl
-			  << "To get help, type:\t\t\tCCUtil -" << HELP_ARG << std::endl
-			  << "To specify input text, append:\t\t-" << INPUT_TEXT_ARG << " \"TEXT\"" << std::endl
-			  << "To specify input file, append:\t\t-" << INPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
-			  << "To specify output file, append:\t\t-" << OUTPUT_FILENAME_ARG << " \"FILENAME\"" << std::endl
-			  << "Note: KEY must be a positive integer and text/filenames should be in quotes." << std::endl;
+	}
 
-}
+	if (!profile.load (trained) || profile.getLetterCount () != letterCount) {
 
-//****************************************************************************
-std::string encipherAndPrint (const std::string& plaintext, const unsigned int key) {
+		testResult = "Failed to load a trained profile.";
 
-	std::string ciphertext;
+	}
 
-	ciphertext = CaesarCipher::encipher (plaintext, key);
+	profile.rankKeys (ciphertext.data (), ciphertext.length (), rankedKeys, rankedScores);
 
-	std::cout << "Plaintext:\t" << plaintext << std::endl
-			  << "Ciphertext:\t" << ciphertext << std::endl
-			  << "Key:\t\t" << key << std::endl;
+	if (rankedKeys[0] != TEST_KEY || rankedScores[0] != profile.scoreKey (ciphertext.data (), ciphertext.length (), TEST_KEY) || rankedScores[0] > rankedScores[1]) {
 
-	return ciphertext;
+		testResult = "Failed to rank the keys of a short message.";
 
-}
+	}
 
-//****************************************************************************
-std::string decipherAndPrint (const std::string& ciphertext, const unsigned int key) {
+	if (profile.scoreKey ("1, 2, 3!", 8, 0) != 0.0) {
 
-	std::string plaintext;
+		testResult = "Failed to score a text without letters.";
 
-	plaintext = CaesarCipher::decipher (ciphertext, key);
+	}
 
-	std::cout << "Ciphertext:\t" << ciphertext << std::endl
-			  << "Plaintext:\t" << plaintext << std::endl
-			  << "Key:\t\t" << key << std::endl;
+	corrupted[corrupted.length () / 2] ^= 0x01;
 
-	return plaintext;
+	if (profile.load (corrupted) || profile.load (trained.substr (0, trained.length () - 1))) {
+
+		testResult = "Failed to reject a corrupt profile.";
+
+	}
+
+	if (!FileSystem::writeFile (TEST_FILENAME, trained) || !openedProfile.open (TEST_FILENAME) || openedProfile.getLetterCount () != letterCount ||
+		openedProfile.scoreKey (ciphertext.data (), ciphertext.length (), TEST_KEY) != rankedScores[0]) {
+
+		testResult = "Failed to open a profile file.";
+
+	}
+
+	openedProfile.open (std::string ());
+	FileSystem::removeFile (TEST_FILENAME);
+
+	return testResult;
 
 }
 
 //****************************************************************************
-std::string crackAndPrint (const std::string& ciphertext) {
+std::string deduplicatorUnitTests () {
 
-	unsigned int estimatedKey = 0;
-	std::string plaintext;
+	const std::string TEST_PLAINTEXT = "Meet me by the old mill at Midnight.";
+	const std::string TEST_OTHER_PLAINTEXT = "Meet me by the old mill at noon.";
+	const std::string TEST_DIRECTORY = "CCUtilUnitTestDuplicates";
+	const unsigned int TEST_KEYS[] = { 0, 5, 13, 25 };
+	const std::string TEST_UNREADABLE_FILENAME = "missing.txt";
+	std::vector<std::string> relativePaths;
+	std::vector<Deduplicator::Fingerprint> fingerprints;
+	std::vector<std::size_t> representatives;
+	Deduplicator::Fingerprint first;
+	Deduplicator::Fingerprint second;
+	WorkStealingPool pool (2);
+	std::string testResult = "All deduplicator unit tests passed.";
 
-	try {
+	// Encipherments of one plaintext collide, whatever the keys.
+	first = Deduplicator::fingerprint (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length ());
+	second = Deduplicator::fingerprint (CaesarCipher::encipher (TEST_PLAINTEXT, 9).data (), TEST_PLAINTEXT.length ());
 
-		estimatedKey = CaesarCipher::crackKey (ciphertext);
+	if (first.hash != second.hash || Deduplicator::propagateKey (first, 0, second) != 9 || Deduplicator::propagateKey (second, 9, first) != 0) {
 
-	} catch (const std::logic_error& e) {
+		testResult = "Failed to fingerprint a text regardless of its key.";
 
-		// While it is technically possible for any std::logic_error to be caught here,
-		// it is highly likely that the exception is for an invalid alphabet frequency
-		// and even if it wasn't, there is no reason to report it to the user.
-		std::cout << "Internal Error: " << e.what () << std::endl << "Please report this error to the supplier of this utility." << std::endl;
-		return "Internal Error. " + std::string (e.what ()) + "Please report this error to the supplier of this utility.";
+	}
+
+	second = Deduplicator::fingerprint (TEST_OTHER_PLAINTEXT.data (), TEST_OTHER_PLAINTEXT.length ());
+
+	if (first.hash == second.hash || Deduplicator::fingerprint ("1, 2!", 5).rotation != 0) {
+
+		testResult = "Failed to tell different texts apart.";
 
 	}
 
-	plaintext = CaesarCipher::decipher (ciphertext, estimatedKey);
+	FileSystem::makeDirectories (TEST_DIRECTORY);
 
-	std::cout << "Ciphertext:\t\t" << ciphertext << std::endl
-			  << "Most Likely Plaintext:\t" << plaintext << std::endl
-			  << "Estimated Key:\t\t" << estimatedKey << std::endl
-			  << "If the plaintext does not look correct, try a brute force crack (-" << BRUTE_FORCE_ARG << ") of all possible translations." << std::endl;
+	for (unsigned int i = 0; i < sizeof (TEST_KEYS) / sizeof (TEST_KEYS[0]); i++) {
 
-	return plaintext;
+		relativePaths.push_back ("copy" + std::string (1, static_cast<char> ('a' + i)) + ".txt");
+		FileSystem::writeFile (FileSystem::joinPath (TEST_DIRECTORY, relativePaths.back ()), CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEYS[i]));
 
-}
+	}
 
-//****************************************************************************
-std::string bruteForceAndPrint (const std::string& ciphertext) {
+	relativePaths.push_back ("other.txt");
+	FileSystem::writeFile (FileSystem::joinPath (TEST_DIRECTORY, relativePaths.back ()), CaesarCipher::encipher (TEST_OTHER_PLAINTEXT, 3));
+	relativePaths.push_back (TEST_UNREADABLE_FILENAME);
 
-	std::string plaintext;
-	std::string output;
-	output.reserve (ciphertext.length () * CaesarCipher::getAlphabetLength ());
-	plaintext.reserve (ciphertext.length ());
+	Deduplicator::fingerprintFiles (TEST_DIRECTORY, relativePaths, pool, fingerprints);
 
-	std::cout << "Key\tPlaintext" << std::endl;
+	// Four copies, one other message and one unreadable file.
+	if (Deduplicator::groupDuplicates (fingerprints, representatives) != 3 || representatives[3] != 0 || representatives[4] != 4 || representatives[5] != 5 || fingerprints[5].isReadable) {
 
-	for (unsigned int key = 0; key < CaesarCipher::getAlphabetLength (); key++) {
+		testResult = "Failed to group duplicate files.";
 
-		plaintext = CaesarCipher::decipher (ciphertext, key);
+	}
 
-		// A width of 3 is used to pad the key value out to the end of the column
-		// under the word "Key" in the header.
-		std::cout << std::setw (3) << key << '\t' << plaintext << std::endl;
-		output += plaintext + '\n';
+	for (unsigned int i = 1; i < sizeof (TEST_KEYS) / sizeof (TEST_KEYS[0]); i++) {
+
+		if (Deduplicator::propagateKey (fingerprints[0], TEST_KEYS[0], fingerprints[i]) != TEST_KEYS[i]) {
+
+			testResult = "Failed to propagate a key to a duplicate.";
+
+		}
 
 	}
 
-	std::cout << "If multiple keys generate plausible plaintext try cracking the key (-" << CRACK_ARG << ") to see the most statistically likely translation." << std::endl;
-	return output;
+	for (unsigned int i = 0; i + 1 < relativePaths.size (); i++) {
+
+		FileSystem::removeFile (FileSystem::joinPath (TEST_DIRECTORY, relativePaths[i]));
+
+	}
+
+	FileSystem::removeDirectory (TEST_DIRECTORY);
+
+	return testResult;
 
 }
 
 //****************************************************************************
-bool loadFileContents (const std::string& filename, std::string& outputString) {
+std::string keyClustererUnitTests () {
+
+	const std::string TEST_PLAINTEXT = "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, it was the epoch of belief, "
+									   "it was the epoch of incredulity, it was the season of Light, it was the season of Darkness, it was the spring of hope, it was the winter "
+									   "of despair. It was a bright cold day in April, and the clocks were striking thirteen. The hallway smelt of boiled cabbage and old rag mats. "
+									   "At one end of it a coloured poster, too large for indoor display, had been tacked to the wall. It depicted simply an enormous face, "
+									   "more than a metre wide: the face of a man of about forty-five, with a heavy black moustache and ruggedly handsome features. ";
+	const unsigned int TEST_KEYS[] = { 3, 17, 8 };
+	const std::size_t KEY_COUNT = sizeof (TEST_KEYS) / sizeof (TEST_KEYS[0]);
+	const std::size_t MESSAGE_LENGTH = 16;
+	std::vector<unsigned int> messageKeys;
+	std::vector<std::size_t> lineStarts;
+	std::vector<KeyClusterer::Histogram> histograms;
+	std::vector<KeyClusterer::Cluster> clusters;
+	std::vector<unsigned int> assignments;
+	std::size_t clusteredCorrect = 0;
+	std::size_t crackedCorrect = 0;
+	unsigned int counts[CaesarCipher::ALPHABET_LENGTH] = {};
+	unsigned int shiftedCounts[CaesarCipher::ALPHABET_LENGTH];
+	double similarities[CaesarCipher::ALPHABET_LENGTH];
+	std::string messages;
+	WorkStealingPool pool (2);
+	std::string testResult = "All key clusterer unit tests passed.";
+
+	// A histogram lines up with itself rotated by a key at that shift.
+	CaesarCipher::countLetters (TEST_PLAINTEXT, counts);
+	CaesarCipher::countLetters (CaesarCipher::encipher (TEST_PLAINTEXT, 5), shiftedCounts);
+	KeyClusterer::scoreShifts (counts, shiftedCounts, similarities);
+
+	if (std::max_element (similarities, similarities + CaesarCipher::ALPHABET_LENGTH) != similarities + 5 || std::fabs (similarities[5] - 1.0) > 1e-9) {
+
+		testResult = "Failed to line up rotated histograms.";
 
-	std::ifstream inputStream;
+	}
 
-	try {
+	for (std::size_t start = 0; start + MESSAGE_LENGTH <= TEST_PLAINTEXT.length (); start += MESSAGE_LENGTH) {
 
-		inputStream.open (filename);
+		messageKeys.push_back (TEST_KEYS[messageKeys.size () % KEY_COUNT]);
+		messages += CaesarCipher::encipher (TEST_PLAINTEXT.substr (start, MESSAGE_LENGTH), messageKeys.back ()) + '\n';
 
-		outputString.clear ();
+	}
 
-		if (!inputStream.good ()) {
+	messages += "1, 2!";
 
-			inputStream.close ();
-			return false;
+	KeyClusterer::countLines (messages, pool, lineStarts, histograms);
 
-		}
+	if (histograms.size () != messageKeys.size () + 1 || histograms.back ().letterTotal != 0 || lineStarts[1] != MESSAGE_LENGTH + 1) {
 
-		while (inputStream.good ()) {
+		testResult = "Failed to count the letters of each line.";
 
-			// This is pretty inefficient; however, the goal of this program
-			// is not to process large files but rather simple strings so
-			// this is a case of not overdesigning for the intended purpose.
-			outputString += inputStream.get ();
+	}
 
-		}
+	KeyClusterer::cluster (histograms, pool, clusters, assignments);
 
-		inputStream.close ();
-		return true;
+	for (std::size_t i = 0; i < messageKeys.size () && i < assignments.size (); i++) {
 
-	} catch (...) {
+		if (assignments[i] != KeyClusterer::UNCLUSTERED && clusters[assignments[i]].key == messageKeys[i]) {
 
-		try {
+			clusteredCorrect++;
 
-			inputStream.close ();
+		}
 
-		} catch (...) {
+		if (CaesarCipher::crackKey (histograms[i].letterCounts) == messageKeys[i]) {
 
-			return false;
+			crackedCorrect++;
 
 		}
 
-		return false;
+	}
+
+	// Pooling lets messages far too short to crack alone share their letters.
+	if (clusters.size () != KEY_COUNT || assignments.back () != KeyClusterer::UNCLUSTERED || clusteredCorrect <= crackedCorrect || clusteredCorrect * 10 < messageKeys.size () * 9) {
+
+		testResult = "Failed to crack short messages by clustering their keys.";
 
 	}
 
-	return false;
+	return testResult;
 
 }
 
 //****************************************************************************
-bool saveFile (const std::string& filename, const std::string& contents) {
+std::string proseFilterUnitTests () {
+
+	const std::string TEST_PROSE = "Meet me at the old mill at midnight, and bring the map.";
+	const std::string TEST_TEXT = "Meet me at the old mill https://example.com/a/b at midnight, 3f9a0c7be21d44aa and bring aGVsbG8gd29ybGQ= the readConfig_value map. \x01Qx\x02";
+	const unsigned long long TEST_CLASS_BYTES[ProseFilter::CLASS_COUNT] = { 44, 23, 32, 16, 4 };
+	const std::string TEST_PLAIN_WORDS[3] = { "x", "hello world\n", "Khoor zruog, wklv lv d whvw phvvdjh" };
+	const unsigned long long TEST_PLAIN_WORD_BYTES[3] = { 1, 10, 29 };
+	unsigned int expectedCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int shiftedCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned long long classBytes[ProseFilter::CLASS_COUNT];
+	unsigned long long shiftedClassBytes[ProseFilter::CLASS_COUNT];
+	std::string paddedText;
+	std::string testResult = "All prose filter unit tests passed.";
+
+	// Only the letters of the prose count.
+	if (ProseFilter::countProseLetters (TEST_TEXT, letterCounts, classBytes) != CaesarCipher::countLetters (TEST_PROSE, expectedCounts) ||
+		memcmp (letterCounts, expectedCounts, sizeof (letterCounts)) != 0 || memcmp (classBytes, TEST_CLASS_BYTES, sizeof (classBytes)) != 0) {
+
+		testResult = "Failed to filter the prose from a text.";
 
-	std::ofstream outputStream;
+	}
 
-	try {
+	// Classes depend on the kinds of characters alone, never on the key.
+	ProseFilter::countProseLetters (CaesarCipher::encipher (TEST_TEXT, 11), shiftedCounts, shiftedClassBytes);
 
-		outputStream.open (filename);
+	if (memcmp (classBytes, shiftedClassBytes, sizeof (classBytes)) != 0 || CaesarCipher::crackKey (shiftedCounts) != (CaesarCipher::crackKey (letterCounts) + 11) % CaesarCipher::ALPHABET_LENGTH) {
 
-		if (outputStream.good ()) {
+		testResult = "Failed to filter prose regardless of its key.";
 
-			outputStream << contents;
+	}
 
-		} else {
+	// Tokens straddle 64 byte blocks differently at every offset.
+	for (unsigned int i = 1; i < 64; i++) {
 
-			outputStream.close ();
-			return false;
+		paddedText = std::string (i, ' ') + TEST_TEXT + ' ' + TEST_TEXT;
+		ProseFilter::countProseLetters (paddedText, shiftedCounts, shiftedClassBytes);
 
-		}
+		for (unsigned int j = 0; j < ProseFilter::CLASS_COUNT; j++) {
 
-		outputStream.close ();
-		return true;
+			if (shiftedClassBytes[j] != classBytes[j] * 2) {
 
-	} catch (...) {
+				testResult = "Failed to filter prose across blocks.";
 
-		try {
+			}
 
-			outputStream.close ();
+		}
 
-		} catch (...) {
+	}
 
-			return false;
+	// Words that start a block of plain words, with nothing before them.
+	for (unsigned int i = 0; i < 3; i++) {
 
-		}
+		ProseFilter::countProseLetters (TEST_PLAIN_WORDS[i], letterCounts, classBytes);
 
-		return false;
+		if (classBytes[ProseFilter::PROSE] != TEST_PLAIN_WORD_BYTES[i]) {
+
+			testResult = "Failed to count the prose at the start of a block.";
+
+		}
 
 	}
 
-	return false;
+	return testResult;
 
 }
 
 //****************************************************************************
-std::string caesarCipherUnitTests () {
+std::string affineCipherUnitTests () {
+
+	const std::string TEST_PLAINTEXT = "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, it was the epoch of belief, "
+									   "it was the epoch of incredulity, it was the season of Light, it was the season of Darkness, it was the spring of hope, it was the winter "
+									   "of despair. It was a bright cold day in April, and the clocks were striking thirteen.";
+	const std::string TEST_SHORT_PLAINTEXT = "Affine Cipher!";
+	const std::string TEST_SHORT_CIPHERTEXT = "Ihhwvc Swfrcp!";
+	const AffineCipher::Key TEST_KEY = { 5, 8 };
+	const AffineCipher::Key TEST_INVALID_KEY = { 13, 2 };
+	AffineCipher::Key key;
+	AffineCipher::Key rankedKeys[AffineCipher::KEY_COUNT];
+	double rankedScores[AffineCipher::KEY_COUNT];
+	double chiSquaredSums[AffineCipher::KEY_COUNT];
+	double caesarSums[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	std::string ciphertext;
+	std::string testResult = "All affine cipher unit tests passed.";
 
-	// I would have used "Hello World!" however that phrase is not statistically
-	// common and does not result in finding the correct key when cracking. This
-	// phrase is more common and results in the correct key.
-	const std::string TEST_PLAINTEXT = "attack at Dawn!";
-	const std::string TEST_CIPHERTEXT = "leelnv le Olhy!";
-	const std::string EMPTY_TEXT = "";
-	const unsigned int TEST_KEY = 11;
-	const unsigned int TEST_KEY_LONG = 271;
+	if (AffineCipher::encipher (TEST_SHORT_PLAINTEXT, TEST_KEY) != TEST_SHORT_CIPHERTEXT || AffineCipher::decipher (TEST_SHORT_CIPHERTEXT, TEST_KEY) != TEST_SHORT_PLAINTEXT) {
 
-	if (CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY) != TEST_CIPHERTEXT) {
+		testResult = "Failed to encipher or decipher with an affine key.";
 
-		return "Failed to encipher string.";
+	}
+
+	// Every key deciphers what it enciphers, and a multiplier of 1 is a
+	// Caesar cipher.
+	for (unsigned int i = 0; i < AffineCipher::KEY_COUNT; i++) {
+
+		key = AffineCipher::getKey (i);
+		ciphertext = AffineCipher::encipher (TEST_SHORT_PLAINTEXT, key);
+
+		if (AffineCipher::decipher (ciphertext, key) != TEST_SHORT_PLAINTEXT || (key.multiplier == 1 && ciphertext != CaesarCipher::encipher (TEST_SHORT_PLAINTEXT, key.shift))) {
+
+			testResult = "Failed to round trip every affine key.";
+
+		}
 
 	}
 
-	if (CaesarCipher::decipher (TEST_CIPHERTEXT, TEST_KEY) != TEST_PLAINTEXT) {
+	try {
 
-		return "Failed to decipher string.";
+		AffineCipher::encipher (TEST_SHORT_PLAINTEXT, TEST_INVALID_KEY);
+		testResult = "Failed to refuse an affine key that cannot be deciphered.";
+
+	} catch (const std::logic_error&) {
+
+		// Expected.
 
 	}
 
-	if (CaesarCipher::crackKey (TEST_CIPHERTEXT) != TEST_KEY) {
+	// Permuting the histogram leaves the Caesar keys scored as before.
+	CaesarCipher::countLetters (TEST_PLAINTEXT, letterCounts);
+	CaesarCipher::scoreKeys (letterCounts, caesarSums);
+	AffineCipher::scoreKeys (letterCounts, chiSquaredSums);
 
-		return "Failed to determine key.";
+	if (memcmp (caesarSums, chiSquaredSums, sizeof (caesarSums)) != 0) {
+
+		testResult = "Failed to score Caesar keys as affine keys.";
 
 	}
 
-	if (CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEY_LONG) != TEST_CIPHERTEXT) {
+	ciphertext = AffineCipher::encipher (TEST_PLAINTEXT, TEST_KEY);
+	CaesarCipher::countLetters (ciphertext, letterCounts);
+	AffineCipher::rankKeys (letterCounts, rankedKeys, rankedScores);
+	key = AffineCipher::crackKey (ciphertext);
 
-		return "Failed to encipher string with long key.";
+	if (rankedKeys[0].multiplier != TEST_KEY.multiplier || rankedKeys[0].shift != TEST_KEY.shift || key.multiplier != TEST_KEY.multiplier || key.shift != TEST_KEY.shift ||
+		!std::is_sorted (rankedScores, rankedScores + AffineCipher::KEY_COUNT)) {
+
+		testResult = "Failed to crack an affine key.";
 
 	}
 
-	if (CaesarCipher::decipher (TEST_CIPHERTEXT, TEST_KEY_LONG) != TEST_PLAINTEXT) {
+	return testResult;
 
-		std::cout << CaesarCipher::decipher (TEST_CIPHERTEXT, TEST_KEY_LONG) << std::endl;
+}
 
-		return "Failed to decipher string with long key.";
+//****************************************************************************
+std::string keyFanOutUnitTests () {
+
+	const std::string TEST_PLAINTEXT = "Attack at dawn, and hold the bridge until noon!";
+	const std::string TEST_DIRECTORY = "CCUtilUnitTestFanOut";
+	const std::vector<unsigned int> TEST_KEYS = { 0, 3, 25 };
+	const std::vector<unsigned int> TEST_LISTED_KEYS = { 3, 24, 25, 0 };
+	const std::size_t TEST_CHUNK_SIZE = 7;
+	std::vector<unsigned int> keys;
+	std::vector<std::string> filenames;
+	unsigned long long size = 0;
+	std::string contents;
+	WorkStealingPool pool (2);
+	std::string testResult = "All key fan out unit tests passed.";
+
+	// Keys repeated, or wrapped around the alphabet, are listed once.
+	if (!parseCStringAsKeyList ("3,29,24-26", keys) || keys != TEST_LISTED_KEYS || parseCStringAsKeyList ("3,,4", keys) || parseCStringAsKeyList ("5-2", keys) || parseCStringAsKeyList ("-1", keys)) {
+
+		testResult = "Failed to parse a list of keys.";
 
 	}
 
-	if (CaesarCipher::crackKey (TEST_CIPHERTEXT) != TEST_KEY) {
+	FileSystem::makeDirectories (TEST_DIRECTORY);
 
-		return "Failed to determine long key.";
+	for (const unsigned int key : TEST_KEYS) {
+
+		filenames.push_back (FileSystem::joinPath (TEST_DIRECTORY, KeyFanOut::getOutputName (key)));
 
 	}
 
-	if (CaesarCipher::encipher (EMPTY_TEXT, TEST_KEY) != EMPTY_TEXT) {
+	// A chunk shorter than the text sweeps it in several steps.
+	if (!KeyFanOut::encipher (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length (), TEST_KEYS, filenames, TEST_CHUNK_SIZE, pool)) {
 
-		return "Failed to encipher empty string.";
+		testResult = "Failed to fan out a text to every key.";
 
 	}
 
-	if (CaesarCipher::decipher (EMPTY_TEXT, TEST_KEY) != EMPTY_TEXT) {
+	for (std::size_t i = 0; i < TEST_KEYS.size (); i++) {
 
-		return "Failed to decipher empty string.";
+		if (!FileSystem::getFileSize (filenames[i], size) || size != TEST_PLAINTEXT.length () || !FileSystem::readFileRange (filenames[i], 0, size, contents) ||
+			contents != CaesarCipher::encipher (TEST_PLAINTEXT, TEST_KEYS[i])) {
+
+			testResult = "Failed to encipher a text under every key.";
+
+		}
+
+		FileSystem::removeFile (filenames[i]);
 
 	}
 
-	if (CaesarCipher::crackKey (EMPTY_TEXT) != 0) {
+	FileSystem::removeDirectory (TEST_DIRECTORY);
 
-		return "Failed to determine key from empty string.";
+	if (KeyFanOut::encipher (TEST_PLAINTEXT.data (), TEST_PLAINTEXT.length (), TEST_KEYS, std::vector<std::string> (TEST_KEYS.size (), FileSystem::joinPath (TEST_DIRECTORY, "missing.txt")), TEST_CHUNK_SIZE, pool)) {
+
+		testResult = "Failed to report an output that could not be written.";
 
 	}
 
-	return "All unit tests passed.";
+	return testResult;
+
+}
+
+#ifdef _DEBUG
+// Debug Allocation Hooks ****************************************************
+/**
+ * Counts every heap allocation so that unit tests can check that steady state
+ * record processing does not allocate.
+ * @param size of the allocation in bytes.
+ * @return the allocated memory.
+ * @throw bad_alloc if the memory could not be allocated.
+ */
+void* operator new (std::size_t size) {
+
+	void* memory = std::malloc (size == 0 ? 1 : size);
 
-}
\ No newline at end of file
+	if (memory == nullptr) {
+
+		throw std::bad_alloc ();
+
+	}
+
+	heapAllocationCount++;
+	return memory;
+
+}
+
+//****************************************************************************
+void operator delete (void* memory) noexcept {
+
+	std::free (memory);
+
+}
+
+//****************************************************************************
+void operator delete (void* memory, std::size_t) noexcept {
+
+	std::free (memory);
+
+}
+#endif
\ No newline at end of file
@@ -16,12 +16,18 @@
  *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
  */
 
+#include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include "CaesarCipher.h"
+#include "SubstitutionCipher.h"
+
+// Static Variables **********************************************************
+static std::atomic<int> selectedCountingKernel (CaesarCipher::SIMPLE_COUNTING);	/**< Counting kernel in use. */
 
 // Static Constant Definitions ***********************************************
 const double CaesarCipher::ALPHABET_FREQUENCIES[CaesarCipher::ALPHABET_LENGTH] = {
@@ -65,52 +71,45 @@ unsigned int CaesarCipher::getAlphabetLength (void) {
 }
 
 //****************************************************************************
-std::string CaesarCipher::encipher (const std::string& plaintext, const unsigned int key) {
+CaesarCipher::CountingKernel CaesarCipher::getCountingKernel (void) {
 
-	// This is the first character of lowercase ASCII.
-	const unsigned int ASCII_LOWERCASE = 97;
-
-	std::string ciphertext;
-	unsigned int adjustedKey = 0;
-	char uppercaseCharacter = '\0';
-	char encipheredCharacter = '\0';
+	return static_cast<CountingKernel> (selectedCountingKernel.load ());
 
-	// Adjust key to put it in range [0,ALPHABET_LENGTH].
-	adjustedKey = key % ALPHABET_LENGTH;
+}
 
-	// Reserve enough room for the message to avoid reallocation in the following loop.
-	ciphertext.reserve (plaintext.length ());
+//****************************************************************************
+void CaesarCipher::setCountingKernel (const CountingKernel kernel) {
 
-	for (const char character : plaintext) {
+	selectedCountingKernel = kernel;
 
-		uppercaseCharacter = toupper (character);
+}
 
-		if (uppercaseCharacter >= 65 && uppercaseCharacter <= 90) {
+//****************************************************************************
+std::string CaesarCipher::encipher (const std::string& plaintext, const unsigned int key) {
 
-			// This first shifts the character so A is 0. Next it adds the adjusted key
-			// and wraps the character back to A if it exceeds Z. Finally, the range
-			// is adjusted once more so that the character lines up with ASCII and is
-			// appended to the string.
-			encipheredCharacter = (((uppercaseCharacter - 65) + adjustedKey) % ALPHABET_LENGTH) + 65;
+	std::string ciphertext (plaintext.length (), '\0');
 
-			// Preserve case of original string by converting it back to lowercase if need be.
-			if (character >= ASCII_LOWERCASE) {
+	encipher (plaintext.data (), plaintext.length (), key, &ciphertext[0]);
 
-				encipheredCharacter = tolower (encipheredCharacter);
+	return ciphertext;
 
-			}
+}
 
-			ciphertext += encipheredCharacter;
+//****************************************************************************
+void CaesarCipher::encipher (const char* const plaintext, const std::size_t length, const unsigned int key, char* const ciphertext) {
 
-		} else {
+	char alphabet[ALPHABET_LENGTH];
 
-			ciphertext += character;
+	// A shift is a substitution by a rotated alphabet, which lets it share the
+	// substitution cipher's shuffle kernels. The alphabet is built here rather
+	// than with SubstitutionCipher::getCaesarAlphabet to avoid allocating.
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
 
-		}
+		alphabet[i] = static_cast<char> ('A' + (i + key % ALPHABET_LENGTH) % ALPHABET_LENGTH);
 
 	}
 
-	return ciphertext;
+	SubstitutionCipher::encipher (plaintext, length, alphabet, ciphertext);
 
 }
 
@@ -132,16 +131,59 @@ std::string CaesarCipher::decipher (const std::string& ciphertext, const unsigne
 
 }
 
+//****************************************************************************
+void CaesarCipher::decipher (const char* const ciphertext, const std::size_t length, const unsigned int key, char* const plaintext) {
+
+	encipher (ciphertext, length, ALPHABET_LENGTH - (key % ALPHABET_LENGTH), plaintext);
+
+}
+
 //****************************************************************************
 unsigned int CaesarCipher::crackKey (const std::string& ciphertext) {
 
-	double letterFrequencies[ALPHABET_LENGTH];
-	double currentChiSquaredRunningSum = 0.0;
+	unsigned int letterCounts[ALPHABET_LENGTH];
+
+	countLetters (ciphertext, letterCounts);
+
+	return crackKey (letterCounts);
+
+}
+
+//****************************************************************************
+unsigned int CaesarCipher::crackKey (const unsigned int letterCounts[ALPHABET_LENGTH]) {
+
+	double chiSquaredSums[ALPHABET_LENGTH];
 	double lowestChiSquaredSum = std::numeric_limits<double>::max ();
 	unsigned int shiftAmountOfLowestChiSquared = 0;
+
+	scoreKeys (letterCounts, chiSquaredSums);
+
+	for (unsigned int shiftAmount = 0; shiftAmount < ALPHABET_LENGTH; shiftAmount++) {
+
+		// The shift ammount with the lowest chi squared sum fits the
+		// expected alphabet frequencies best and is therefore more
+		// likely to resolve to the correct key.
+		if (chiSquaredSums[shiftAmount] < lowestChiSquaredSum) {
+
+			lowestChiSquaredSum = chiSquaredSums[shiftAmount];
+			shiftAmountOfLowestChiSquared = shiftAmount;
+
+		}
+
+	}
+
+	return shiftAmountOfLowestChiSquared;
+
+}
+
+//****************************************************************************
+void CaesarCipher::scoreKeys (const unsigned int letterCounts[ALPHABET_LENGTH], double chiSquaredSums[ALPHABET_LENGTH]) {
+
+	double letterFrequencies[ALPHABET_LENGTH];
+	double currentChiSquaredRunningSum = 0.0;
 	unsigned int adjustedIndex = 0;
 
-	computeLetterFrequencies (ciphertext, letterFrequencies);
+	computeLetterFrequencies (letterCounts, letterFrequencies);
 
 	// Try shifting the observed frequencies until they match up with the
 	// expected frequency the closest.
@@ -156,7 +198,6 @@ unsigned int CaesarCipher::crackKey (const std::string& ciphertext) {
 			if (ALPHABET_FREQUENCIES[i] == 0.0) {
 
 				throw std::logic_error ("Divide by Zero. CaesarCipher::ALPHABET_FREQUENCIES contains at least one frequency of \'0.0\'.");
-				return 0;
 
 			}
 
@@ -164,19 +205,47 @@ unsigned int CaesarCipher::crackKey (const std::string& ciphertext) {
 
 		}
 
-		// The shift ammount with the lowest chi squared sum fits the
-		// expected alphabet frequencies best and is therefore more
-		// likely to resolve to the correct key.
-		if (currentChiSquaredRunningSum < lowestChiSquaredSum) {
+		chiSquaredSums[shiftAmount] = currentChiSquaredRunningSum;
 
-			lowestChiSquaredSum = currentChiSquaredRunningSum;
-			shiftAmountOfLowestChiSquared = shiftAmount;
+	}
+
+}
+
+//****************************************************************************
+void CaesarCipher::rankKeys (const unsigned int letterCounts[ALPHABET_LENGTH], unsigned int rankedKeys[ALPHABET_LENGTH], double rankedScores[ALPHABET_LENGTH]) {
+
+	double chiSquaredSums[ALPHABET_LENGTH];
+
+	scoreKeys (letterCounts, chiSquaredSums);
+	rankScores (chiSquaredSums, ALPHABET_LENGTH, rankedKeys, rankedScores);
+
+}
+
+//****************************************************************************
+void CaesarCipher::rankScores (const double* const scores, const unsigned int count, unsigned int* const rankedIndices, double* const rankedScores) {
+
+	unsigned int position = 0;
+
+	// An insertion sort keeps the lowest index first among equal scores,
+	// matching crackKey, and unlike std::stable_sort never allocates a
+	// buffer, so keys can be ranked for every record of a batch.
+	for (unsigned int index = 0; index < count; index++) {
+
+		for (position = index; position > 0 && scores[rankedIndices[position - 1]] > scores[index]; position--) {
+
+			rankedIndices[position] = rankedIndices[position - 1];
 
 		}
 
+		rankedIndices[position] = index;
+
 	}
 
-	return shiftAmountOfLowestChiSquared;
+	for (unsigned int i = 0; i < count; i++) {
+
+		rankedScores[i] = scores[rankedIndices[i]];
+
+	}
 
 }
 
@@ -205,16 +274,29 @@ double CaesarCipher::computeChiSquared (const double observedValue, const double
 //****************************************************************************
 unsigned int CaesarCipher::countLetters (const std::string& ciphertext, unsigned int letterCounts[ALPHABET_LENGTH]) {
 
+	return countLetters (ciphertext.data (), ciphertext.length (), letterCounts);
+
+}
+
+//****************************************************************************
+unsigned int CaesarCipher::countLetters (const char* const ciphertext, const std::size_t length, unsigned int letterCounts[ALPHABET_LENGTH]) {
+
 	unsigned int totalLetters = 0;
 	unsigned int characterIndex = 0;
 	char uppercaseCharacter = '\0';
 
+	if (selectedCountingKernel == INTERLEAVED_COUNTING) {
+
+		return countLettersInterleaved (reinterpret_cast<const unsigned char*> (ciphertext), length, letterCounts);
+
+	}
+
 	// Clear the array of letter counts.
 	memset (letterCounts, 0, sizeof (unsigned int) * ALPHABET_LENGTH);
 
-	for (const char character : ciphertext) {
+	for (std::size_t i = 0; i < length; i++) {
 
-		uppercaseCharacter = toupper (character);
+		uppercaseCharacter = toupper (ciphertext[i]);
 
 		// Make sure that the given character is a letter before counting.
 		if (uppercaseCharacter >= 65 && uppercaseCharacter <= 90) {
@@ -234,12 +316,52 @@ unsigned int CaesarCipher::countLetters (const std::string& ciphertext, unsigned
 }
 
 //****************************************************************************
-void CaesarCipher::computeLetterFrequencies (const std::string& ciphertext, double letterFrequencies[ALPHABET_LENGTH]) {
+unsigned int CaesarCipher::countLettersInterleaved (const unsigned char* const text, const std::size_t length, unsigned int letterCounts[ALPHABET_LENGTH]) {
+
+	unsigned int counts[4][ALPHABET_LENGTH + 1] = {};
+	unsigned int totalLetters = 0;
+	unsigned int index = 0;
+	std::size_t i = 0;
+
+	for (; i + 4 <= length; i += 4) {
+
+		for (unsigned int lane = 0; lane < 4; lane++) {
+
+			index = getLetterIndex (text[i + lane]);
+			counts[lane][(index < ALPHABET_LENGTH) ? index : ALPHABET_LENGTH]++;
+
+		}
+
+	}
+
+	for (; i < length; i++) {
+
+		index = getLetterIndex (text[i]);
+		counts[0][(index < ALPHABET_LENGTH) ? index : ALPHABET_LENGTH]++;
+
+	}
+
+	for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+		letterCounts[letter] = counts[0][letter] + counts[1][letter] + counts[2][letter] + counts[3][letter];
+		totalLetters += letterCounts[letter];
+
+	}
+
+	return totalLetters;
+
+}
+
+//****************************************************************************
+void CaesarCipher::computeLetterFrequencies (const unsigned int letterCounts[ALPHABET_LENGTH], double letterFrequencies[ALPHABET_LENGTH]) {
 
-	unsigned int letterCounts[ALPHABET_LENGTH];
 	unsigned int numberOfLetters = 0;
 
-	numberOfLetters = countLetters (ciphertext, letterCounts);
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		numberOfLetters += letterCounts[i];
+
+	}
 
 	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
 
@@ -16,6 +16,7 @@
  *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
  */
 
+#include <cstddef>
 #include <string>
 
 #ifndef CAESAR_CIPHER_H
@@ -26,9 +27,24 @@
  */
 class CaesarCipher {
 
+public:
+	// Public Types **********************************************************
+	/**
+	 * Implementations of letter counting.
+	 */
+	enum CountingKernel {
+
+		SIMPLE_COUNTING,		/**< One count per letter, incremented in turn. */
+		INTERLEAVED_COUNTING	/**< Four sets of counts filled in rotation and summed at the end, so runs of one letter do not wait on each increment. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int	ALPHABET_LENGTH = 26;					/**< Number of letters in the alphabet. */
+	static const unsigned int	SCORING_MODEL_VERSION = 1;				/**< Version of the key scoring. Must be raised whenever scores could change, since they may be cached. */
+
 private:
 	// Private Static Constants **********************************************
-	static const unsigned int	ALPHABET_LENGTH = 26;					/**< Number of letters in the alphabet. */
 	static const double			ALPHABET_FREQUENCIES[ALPHABET_LENGTH];	/**< Frequencies each letter occurs in the alphabet. */
 
 public:
@@ -39,6 +55,19 @@ public:
 	 */
 	static unsigned int getAlphabetLength (void);
 
+	/**
+	 * Returns the counting kernel letter counts are made with.
+	 * @return the kernel in use.
+	 */
+	static CountingKernel getCountingKernel (void);
+
+	/**
+	 * Sets the counting kernel letter counts are made with from now on, on
+	 * every thread.
+	 * @param kernel to use.
+	 */
+	static void setCountingKernel (const CountingKernel kernel);
+
 	// Public Methods ********************************************************
 	/**
 	 * Enciphers the given plaintext using the given key.
@@ -48,6 +77,17 @@ public:
 	 */
 	static std::string encipher (const std::string& plaintext, const unsigned int key);
 
+	/**
+	 * Enciphers the given plaintext into a buffer supplied by the caller, so
+	 * that batches of messages need not allocate a string for each one.
+	 * @param plaintext to encipher.
+	 * @param length, number of characters in plaintext.
+	 * @param key to encipher plaintext with.
+	 * @param ciphertext, buffer of at least length characters to store the
+	 * ciphertext in. May be the same as plaintext.
+	 */
+	static void encipher (const char* const plaintext, const std::size_t length, const unsigned int key, char* const ciphertext);
+
 	/**
 	 * Deciphers the given ciphertext using the given key.
 	 * @param ciphertext to decipher.
@@ -56,6 +96,16 @@ public:
 	 */
 	static std::string decipher (const std::string& ciphertext, const unsigned int key);
 
+	/**
+	 * Deciphers the given ciphertext into a buffer supplied by the caller.
+	 * @param ciphertext to decipher.
+	 * @param length, number of characters in ciphertext.
+	 * @param key to decipher with. Note this is the same as the key used to encipher.
+	 * @param plaintext, buffer of at least length characters to store the
+	 * plaintext in. May be the same as ciphertext.
+	 */
+	static void decipher (const char* const ciphertext, const std::size_t length, const unsigned int key, char* const plaintext);
+
 	/**
 	 * Uses statistical analysis to determine the most-likely key used to encipher
 	 * the given ciphertext.
@@ -67,6 +117,81 @@ public:
 	 */
 	static unsigned int crackKey (const std::string& ciphertext);
 
+	/**
+	 * Uses statistical analysis to determine the most-likely key from letter
+	 * counts that have already been gathered, such as the merged counts of
+	 * several chunks of a large file.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @return the most-likely key used to encipher the counted ciphertext.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * a frequency of zero.
+	 */
+	static unsigned int crackKey (const unsigned int letterCounts[ALPHABET_LENGTH]);
+
+	/**
+	 * Scores every key against the given letter counts. Lower scores fit the
+	 * expected letter frequencies better.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @param chiSquaredSums, array to store the chi squared sum of each key in,
+	 * indexed by key.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * a frequency of zero.
+	 */
+	static void scoreKeys (const unsigned int letterCounts[ALPHABET_LENGTH], double chiSquaredSums[ALPHABET_LENGTH]);
+
+	/**
+	 * Orders every key from most to least likely for the given letter counts.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @param rankedKeys, array to store the keys in, most likely first.
+	 * @param rankedScores, array to store the chi squared sum of each ranked key in.
+	 * @throw logic_error if for some reason a letter in the alphabet has
+	 * a frequency of zero.
+	 */
+	static void rankKeys (const unsigned int letterCounts[ALPHABET_LENGTH], unsigned int rankedKeys[ALPHABET_LENGTH], double rankedScores[ALPHABET_LENGTH]);
+
+	/**
+	 * Orders scores from lowest to highest, keeping the lower index first
+	 * among equal scores, without allocating. Every key ranker shares it.
+	 * @param scores to order.
+	 * @param count, number of scores.
+	 * @param rankedIndices, array to store the index of each score in, lowest
+	 * score first.
+	 * @param rankedScores, array to store the ranked scores in.
+	 */
+	static void rankScores (const double* const scores, const unsigned int count, unsigned int* const rankedIndices, double* const rankedScores);
+
+	/**
+	 * Counts how many times each letter in the alphabet is used in the ciphertext
+	 * and stores the count in the given array.
+	 * @param ciphertext to analyze.
+	 * @param letterCounts, array to store letter counts in. Cleared automatically
+	 * at start of function call.
+	 * @return the total number of letters counted.
+	 */
+	static unsigned int countLetters (const std::string& ciphertext, unsigned int letterCounts[ALPHABET_LENGTH]);
+
+	/**
+	 * Counts how many times each letter in the alphabet is used in the given
+	 * characters and stores the count in the given array.
+	 * @param ciphertext to analyze.
+	 * @param length, number of characters in ciphertext.
+	 * @param letterCounts, array to store letter counts in. Cleared automatically
+	 * at start of function call.
+	 * @return the total number of letters counted.
+	 */
+	static unsigned int countLetters (const char* const ciphertext, const std::size_t length, unsigned int letterCounts[ALPHABET_LENGTH]);
+
+	/**
+	 * Finds where a character falls in the alphabet, ignoring its case. Every
+	 * module that tells letters apart from other characters does so through
+	 * this, so they all agree with countLetters. Inline, since it is called
+	 * once per character of every text.
+	 * @param character to look up.
+	 * @return the index of the letter, in [0,ALPHABET_LENGTH), or a value of
+	 * at least ALPHABET_LENGTH if the character is not a letter.
+	 */
+	static unsigned int getLetterIndex (const unsigned char character);
+
 private:
 	// Private Methods *******************************************************
 	/**
@@ -79,23 +204,24 @@ private:
 	static double computeChiSquared (const double observedValue, const double expectedValue);
 
 	/**
-	 * Counts how many times each letter in the alphabet is used in the ciphertext
-	 * and stores the count in the given array.
-	 * @param ciphertext to analyze.
-	 * @param letterCounts, array to store letter counts in. Cleared automatically
-	 * at start of function call.
+	 * Counts letters with the interleaved kernel. Setting the case bit of a
+	 * letter and subtracting 'a' yields its index in the alphabet; anything
+	 * else is counted in a spare slot that is thrown away.
+	 * @param text to analyze.
+	 * @param length, number of characters in text.
+	 * @param letterCounts, array to store letter counts in.
 	 * @return the total number of letters counted.
 	 */
-	static unsigned int countLetters (const std::string& ciphertext, unsigned int letterCounts[ALPHABET_LENGTH]);
+	static unsigned int countLettersInterleaved (const unsigned char* const text, const std::size_t length, unsigned int letterCounts[ALPHABET_LENGTH]);
 
 	/**
-	 * Determines the frequency at which each letter in the ciphertext is used
-	 * and stores the results in the given array.
-	 * @param ciphertext to analyze.
+	 * Determines the frequency at which each letter is used from the given
+	 * letter counts and stores the results in the given array.
+	 * @param letterCounts, number of times each letter occurs.
 	 * @param letterFrequencies, array to store letter frequencies. Cleared automatically
 	 * at the start of the function call.
 	 */
-	static void computeLetterFrequencies (const std::string& ciphertext, double letterFrequencies[ALPHABET_LENGTH]);
+	static void computeLetterFrequencies (const unsigned int letterCounts[ALPHABET_LENGTH], double letterFrequencies[ALPHABET_LENGTH]);
 
 	// Private Ctors *********************************************************
 	/**
@@ -119,4 +245,13 @@ private:
 
 };
 
+// Inline Method Definitions *************************************************
+inline unsigned int CaesarCipher::getLetterIndex (const unsigned char character) {
+
+	// Setting the case bit lowercases a letter, and the subtraction wraps
+	// every other character past the end of the alphabet.
+	return static_cast<unsigned char> ((character | 0x20) - 'a');
+
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,244 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * xxHash64 algorithm from:		https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include "ContentHash.h"
+
+// Method Definitions ********************************************************
+unsigned long long ContentHash::hash64 (const char* const data, const std::size_t length, const unsigned long long seed) {
+
+	State state;
+
+	startHash64 (state, seed);
+	updateHash64 (state, data, length);
+
+	return finishHash64 (state);
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::hash64 (const std::string& text) {
+
+	return hash64 (text.data (), text.length (), 0);
+
+}
+
+//****************************************************************************
+std::string ContentHash::toHex (const unsigned long long hash) {
+
+	const char DIGITS[] = "0123456789abcdef";
+	std::string hex (16, '0');
+
+	for (unsigned int i = 0; i < 16; i++) {
+
+		hex[15 - i] = DIGITS[(hash >> (i * 4)) & 0xF];
+
+	}
+
+	return hex;
+
+}
+
+//****************************************************************************
+void ContentHash::startHash64 (State& state, const unsigned long long seed) {
+
+	state.accumulators[0] = seed + PRIME_1 + PRIME_2;
+	state.accumulators[1] = seed + PRIME_2;
+	state.accumulators[2] = seed;
+	state.accumulators[3] = seed - PRIME_1;
+	state.seed = seed;
+	state.totalLength = 0;
+	state.stripeLength = 0;
+
+}
+
+//****************************************************************************
+void ContentHash::updateHash64 (State& state, const char* const data, const std::size_t length) {
+
+	const char* position = data;
+	const char* const end = data + length;
+	std::size_t fill = 0;
+
+	state.totalLength += length;
+
+	if (state.stripeLength + length < 32) {
+
+		std::copy (position, end, state.stripe + state.stripeLength);
+		state.stripeLength += length;
+		return;
+
+	}
+
+	if (state.stripeLength != 0) {
+
+		fill = 32 - state.stripeLength;
+		std::copy (position, position + fill, state.stripe + state.stripeLength);
+		consumeStripe (state, state.stripe);
+		position += fill;
+
+	}
+
+	while (end - position >= 32) {
+
+		consumeStripe (state, position);
+		position += 32;
+
+	}
+
+	std::copy (position, end, state.stripe);
+	state.stripeLength = static_cast<std::size_t> (end - position);
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::finishHash64 (const State& state) {
+
+	const char* position = state.stripe;
+	const char* const end = state.stripe + state.stripeLength;
+	unsigned long long hash = 0;
+
+	if (state.totalLength >= 32) {
+
+		hash = rotateLeft (state.accumulators[0], 1) + rotateLeft (state.accumulators[1], 7) + rotateLeft (state.accumulators[2], 12) + rotateLeft (state.accumulators[3], 18);
+
+		for (unsigned int i = 0; i < 4; i++) {
+
+			hash = mergeAccumulator (hash, state.accumulators[i]);
+
+		}
+
+	} else {
+
+		hash = state.seed + PRIME_5;
+
+	}
+
+	hash += state.totalLength;
+
+	while (position + 8 <= end) {
+
+		hash ^= round (0, read64 (position));
+		hash = rotateLeft (hash, 27) * PRIME_1 + PRIME_4;
+		position += 8;
+
+	}
+
+	if (position + 4 <= end) {
+
+		hash ^= read32 (position) * PRIME_1;
+		hash = rotateLeft (hash, 23) * PRIME_2 + PRIME_3;
+		position += 4;
+
+	}
+
+	while (position < end) {
+
+		hash ^= static_cast<unsigned long long> (static_cast<unsigned char> (*position)) * PRIME_5;
+		hash = rotateLeft (hash, 11) * PRIME_1;
+		position++;
+
+	}
+
+	// Final avalanche so that every input bit affects every output bit.
+	hash ^= hash >> 33;
+	hash *= PRIME_2;
+	hash ^= hash >> 29;
+	hash *= PRIME_3;
+	hash ^= hash >> 32;
+
+	return hash;
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::rotateLeft (const unsigned long long value, const unsigned int bits) {
+
+	return (value << bits) | (value >> (64 - bits));
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::round (const unsigned long long accumulator, const unsigned long long lane) {
+
+	return rotateLeft (accumulator + lane * PRIME_2, 31) * PRIME_1;
+
+}
+
+//****************************************************************************
+void ContentHash::consumeStripe (State& state, const char* const stripe) {
+
+	// Four independent accumulators let the processor work on a whole
+	// 32 byte stripe at once.
+	state.accumulators[0] = round (state.accumulators[0], read64 (stripe));
+	state.accumulators[1] = round (state.accumulators[1], read64 (stripe + 8));
+	state.accumulators[2] = round (state.accumulators[2], read64 (stripe + 16));
+	state.accumulators[3] = round (state.accumulators[3], read64 (stripe + 24));
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::mergeAccumulator (const unsigned long long hash, const unsigned long long accumulator) {
+
+	return (hash ^ round (0, accumulator)) * PRIME_1 + PRIME_4;
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::read64 (const char* const data) {
+
+	const unsigned char* const bytes = reinterpret_cast<const unsigned char*> (data);
+	unsigned long long value = 0;
+
+	// Assembling the value byte by byte keeps the hash identical on big and
+	// little endian machines; compilers reduce this to a single load on x86.
+	for (unsigned int i = 0; i < 8; i++) {
+
+		value |= static_cast<unsigned long long> (bytes[i]) << (i * 8);
+
+	}
+
+	return value;
+
+}
+
+//****************************************************************************
+unsigned long long ContentHash::read32 (const char* const data) {
+
+	const unsigned char* const bytes = reinterpret_cast<const unsigned char*> (data);
+
+	return static_cast<unsigned long long> (bytes[0]) | (static_cast<unsigned long long> (bytes[1]) << 8) |
+		   (static_cast<unsigned long long> (bytes[2]) << 16) | (static_cast<unsigned long long> (bytes[3]) << 24);
+
+}
+
+//****************************************************************************
+ContentHash::ContentHash (void) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+ContentHash::ContentHash (const ContentHash& contentHash) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+ContentHash& ContentHash::operator= (const ContentHash& contentHash) {
+
+	// Dummy
+	return *this;
+
+}
@@ -0,0 +1,164 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * xxHash64 algorithm from:		https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+
+#ifndef CONTENT_HASH_H
+#define CONTENT_HASH_H
+
+/**
+ * Static class for fast, non-cryptographic hashing of file contents. Used to
+ * recognise inputs that have been seen before, not to protect them.
+ */
+class ContentHash {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * A 64 bit xxHash in progress, for input that arrives a piece at a time.
+	 * Hashing the pieces gives the same hash as hashing them joined.
+	 */
+	struct State {
+
+		unsigned long long	accumulators[4];	/**< Stripe accumulators. */
+		unsigned long long	seed;				/**< Seed the hash was started from. */
+		unsigned long long	totalLength;		/**< Number of bytes hashed so far. */
+		char				stripe[32];			/**< Bytes not yet making up a whole stripe. */
+		std::size_t			stripeLength;		/**< Number of bytes in stripe. */
+
+	};
+
+	// Public Methods ********************************************************
+	/**
+	 * Computes the 64 bit xxHash of the given bytes.
+	 * @param data to hash.
+	 * @param length, number of bytes to hash.
+	 * @param seed to start the hash from.
+	 * @return the hash.
+	 */
+	static unsigned long long hash64 (const char* const data, const std::size_t length, const unsigned long long seed);
+
+	/**
+	 * Computes the 64 bit xxHash of the given string with a seed of zero.
+	 * @param text to hash.
+	 * @return the hash.
+	 */
+	static unsigned long long hash64 (const std::string& text);
+
+	/**
+	 * Formats a hash as 16 lowercase hexadecimal digits.
+	 * @param hash to format.
+	 * @return the formatted hash.
+	 */
+	static std::string toHex (const unsigned long long hash);
+
+	/**
+	 * Starts a 64 bit xxHash.
+	 * @param state to start.
+	 * @param seed to start the hash from.
+	 */
+	static void startHash64 (State& state, const unsigned long long seed);
+
+	/**
+	 * Adds bytes to a 64 bit xxHash. Whole stripes are hashed straight from
+	 * data, so only the last few bytes are copied.
+	 * @param state of the hash.
+	 * @param data to hash.
+	 * @param length, number of bytes to hash.
+	 */
+	static void updateHash64 (State& state, const char* const data, const std::size_t length);
+
+	/**
+	 * Finishes a 64 bit xxHash. The state is left as is, so more bytes may
+	 * still be added.
+	 * @param state of the hash.
+	 * @return the hash of every byte added.
+	 */
+	static unsigned long long finishHash64 (const State& state);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned long long PRIME_1 = 11400714785074694791ULL;	/**< First xxHash64 prime. */
+	static const unsigned long long PRIME_2 = 14029467366897019727ULL;	/**< Second xxHash64 prime. */
+	static const unsigned long long PRIME_3 = 1609587929392839161ULL;	/**< Third xxHash64 prime. */
+	static const unsigned long long PRIME_4 = 9650029242287828579ULL;	/**< Fourth xxHash64 prime. */
+	static const unsigned long long PRIME_5 = 2870177450012600261ULL;	/**< Fifth xxHash64 prime. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Rotates the bits of a value left.
+	 * @param value to rotate.
+	 * @param bits to rotate by.
+	 * @return the rotated value.
+	 */
+	static unsigned long long rotateLeft (const unsigned long long value, const unsigned int bits);
+
+	/**
+	 * Mixes one 8 byte lane of input into an accumulator.
+	 * @param accumulator to mix into.
+	 * @param lane of input.
+	 * @return the new accumulator.
+	 */
+	static unsigned long long round (const unsigned long long accumulator, const unsigned long long lane);
+
+	/**
+	 * Mixes one 32 byte stripe of input into the accumulators.
+	 * @param state of the hash.
+	 * @param stripe of input.
+	 */
+	static void consumeStripe (State& state, const char* const stripe);
+
+	/**
+	 * Merges a stripe accumulator into the hash.
+	 * @param hash to merge into.
+	 * @param accumulator to merge.
+	 * @return the new hash.
+	 */
+	static unsigned long long mergeAccumulator (const unsigned long long hash, const unsigned long long accumulator);
+
+	/**
+	 * Reads 8 little endian bytes.
+	 * @param data to read from.
+	 * @return the value read.
+	 */
+	static unsigned long long read64 (const char* const data);
+
+	/**
+	 * Reads 4 little endian bytes.
+	 * @param data to read from.
+	 * @return the value read.
+	 */
+	static unsigned long long read32 (const char* const data);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	ContentHash (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param contentHash to copy from.
+	 */
+	ContentHash (const ContentHash& contentHash);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param contentHash to copy from.
+	 * @return this ContentHash.
+	 */
+	ContentHash& operator= (const ContentHash& contentHash);
+
+};
+
+#endif
@@ -0,0 +1,280 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Content addressable storage overview from:	https://en.wikipedia.org/wiki/Content-addressable_storage
+ * Various function lookups from:				http://www.cplusplus.com/reference/cstdio/rename/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "CaesarCipher.h"
+#include "ContentHash.h"
+#include "CrackCache.h"
+#include "FileSystem.h"
+
+// Static Constant Definitions ***********************************************
+const char CrackCache::MAGIC[4] = { 'C', 'C', 'U', 'C' };
+
+// Method Definitions ********************************************************
+CrackCache::CrackCache (const std::string& directory, const unsigned long long maximumSize) :
+	directory (directory),
+	maximumSize (maximumSize),
+	unscannedBytes (maximumSize / 16),
+	temporaryCount (0) {
+
+	FileSystem::makeDirectories (directory);
+
+}
+
+//****************************************************************************
+bool CrackCache::crack (const std::string& ciphertext, Entry& entry) {
+
+	if (lookup (ciphertext, entry)) {
+
+		return true;
+
+	}
+
+	computeEntry (ciphertext, entry);
+	store (ciphertext, entry);
+
+	return false;
+
+}
+
+//****************************************************************************
+bool CrackCache::lookup (const std::string& ciphertext, Entry& entry) const {
+
+	const unsigned long long hash = ContentHash::hash64 (ciphertext);
+	const std::string filename = getEntryFilename (hash, ciphertext.length ());
+	unsigned long long size = 0;
+	std::string contents;
+
+	if (!FileSystem::getFileSize (filename, size) || !FileSystem::readFileRange (filename, 0, size, contents)) {
+
+		return false;
+
+	}
+
+	if (!deserialize (contents, hash, ciphertext.length (), entry)) {
+
+		return false;
+
+	}
+
+	// Mark the entry as recently used so that eviction keeps it.
+	FileSystem::touchFile (filename);
+	return true;
+
+}
+
+//****************************************************************************
+void CrackCache::store (const std::string& ciphertext, const Entry& entry) {
+
+	const unsigned long long hash = ContentHash::hash64 (ciphertext);
+	const std::string contents = serialize (hash, ciphertext.length (), entry);
+	std::ostringstream temporaryFilename;
+
+	// Write under a name no other process or thread will use, then rename
+	// over the entry so readers never see a partially written file.
+	temporaryFilename << "tmp-" << FileSystem::getProcessId () << '-' << temporaryCount++ << '-' << ContentHash::toHex (hash);
+
+	const std::string temporaryPath = FileSystem::joinPath (directory, temporaryFilename.str ());
+
+	if (!FileSystem::writeFile (temporaryPath, contents) ||
+		!FileSystem::replaceFile (temporaryPath, getEntryFilename (hash, ciphertext.length ()))) {
+
+		FileSystem::removeFile (temporaryPath);
+		return;
+
+	}
+
+	evict (contents.length ());
+
+}
+
+//****************************************************************************
+void CrackCache::computeEntry (const std::string& ciphertext, Entry& entry) {
+
+	CaesarCipher::countLetters (ciphertext, entry.letterCounts);
+	CaesarCipher::rankKeys (entry.letterCounts, entry.rankedKeys, entry.rankedScores);
+
+}
+
+//****************************************************************************
+std::string CrackCache::getEntryFilename (const unsigned long long hash, const unsigned long long length) const {
+
+	std::ostringstream filename;
+
+	filename << ContentHash::toHex (hash) << '-' << ContentHash::toHex (length) << ".v" << CaesarCipher::SCORING_MODEL_VERSION;
+
+	return FileSystem::joinPath (directory, filename.str ());
+
+}
+
+//****************************************************************************
+std::string CrackCache::serialize (const unsigned long long hash, const unsigned long long length, const Entry& entry) {
+
+	std::string buffer;
+
+	buffer.append (MAGIC, sizeof (MAGIC));
+	BinaryFormat::appendInteger (buffer, FORMAT_VERSION, 4);
+	BinaryFormat::appendInteger (buffer, CaesarCipher::SCORING_MODEL_VERSION, 4);
+	BinaryFormat::appendInteger (buffer, hash, 8);
+	BinaryFormat::appendInteger (buffer, length, 8);
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		BinaryFormat::appendInteger (buffer, entry.letterCounts[i], 4);
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		BinaryFormat::appendInteger (buffer, entry.rankedKeys[i], 4);
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		BinaryFormat::appendDouble (buffer, entry.rankedScores[i]);
+
+	}
+
+	BinaryFormat::appendChecksum (buffer);
+
+	return buffer;
+
+}
+
+//****************************************************************************
+bool CrackCache::deserialize (const std::string& contents, const unsigned long long hash, const unsigned long long length, Entry& entry) {
+
+	std::string::size_type offset = sizeof (MAGIC);
+	unsigned long long formatVersion = 0;
+	unsigned long long modelVersion = 0;
+	unsigned long long entryHash = 0;
+	unsigned long long entryLength = 0;
+	unsigned long long value = 0;
+
+	if (contents.compare (0, sizeof (MAGIC), MAGIC, sizeof (MAGIC)) != 0 || !BinaryFormat::verifyChecksum (contents)) {
+
+		return false;
+
+	}
+
+	if (!BinaryFormat::readInteger (contents, offset, 4, formatVersion) || formatVersion != FORMAT_VERSION ||
+		!BinaryFormat::readInteger (contents, offset, 4, modelVersion) || modelVersion != CaesarCipher::SCORING_MODEL_VERSION ||
+		!BinaryFormat::readInteger (contents, offset, 8, entryHash) || entryHash != hash ||
+		!BinaryFormat::readInteger (contents, offset, 8, entryLength) || entryLength != length) {
+
+		return false;
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		if (!BinaryFormat::readInteger (contents, offset, 4, value)) {
+
+			return false;
+
+		}
+
+		entry.letterCounts[i] = static_cast<unsigned int> (value);
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		if (!BinaryFormat::readInteger (contents, offset, 4, value) || value >= CaesarCipher::ALPHABET_LENGTH) {
+
+			return false;
+
+		}
+
+		entry.rankedKeys[i] = static_cast<unsigned int> (value);
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		if (!BinaryFormat::readDouble (contents, offset, entry.rankedScores[i])) {
+
+			return false;
+
+		}
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+void CrackCache::evict (const unsigned long long bytesWritten) {
+
+	std::vector<std::string> filenames;
+	std::vector<std::pair<long long, std::pair<unsigned long long, std::string> > > files;
+	unsigned long long totalSize = 0;
+	unsigned long long size = 0;
+	long long modificationTime = 0;
+
+	// Scanning the directory on every store would make a run over many files
+	// quadratic, so let the directory overshoot by a sixteenth first.
+	if ((unscannedBytes += bytesWritten) < maximumSize / 16) {
+
+		return;
+
+	}
+
+	std::unique_lock<std::mutex> lock (evictionMutex, std::try_to_lock);
+
+	if (!lock.owns_lock ()) {
+
+		return;
+
+	}
+
+	unscannedBytes = 0;
+
+	if (!FileSystem::listFiles (directory, filenames)) {
+
+		return;
+
+	}
+
+	for (const std::string& filename : filenames) {
+
+		const std::string path = FileSystem::joinPath (directory, filename);
+
+		if (FileSystem::getFileSize (path, size) && FileSystem::getModificationTime (path, modificationTime)) {
+
+			files.push_back (std::make_pair (modificationTime, std::make_pair (size, path)));
+			totalSize += size;
+
+		}
+
+	}
+
+	std::sort (files.begin (), files.end ());
+
+	// Another process may be evicting at the same time, in which case a
+	// removal fails harmlessly and the sizes still add up.
+	for (unsigned int i = 0; i < files.size () && totalSize > maximumSize; i++) {
+
+		FileSystem::removeFile (files[i].second.second);
+		totalSize -= files[i].second.first;
+
+	}
+
+}
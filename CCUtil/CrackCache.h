@@ -0,0 +1,141 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Content addressable storage overview from:	https://en.wikipedia.org/wiki/Content-addressable_storage
+ * Various function lookups from:				http://www.cplusplus.com/reference/cstdio/rename/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include "CaesarCipher.h"
+
+#ifndef CRACK_CACHE_H
+#define CRACK_CACHE_H
+
+/**
+ * On-disk cache of crack results keyed by a hash of the ciphertext and the
+ * scoring model version, so that unchanged inputs need not be counted and
+ * scored again. Entries are written to a temporary file and renamed into
+ * place, and are validated with a checksum when read, so any number of
+ * CCUtil processes may share one cache directory. The least recently used
+ * entries are evicted once the directory grows past its size limit.
+ */
+class CrackCache {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Crack results of a single ciphertext.
+	 */
+	struct Entry {
+
+		unsigned int	letterCounts[CaesarCipher::ALPHABET_LENGTH];	/**< Number of times each letter occurs. */
+		unsigned int	rankedKeys[CaesarCipher::ALPHABET_LENGTH];		/**< Every key, most likely first. */
+		double			rankedScores[CaesarCipher::ALPHABET_LENGTH];	/**< Chi squared sum of each ranked key. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned long long DEFAULT_MAXIMUM_SIZE = 64ULL << 20;	/**< Default size limit of the cache directory in bytes. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Opens a cache directory, creating it if need be.
+	 * @param directory to store entries in.
+	 * @param maximumSize, size in bytes the directory is kept under.
+	 */
+	CrackCache (const std::string& directory, const unsigned long long maximumSize);
+
+	// Public Methods ********************************************************
+	/**
+	 * Looks up the crack results of the given ciphertext, computing and
+	 * storing them if they are not cached yet.
+	 * @param ciphertext to crack.
+	 * @param entry, where to store the crack results.
+	 * @return true if the results came from the cache, otherwise false.
+	 * @throw logic_error if the results had to be computed and a letter in
+	 * the alphabet has a frequency of zero.
+	 */
+	bool crack (const std::string& ciphertext, Entry& entry);
+
+	/**
+	 * Looks up the crack results of the given ciphertext.
+	 * @param ciphertext to look up.
+	 * @param entry, where to store the crack results.
+	 * @return true if found, otherwise false.
+	 */
+	bool lookup (const std::string& ciphertext, Entry& entry) const;
+
+	/**
+	 * Stores the crack results of the given ciphertext. Failures are not
+	 * reported since the cache is only an optimization.
+	 * @param ciphertext the results belong to.
+	 * @param entry, the crack results.
+	 */
+	void store (const std::string& ciphertext, const Entry& entry);
+
+	/**
+	 * Computes the crack results of the given ciphertext without the cache.
+	 * @param ciphertext to crack.
+	 * @param entry, where to store the crack results.
+	 * @throw logic_error if a letter in the alphabet has a frequency of zero.
+	 */
+	static void computeEntry (const std::string& ciphertext, Entry& entry);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;		/**< Version of the entry file layout. */
+	static const char MAGIC[4];							/**< Bytes every entry file starts with. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Builds the filename of the entry for the given ciphertext.
+	 * @param hash of the ciphertext.
+	 * @param length of the ciphertext.
+	 * @return the full path of the entry.
+	 */
+	std::string getEntryFilename (const unsigned long long hash, const unsigned long long length) const;
+
+	/**
+	 * Serializes an entry along with the identity of its ciphertext.
+	 * @param hash of the ciphertext.
+	 * @param length of the ciphertext.
+	 * @param entry to serialize.
+	 * @return the serialized entry, ending in a checksum.
+	 */
+	static std::string serialize (const unsigned long long hash, const unsigned long long length, const Entry& entry);
+
+	/**
+	 * Validates and deserializes an entry.
+	 * @param contents of the entry file.
+	 * @param hash the entry is expected to belong to.
+	 * @param length the entry is expected to belong to.
+	 * @param entry, where to store the deserialized entry.
+	 * @return true if the entry is intact and belongs to the ciphertext, otherwise false.
+	 */
+	static bool deserialize (const std::string& contents, const unsigned long long hash, const unsigned long long length, Entry& entry);
+
+	/**
+	 * Deletes the least recently used entries until the directory is under its
+	 * size limit. Only scans the directory once enough has been written since
+	 * the last scan.
+	 * @param bytesWritten by the store that triggered the eviction.
+	 */
+	void evict (const unsigned long long bytesWritten);
+
+	// Private Members *******************************************************
+	std::string							directory;			/**< Directory entries are stored in. */
+	unsigned long long					maximumSize;		/**< Size in bytes the directory is kept under. */
+	std::atomic<unsigned long long>		unscannedBytes;		/**< Bytes stored since the directory was last scanned. */
+	std::atomic<unsigned int>			temporaryCount;		/**< Number of temporary files created, for unique names. */
+	std::mutex							evictionMutex;		/**< Keeps threads of this process from scanning at once. */
+
+};
+
+#endif
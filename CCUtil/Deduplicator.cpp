@@ -0,0 +1,151 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Canonical forms from:			https://en.wikipedia.org/wiki/Canonical_form
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "CaesarCipher.h"
+#include "ContentHash.h"
+#include "Deduplicator.h"
+#include "FileSystem.h"
+#include "MappedFile.h"
+#include "WorkStealingPool.h"
+
+// Method Definitions ********************************************************
+Deduplicator::Fingerprint Deduplicator::fingerprint (const char* const text, const std::size_t length) {
+
+	const std::size_t CHUNK_SIZE = CANONICAL_CHUNK_SIZE;
+	char canonicalChunk[CANONICAL_CHUNK_SIZE];
+	ContentHash::State hashState;
+	std::size_t count = 0;
+	unsigned int index = 0;
+	Fingerprint result;
+
+	result.rotation = 0;
+	result.isReadable = true;
+
+	for (std::size_t i = 0; i < length; i++) {
+
+		index = CaesarCipher::getLetterIndex (text[i]);
+
+		if (index < CaesarCipher::ALPHABET_LENGTH) {
+
+			result.rotation = index;
+			break;
+
+		}
+
+	}
+
+	// Deciphering with the first letter's index turns that letter into A, and
+	// every encipherment of the same plaintext into the same text. The text
+	// is rotated a chunk at a time into a buffer that stays in cache, rather
+	// than copied whole, and each chunk is hashed as soon as it is rotated.
+	ContentHash::startHash64 (hashState, 0);
+
+	for (std::size_t offset = 0; offset < length; offset += CHUNK_SIZE) {
+
+		count = (length - offset < CHUNK_SIZE) ? length - offset : CHUNK_SIZE;
+		CaesarCipher::decipher (text + offset, count, result.rotation, canonicalChunk);
+		ContentHash::updateHash64 (hashState, canonicalChunk, count);
+
+	}
+
+	result.hash = ContentHash::finishHash64 (hashState);
+	CaesarCipher::countLetters (text, length, result.letterCounts);
+
+	return result;
+
+}
+
+//****************************************************************************
+Deduplicator::Fingerprint Deduplicator::fingerprintFile (const std::string& filename) {
+
+	MappedFile mappedFile;
+	Fingerprint result;
+
+	if (!mappedFile.open (filename)) {
+
+		result = fingerprint (nullptr, 0);
+		result.isReadable = false;
+		return result;
+
+	}
+
+	return fingerprint (mappedFile.getData (), mappedFile.getSize ());
+
+}
+
+//****************************************************************************
+void Deduplicator::fingerprintFiles (const std::string& directory, const std::vector<std::string>& relativePaths, WorkStealingPool& pool, std::vector<Fingerprint>& fingerprints) {
+
+	fingerprints.resize (relativePaths.size ());
+
+	// Each task writes only its own slot, so no locking is needed.
+	for (std::size_t i = 0; i < relativePaths.size (); i++) {
+
+		pool.submit ([&directory, &relativePaths, &fingerprints, i] (void) {
+
+			fingerprints[i] = fingerprintFile (FileSystem::joinPath (directory, relativePaths[i]));
+
+		});
+
+	}
+
+	pool.wait ();
+
+}
+
+//****************************************************************************
+std::size_t Deduplicator::groupDuplicates (const std::vector<Fingerprint>& fingerprints, std::vector<std::size_t>& representatives) {
+
+	std::unordered_map<unsigned long long, std::size_t> firstIndices;
+	std::size_t groupCount = 0;
+
+	representatives.resize (fingerprints.size ());
+	firstIndices.reserve (fingerprints.size ());
+
+	for (std::size_t i = 0; i < fingerprints.size (); i++) {
+
+		representatives[i] = i;
+
+		if (fingerprints[i].isReadable) {
+
+			const std::pair<std::unordered_map<unsigned long long, std::size_t>::iterator, bool> inserted = firstIndices.insert (std::make_pair (fingerprints[i].hash, i));
+
+			representatives[i] = inserted.first->second;
+
+		}
+
+		if (representatives[i] == i) {
+
+			groupCount++;
+
+		}
+
+	}
+
+	return groupCount;
+
+}
+
+//****************************************************************************
+unsigned int Deduplicator::propagateKey (const Fingerprint& representative, const unsigned int representativeKey, const Fingerprint& duplicate) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+
+	// Both first letters are the same plaintext letter, each moved by its own
+	// key, so the keys differ by as much as the first letters do.
+	return (representativeKey % ALPHABET_LENGTH + duplicate.rotation + ALPHABET_LENGTH - representative.rotation) % ALPHABET_LENGTH;
+
+}
@@ -0,0 +1,116 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Canonical forms from:			https://en.wikipedia.org/wiki/Canonical_form
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "WorkStealingPool.h"
+
+#ifndef DEDUPLICATOR_H
+#define DEDUPLICATOR_H
+
+/**
+ * Static class that recognises the same message enciphered under different
+ * Caesar keys. A text is rotated so that its first letter becomes A before
+ * it is hashed, which gives every encipherment of a plaintext the same
+ * fingerprint. Only one text of each group of duplicates then needs cracking;
+ * the key of every other follows from how far its first letter is from the
+ * representative's.
+ */
+class Deduplicator {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Fingerprint of a text, and what is needed to crack it without reading
+	 * it again.
+	 */
+	struct Fingerprint {
+
+		unsigned long long	hash;										/**< Hash of the text rotated so that its first letter is A. */
+		unsigned int		rotation;									/**< Key the text was rotated back by, the index of its first letter. Zero if it has none. */
+		unsigned int		letterCounts[CaesarCipher::ALPHABET_LENGTH];	/**< Number of times each letter occurs in the text as given. */
+		bool				isReadable;									/**< Whether the text could be read. */
+
+	};
+
+	// Public Methods ********************************************************
+	/**
+	 * Fingerprints a text.
+	 * @param text to fingerprint.
+	 * @param length, number of characters in text.
+	 * @return the fingerprint.
+	 */
+	static Fingerprint fingerprint (const char* const text, const std::size_t length);
+
+	/**
+	 * Fingerprints the whole of a file, which is memory mapped.
+	 * @param filename of the file.
+	 * @return the fingerprint, marked unreadable if the file could not be read.
+	 */
+	static Fingerprint fingerprintFile (const std::string& filename);
+
+	/**
+	 * Fingerprints many files at once.
+	 * @param directory the files are relative to.
+	 * @param relativePaths of the files.
+	 * @param pool to spread the files over.
+	 * @param fingerprints, where to store the fingerprint of each file, in order.
+	 */
+	static void fingerprintFiles (const std::string& directory, const std::vector<std::string>& relativePaths, WorkStealingPool& pool, std::vector<Fingerprint>& fingerprints);
+
+	/**
+	 * Groups texts with equal fingerprints. The first text of each group is
+	 * its representative. Unreadable texts are never grouped.
+	 * @param fingerprints of the texts.
+	 * @param representatives, where to store the index of each text's
+	 * representative, its own index if it represents its group.
+	 * @return the number of groups.
+	 */
+	static std::size_t groupDuplicates (const std::vector<Fingerprint>& fingerprints, std::vector<std::size_t>& representatives);
+
+	/**
+	 * Works out the key of a duplicate from the key of its representative.
+	 * @param representative, fingerprint of the representative.
+	 * @param representativeKey, key the representative was enciphered with.
+	 * @param duplicate, fingerprint of the duplicate.
+	 * @return the key the duplicate was enciphered with.
+	 */
+	static unsigned int propagateKey (const Fingerprint& representative, const unsigned int representativeKey, const Fingerprint& duplicate);
+
+private:
+	// Private Static Constants **********************************************
+	static const std::size_t CANONICAL_CHUNK_SIZE = 16384;		/**< Characters rotated onto the stack and hashed at a time. */
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	Deduplicator (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param deduplicator to copy from.
+	 */
+	Deduplicator (const Deduplicator& deduplicator);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param deduplicator to copy from.
+	 * @return this Deduplicator.
+	 */
+	Deduplicator& operator= (const Deduplicator& deduplicator);
+
+};
+
+#endif
@@ -0,0 +1,376 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * File change notification reference from:	http://man7.org/linux/man-pages/man7/inotify.7.html
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "BinaryFormat.h"
+#include "CaesarCipher.h"
+#include "FileFollower.h"
+#include "FileSystem.h"
+#include "TreeProcessor.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Static Constant Definitions ***********************************************
+const char FileFollower::MAGIC[4] = { 'C', 'C', 'F', 'F' };
+
+// Method Definitions ********************************************************
+FileFollower::FileFollower (const TreeProcessor::Operation operation, const unsigned int key, const std::string& inputFilename, const std::string& outputFilename, const std::string& checkpointFilename) :
+	operation (operation),
+	key ((operation == TreeProcessor::CRACK) ? 0 : key),
+	inputFilename (inputFilename),
+	outputFilename (outputFilename),
+	checkpointFilename (checkpointFilename),
+	inputIdentity (0),
+	inputOffset (0),
+	outputLength (0),
+	letterCounts (),
+	notificationDescriptor (-1) {
+
+}
+
+//****************************************************************************
+FileFollower::~FileFollower (void) {
+
+#ifdef __linux__
+	if (notificationDescriptor >= 0) {
+
+		close (notificationDescriptor);
+
+	}
+#endif
+
+}
+
+//****************************************************************************
+unsigned int FileFollower::getKey (void) const {
+
+	return key;
+
+}
+
+//****************************************************************************
+unsigned long long FileFollower::getInputOffset (void) const {
+
+	return inputOffset;
+
+}
+
+//****************************************************************************
+bool FileFollower::open (void) {
+
+	unsigned long long outputSize = 0;
+	bool hasCheckpoint = false;
+
+	if (!loadCheckpoint (hasCheckpoint)) {
+
+		return false;
+
+	}
+
+	if (!outputFilename.empty ()) {
+
+		if (hasCheckpoint) {
+
+			// Anything written after the checkpoint was saved is written again.
+			if (!FileSystem::getFileSize (outputFilename, outputSize) || outputSize < outputLength || !FileSystem::resizeFile (outputFilename, outputLength)) {
+
+				return false;
+
+			}
+
+			outputStream.open (outputFilename, std::ios::out | std::ios::binary | std::ios::app);
+
+		} else {
+
+			outputStream.open (outputFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		}
+
+		if (!outputStream.good ()) {
+
+			return false;
+
+		}
+
+	}
+
+#ifdef __linux__
+	// The directory is watched rather than the file, so that a file created
+	// in place of a rotated one is noticed too.
+	const std::string directory = FileSystem::getParentDirectory (inputFilename);
+
+	notificationDescriptor = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+
+	if (notificationDescriptor >= 0 && inotify_add_watch (notificationDescriptor, directory.empty () ? "." : directory.c_str (),
+		IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO) < 0) {
+
+		close (notificationDescriptor);
+		notificationDescriptor = -1;
+
+	}
+#endif
+
+	return true;
+
+}
+
+//****************************************************************************
+bool FileFollower::update (std::string& processed) {
+
+	unsigned long long identity = 0;
+	unsigned long long size = 0;
+	std::string chunk;
+	bool isRestarted = false;
+
+	processed.clear ();
+
+	// A missing input has not been created yet, or is between rotations.
+	if (!FileSystem::getFileIdentity (inputFilename, identity) || !FileSystem::getFileSize (inputFilename, size)) {
+
+		return true;
+
+	}
+
+	// A new file under the same name, or the same file cut shorter, is read
+	// from its start.
+	if (identity != inputIdentity || size < inputOffset) {
+
+		isRestarted = inputOffset != 0;
+		inputIdentity = identity;
+		inputOffset = 0;
+
+	}
+
+	// One chunk at a time, so that catching up on a large file takes no more
+	// memory than following a small one.
+	if (inputOffset < size) {
+
+		if (!FileSystem::readFileRange (inputFilename, inputOffset, (size - inputOffset < DEFAULT_CHUNK_SIZE) ? size - inputOffset : DEFAULT_CHUNK_SIZE, chunk)) {
+
+			// Most likely rotated away since its size was read; try again next time.
+			return true;
+
+		}
+
+		processChunk (chunk, processed);
+
+		if (outputStream.is_open ()) {
+
+			outputStream.write (processed.data (), static_cast<std::streamsize> (processed.length ()));
+			outputStream.flush ();
+
+			if (!outputStream.good ()) {
+
+				return false;
+
+			}
+
+		}
+
+		inputOffset += chunk.length ();
+		outputLength += processed.length ();
+
+	} else if (!isRestarted) {
+
+		return true;
+
+	}
+
+	return saveCheckpoint ();
+
+}
+
+//****************************************************************************
+void FileFollower::waitForChange (const unsigned int timeoutMilliseconds) const {
+
+#ifdef __linux__
+	if (notificationDescriptor >= 0) {
+
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now () + std::chrono::milliseconds (timeoutMilliseconds);
+		const std::string::size_type separatorIndex = inputFilename.find_last_of (FileSystem::PATH_SEPARATOR);
+		const std::string name = (separatorIndex == std::string::npos) ? inputFilename : inputFilename.substr (separatorIndex + 1);
+		alignas (struct inotify_event) char events[4096];
+		struct pollfd descriptor;
+		long long remaining = timeoutMilliseconds;
+		ssize_t length = 0;
+		bool isChanged = false;
+
+		descriptor.fd = notificationDescriptor;
+		descriptor.events = POLLIN;
+
+		// Other files of the directory wake the poll too, but only a change to
+		// the input ends the wait.
+		while (!isChanged && remaining >= 0 && poll (&descriptor, 1, static_cast<int> (remaining)) > 0) {
+
+			while ((length = read (notificationDescriptor, events, sizeof (events))) > 0) {
+
+				for (const char* position = events; position < events + length; position += sizeof (struct inotify_event) + reinterpret_cast<const struct inotify_event*> (position)->len) {
+
+					const struct inotify_event* const event = reinterpret_cast<const struct inotify_event*> (position);
+
+					isChanged = isChanged || (event->mask & IN_Q_OVERFLOW) != 0 || (event->len != 0 && name == event->name);
+
+				}
+
+			}
+
+			remaining = std::chrono::duration_cast<std::chrono::milliseconds> (deadline - std::chrono::steady_clock::now ()).count ();
+
+		}
+
+		return;
+
+	}
+#endif
+
+	const unsigned int interval = (timeoutMilliseconds < POLL_MILLISECONDS) ? timeoutMilliseconds : POLL_MILLISECONDS;
+
+	std::this_thread::sleep_for (std::chrono::milliseconds (interval));
+
+}
+
+//****************************************************************************
+bool FileFollower::loadCheckpoint (bool& hasCheckpoint) {
+
+	std::string contents;
+	std::string::size_type offset = sizeof (MAGIC);
+	unsigned long long size = 0;
+	unsigned long long formatVersion = 0;
+	unsigned long long loadedOperation = 0;
+	unsigned long long loadedKey = 0;
+	unsigned long long value = 0;
+
+	hasCheckpoint = false;
+
+	// No checkpoint yet is a fresh start.
+	if (checkpointFilename.empty () || !FileSystem::getFileSize (checkpointFilename, size)) {
+
+		return true;
+
+	}
+
+	if (!FileSystem::readFileRange (checkpointFilename, 0, size, contents) ||
+		contents.compare (0, sizeof (MAGIC), MAGIC, sizeof (MAGIC)) != 0 || !BinaryFormat::verifyChecksum (contents) ||
+		!BinaryFormat::readInteger (contents, offset, 2, formatVersion) || formatVersion != FORMAT_VERSION ||
+		!BinaryFormat::readInteger (contents, offset, 1, loadedOperation) || loadedOperation != static_cast<unsigned long long> (operation) ||
+		!BinaryFormat::readInteger (contents, offset, 1, loadedKey) || (operation != TreeProcessor::CRACK && loadedKey != key) ||
+		!BinaryFormat::readInteger (contents, offset, 8, inputIdentity) ||
+		!BinaryFormat::readInteger (contents, offset, 8, inputOffset) ||
+		!BinaryFormat::readInteger (contents, offset, 8, outputLength)) {
+
+		return false;
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		if (!BinaryFormat::readInteger (contents, offset, 4, value)) {
+
+			return false;
+
+		}
+
+		letterCounts[i] = static_cast<unsigned int> (value);
+
+	}
+
+	key = static_cast<unsigned int> (loadedKey);
+	hasCheckpoint = true;
+
+	return true;
+
+}
+
+//****************************************************************************
+bool FileFollower::saveCheckpoint (void) const {
+
+	const std::string temporaryFilename = checkpointFilename + ".tmp";
+	std::string buffer;
+
+	if (checkpointFilename.empty ()) {
+
+		return true;
+
+	}
+
+	buffer.append (MAGIC, sizeof (MAGIC));
+	BinaryFormat::appendInteger (buffer, FORMAT_VERSION, 2);
+	BinaryFormat::appendInteger (buffer, operation, 1);
+	BinaryFormat::appendInteger (buffer, key, 1);
+	BinaryFormat::appendInteger (buffer, inputIdentity, 8);
+	BinaryFormat::appendInteger (buffer, inputOffset, 8);
+	BinaryFormat::appendInteger (buffer, outputLength, 8);
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		BinaryFormat::appendInteger (buffer, letterCounts[i], 4);
+
+	}
+
+	BinaryFormat::appendChecksum (buffer);
+
+	// Written aside and renamed over, so a crash leaves the old or the new
+	// checkpoint but never half of one.
+	return FileSystem::writeFile (temporaryFilename, buffer) && FileSystem::replaceFile (temporaryFilename, checkpointFilename);
+
+}
+
+//****************************************************************************
+void FileFollower::processChunk (const std::string& chunk, std::string& processed) {
+
+	const std::size_t start = processed.length ();
+	unsigned int chunkCounts[CaesarCipher::ALPHABET_LENGTH];
+	bool isSaturated = false;
+
+	processed.resize (start + chunk.length ());
+
+	if (operation == TreeProcessor::ENCIPHER) {
+
+		CaesarCipher::encipher (chunk.data (), chunk.length (), key, &processed[start]);
+		return;
+
+	}
+
+	// Every letter read so far decides the key, so the estimate firms up as
+	// the file grows.
+	if (operation == TreeProcessor::CRACK) {
+
+		CaesarCipher::countLetters (chunk.data (), chunk.length (), chunkCounts);
+
+		for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+			letterCounts[i] += chunkCounts[i];
+			isSaturated = isSaturated || letterCounts[i] >= MAXIMUM_LETTER_COUNT;
+
+		}
+
+		for (unsigned int i = 0; isSaturated && i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+			letterCounts[i] /= 2;
+
+		}
+
+		key = CaesarCipher::crackKey (letterCounts);
+
+	}
+
+	CaesarCipher::decipher (chunk.data (), chunk.length (), key, &processed[start]);
+
+}
@@ -0,0 +1,157 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * File change notification reference from:	http://man7.org/linux/man-pages/man7/inotify.7.html
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include "CaesarCipher.h"
+#include "TreeProcessor.h"
+
+#ifndef FILE_FOLLOWER_H
+#define FILE_FOLLOWER_H
+
+/**
+ * Enciphers, deciphers, or cracks a file that keeps growing, such as a log
+ * being written, by processing only the bytes appended since the last update
+ * and appending the result to an output file. Progress is saved to a
+ * checkpoint after every update, so a restarted follower picks up where the
+ * last one stopped. A file that is truncated or replaced (rotated) is read
+ * again from its start, with its output appended after the old file's.
+ * Waiting for appends uses inotify on Linux, so an idle follower costs
+ * nothing, and polls the file on other systems.
+ */
+class FileFollower {
+
+public:
+	// Public Static Constants ***********************************************
+	static const std::size_t DEFAULT_CHUNK_SIZE = 1 << 20;			/**< Most bytes read from the input at once. */
+	static const unsigned int DEFAULT_WAIT_MILLISECONDS = 1000;		/**< Longest wait before the input is checked regardless of notifications. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Prepares to follow a file. Nothing is read or written until open.
+	 * @param operation to apply to the appended bytes.
+	 * @param key to encipher or decipher with. Ignored when cracking.
+	 * @param inputFilename of the file to follow. Need not exist yet.
+	 * @param outputFilename of the file to append results to. May be empty,
+	 * in which case results are only returned by update.
+	 * @param checkpointFilename, file to save progress in. May be empty.
+	 */
+	FileFollower (const TreeProcessor::Operation operation, const unsigned int key, const std::string& inputFilename, const std::string& outputFilename, const std::string& checkpointFilename);
+
+	/**
+	 * Stops watching the input.
+	 */
+	~FileFollower (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the key bytes are currently processed with. When cracking this
+	 * is the best key for every letter read so far.
+	 * @return the key.
+	 */
+	unsigned int getKey (void) const;
+
+	/**
+	 * Returns the offset of the first input byte not yet processed.
+	 * @return the offset in bytes.
+	 */
+	unsigned long long getInputOffset (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Resumes from the checkpoint, if any, prepares the output and starts
+	 * watching the input. Without a checkpoint the output is started afresh.
+	 * @return true if ready, otherwise false, such as when the checkpoint was
+	 * made for another operation or key, or the output is shorter than the
+	 * checkpoint says it should be.
+	 */
+	bool open (void);
+
+	/**
+	 * Processes every byte appended to the input since the last update.
+	 * @param processed, where to store the result of those bytes.
+	 * @return true if the result was written and the checkpoint saved, or
+	 * nothing was appended, otherwise false.
+	 * @throw logic_error if cracking and a letter in the alphabet has a
+	 * frequency of zero.
+	 */
+	bool update (std::string& processed);
+
+	/**
+	 * Blocks until the input may have changed, or the given time has passed.
+	 * @param timeoutMilliseconds, longest time to wait.
+	 */
+	void waitForChange (const unsigned int timeoutMilliseconds) const;
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;				/**< Version of the checkpoint format. */
+	static const unsigned int POLL_MILLISECONDS = 50;			/**< Interval between checks where notifications are unavailable. */
+	static const unsigned int MAXIMUM_LETTER_COUNT = 1U << 31;	/**< Letter counts are halved once any reaches this, keeping their ratios. */
+	static const char MAGIC[4];									/**< Bytes every checkpoint starts with. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Loads the checkpoint: the bytes "CCFF", a 2 byte format version, a 1
+	 * byte operation, a 1 byte key, the 8 byte identity of the input, the 8
+	 * byte input offset, the 8 byte output length, each letter's 4 byte count,
+	 * and an 8 byte checksum.
+	 * @param hasCheckpoint, where to store whether a checkpoint existed.
+	 * @return true if there was no checkpoint, or it was intact and made for
+	 * this operation and key, otherwise false.
+	 */
+	bool loadCheckpoint (bool& hasCheckpoint);
+
+	/**
+	 * Saves the checkpoint, replacing the old one atomically.
+	 * @return true if saved, otherwise false.
+	 */
+	bool saveCheckpoint (void) const;
+
+	/**
+	 * Applies the operation to a chunk of input.
+	 * @param chunk to process.
+	 * @param processed, where to append the result.
+	 */
+	void processChunk (const std::string& chunk, std::string& processed);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the follower from being copied.
+	 * @param fileFollower to copy from.
+	 */
+	FileFollower (const FileFollower& fileFollower);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the follower from being copied.
+	 * @param fileFollower to copy from.
+	 * @return this FileFollower.
+	 */
+	FileFollower& operator= (const FileFollower& fileFollower);
+
+	// Private Members *******************************************************
+	TreeProcessor::Operation	operation;										/**< Operation applied to appended bytes. */
+	unsigned int				key;											/**< Key bytes are processed with. */
+	std::string					inputFilename;									/**< File being followed. */
+	std::string					outputFilename;									/**< File results are appended to. May be empty. */
+	std::string					checkpointFilename;								/**< File progress is saved in. May be empty. */
+	unsigned long long			inputIdentity;									/**< Identity of the input file being read. */
+	unsigned long long			inputOffset;									/**< Offset of the first input byte not yet processed. */
+	unsigned long long			outputLength;									/**< Bytes written to the output so far. */
+	unsigned int				letterCounts[CaesarCipher::ALPHABET_LENGTH];	/**< Letters read so far, when cracking. */
+	std::ofstream				outputStream;									/**< Open output file. */
+	int							notificationDescriptor;							/**< inotify instance watching the input's directory, or -1. */
+
+};
+
+#endif
@@ -0,0 +1,547 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Directory listing reference from:	http://pubs.opengroup.org/onlinepubs/9699919799/functions/readdir.html
+ *										https://msdn.microsoft.com/en-us/library/windows/desktop/aa364418(v=vs.85).aspx
+ * Various function lookups from:		http://www.cplusplus.com/reference/fstream/fstream/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "FileSystem.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+// Method Definitions ********************************************************
+bool FileSystem::listFiles (const std::string& directory, std::vector<std::string>& relativePaths) {
+
+	relativePaths.clear ();
+
+	if (!listFilesRecursive (directory, "", relativePaths)) {
+
+		return false;
+
+	}
+
+	// Directory entries come back in no particular order; sorting keeps
+	// manifests and checkpoints stable between runs.
+	std::sort (relativePaths.begin (), relativePaths.end ());
+	return true;
+
+}
+
+//****************************************************************************
+bool FileSystem::getFileSize (const std::string& filename, unsigned long long& size) {
+
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+
+	if (!GetFileAttributesExA (filename.c_str (), GetFileExInfoStandard, &attributes)) {
+
+		return false;
+
+	}
+
+	size = (static_cast<unsigned long long> (attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+	return true;
+#else
+	struct stat status;
+
+	if (stat (filename.c_str (), &status) != 0) {
+
+		return false;
+
+	}
+
+	size = static_cast<unsigned long long> (status.st_size);
+	return true;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::getFileIdentity (const std::string& filename, unsigned long long& identity) {
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA (filename.c_str (), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
+	BY_HANDLE_FILE_INFORMATION information;
+	bool isIdentified = false;
+
+	if (file == INVALID_HANDLE_VALUE) {
+
+		return false;
+
+	}
+
+	isIdentified = GetFileInformationByHandle (file, &information) != FALSE;
+	CloseHandle (file);
+
+	if (isIdentified) {
+
+		identity = (static_cast<unsigned long long> (information.nFileIndexHigh) << 32) | information.nFileIndexLow;
+
+	}
+
+	return isIdentified;
+#else
+	struct stat status;
+
+	if (stat (filename.c_str (), &status) != 0) {
+
+		return false;
+
+	}
+
+	identity = static_cast<unsigned long long> (status.st_ino);
+	return true;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::resizeFile (const std::string& filename, const unsigned long long size) {
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA (filename.c_str (), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	LARGE_INTEGER distance;
+	bool isResized = false;
+
+	if (file == INVALID_HANDLE_VALUE) {
+
+		return false;
+
+	}
+
+	distance.QuadPart = static_cast<LONGLONG> (size);
+	isResized = SetFilePointerEx (file, distance, NULL, FILE_BEGIN) != FALSE && SetEndOfFile (file) != FALSE;
+	CloseHandle (file);
+
+	return isResized;
+#else
+	return truncate (filename.c_str (), static_cast<off_t> (size)) == 0;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::makeDirectories (const std::string& path) {
+
+	std::string::size_type separatorIndex = 0;
+
+	if (path.empty ()) {
+
+		return true;
+
+	}
+
+	// Create each ancestor in turn, skipping a leading separator so that
+	// absolute paths do not attempt to create the root.
+	while ((separatorIndex = path.find_first_of ("/\\", separatorIndex + 1)) != std::string::npos) {
+
+		if (!makeDirectory (path.substr (0, separatorIndex))) {
+
+			return false;
+
+		}
+
+	}
+
+	return makeDirectory (path);
+
+}
+
+//****************************************************************************
+bool FileSystem::createFile (const std::string& filename, const unsigned long long size) {
+
+	std::ofstream outputStream;
+
+	try {
+
+		outputStream.open (filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!outputStream.good ()) {
+
+			return false;
+
+		}
+
+		// Writing the final byte extends the file to its full size.
+		if (size > 0) {
+
+			outputStream.seekp (static_cast<std::streamoff> (size - 1));
+			outputStream.put ('\0');
+
+		}
+
+		outputStream.close ();
+		return !outputStream.fail ();
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+}
+
+//****************************************************************************
+bool FileSystem::writeFile (const std::string& filename, const std::string& contents) {
+
+	std::ofstream outputStream;
+
+	try {
+
+		outputStream.open (filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!outputStream.good ()) {
+
+			return false;
+
+		}
+
+		outputStream.write (contents.data (), static_cast<std::streamsize> (contents.length ()));
+		outputStream.close ();
+
+		return !outputStream.fail ();
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+}
+
+//****************************************************************************
+bool FileSystem::readFileRange (const std::string& filename, const unsigned long long offset, const unsigned long long length, std::string& contents) {
+
+	std::ifstream inputStream;
+
+	try {
+
+		inputStream.open (filename, std::ios::in | std::ios::binary);
+
+		if (!inputStream.good ()) {
+
+			return false;
+
+		}
+
+		contents.resize (static_cast<std::string::size_type> (length));
+		inputStream.seekg (static_cast<std::streamoff> (offset));
+
+		if (length > 0) {
+
+			inputStream.read (&contents[0], static_cast<std::streamsize> (length));
+
+		}
+
+		return static_cast<unsigned long long> (inputStream.gcount ()) == length || length == 0;
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+}
+
+//****************************************************************************
+bool FileSystem::writeFileRange (const std::string& filename, const unsigned long long offset, const std::string& contents) {
+
+	std::fstream outputStream;
+
+	try {
+
+		outputStream.open (filename, std::ios::in | std::ios::out | std::ios::binary);
+
+		if (!outputStream.good ()) {
+
+			return false;
+
+		}
+
+		outputStream.seekp (static_cast<std::streamoff> (offset));
+		outputStream.write (contents.data (), static_cast<std::streamsize> (contents.length ()));
+		outputStream.close ();
+
+		return !outputStream.fail ();
+
+	} catch (...) {
+
+		return false;
+
+	}
+
+}
+
+//****************************************************************************
+bool FileSystem::getModificationTime (const std::string& filename, long long& modificationTime) {
+
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	unsigned long long fileTime = 0;
+
+	if (!GetFileAttributesExA (filename.c_str (), GetFileExInfoStandard, &attributes)) {
+
+		return false;
+
+	}
+
+	// FILETIME counts 100ns intervals since 1601.
+	fileTime = (static_cast<unsigned long long> (attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+	modificationTime = static_cast<long long> (fileTime / 10000000ULL) - 11644473600LL;
+	return true;
+#else
+	struct stat status;
+
+	if (stat (filename.c_str (), &status) != 0) {
+
+		return false;
+
+	}
+
+	modificationTime = static_cast<long long> (status.st_mtime);
+	return true;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::touchFile (const std::string& filename) {
+
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileA (filename.c_str (), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, 0, nullptr);
+	FILETIME now;
+	BOOL touched = FALSE;
+
+	if (fileHandle == INVALID_HANDLE_VALUE) {
+
+		return false;
+
+	}
+
+	GetSystemTimeAsFileTime (&now);
+	touched = SetFileTime (fileHandle, nullptr, nullptr, &now);
+	CloseHandle (fileHandle);
+
+	return touched != FALSE;
+#else
+	return utime (filename.c_str (), nullptr) == 0;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::replaceFile (const std::string& sourceFilename, const std::string& destinationFilename) {
+
+#ifdef _WIN32
+	return MoveFileExA (sourceFilename.c_str (), destinationFilename.c_str (), MOVEFILE_REPLACE_EXISTING) != FALSE;
+#else
+	return std::rename (sourceFilename.c_str (), destinationFilename.c_str ()) == 0;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::removeFile (const std::string& filename) {
+
+#ifdef _WIN32
+	return DeleteFileA (filename.c_str ()) != FALSE;
+#else
+	return std::remove (filename.c_str ()) == 0;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::removeDirectory (const std::string& path) {
+
+#ifdef _WIN32
+	return RemoveDirectoryA (path.c_str ()) != FALSE;
+#else
+	return rmdir (path.c_str ()) == 0;
+#endif
+
+}
+
+//****************************************************************************
+unsigned long FileSystem::getProcessId (void) {
+
+#ifdef _WIN32
+	return static_cast<unsigned long> (GetCurrentProcessId ());
+#else
+	return static_cast<unsigned long> (getpid ());
+#endif
+
+}
+
+//****************************************************************************
+std::string FileSystem::joinPath (const std::string& directory, const std::string& name) {
+
+	if (directory.empty ()) {
+
+		return name;
+
+	}
+
+	if (directory[directory.length () - 1] == '/' || directory[directory.length () - 1] == '\\') {
+
+		return directory + name;
+
+	}
+
+	return directory + PATH_SEPARATOR + name;
+
+}
+
+//****************************************************************************
+std::string FileSystem::getParentDirectory (const std::string& path) {
+
+	std::string::size_type separatorIndex = path.find_last_of ("/\\");
+
+	if (separatorIndex == std::string::npos) {
+
+		return "";
+
+	}
+
+	return path.substr (0, separatorIndex);
+
+}
+
+//****************************************************************************
+bool FileSystem::listFilesRecursive (const std::string& root, const std::string& relativeDirectory, std::vector<std::string>& relativePaths) {
+
+	const std::string directory = joinPath (root, relativeDirectory);
+
+#ifdef _WIN32
+	WIN32_FIND_DATAA findData;
+	HANDLE findHandle = FindFirstFileA (joinPath (directory, "*").c_str (), &findData);
+
+	if (findHandle == INVALID_HANDLE_VALUE) {
+
+		return false;
+
+	}
+
+	do {
+
+		const std::string name = findData.cFileName;
+
+		if (name == "." || name == ".." || (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+
+			continue;
+
+		}
+
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+
+			listFilesRecursive (root, joinPath (relativeDirectory, name), relativePaths);
+
+		} else {
+
+			relativePaths.push_back (joinPath (relativeDirectory, name));
+
+		}
+
+	} while (FindNextFileA (findHandle, &findData));
+
+	FindClose (findHandle);
+	return true;
+#else
+	DIR* directoryHandle = opendir (directory.c_str ());
+	struct dirent* entry = nullptr;
+	struct stat status;
+
+	if (directoryHandle == nullptr) {
+
+		return false;
+
+	}
+
+	while ((entry = readdir (directoryHandle)) != nullptr) {
+
+		const std::string name = entry->d_name;
+
+		if (name == "." || name == "..") {
+
+			continue;
+
+		}
+
+		// lstat rather than stat so that symbolic links, which may form
+		// cycles, are neither followed nor listed.
+		if (lstat (joinPath (directory, name).c_str (), &status) != 0) {
+
+			continue;
+
+		}
+
+		if (S_ISDIR (status.st_mode)) {
+
+			listFilesRecursive (root, joinPath (relativeDirectory, name), relativePaths);
+
+		} else if (S_ISREG (status.st_mode)) {
+
+			relativePaths.push_back (joinPath (relativeDirectory, name));
+
+		}
+
+	}
+
+	closedir (directoryHandle);
+	return true;
+#endif
+
+}
+
+//****************************************************************************
+bool FileSystem::makeDirectory (const std::string& path) {
+
+#ifdef _WIN32
+	return CreateDirectoryA (path.c_str (), nullptr) || GetLastError () == ERROR_ALREADY_EXISTS;
+#else
+	return mkdir (path.c_str (), 0777) == 0 || errno == EEXIST;
+#endif
+
+}
+
+//****************************************************************************
+FileSystem::FileSystem (void) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+FileSystem::FileSystem (const FileSystem& fileSystem) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+FileSystem& FileSystem::operator= (const FileSystem& fileSystem) {
+
+	// Dummy
+	return *this;
+
+}
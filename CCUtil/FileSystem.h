@@ -0,0 +1,213 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Directory listing reference from:	http://pubs.opengroup.org/onlinepubs/9699919799/functions/readdir.html
+ *										https://msdn.microsoft.com/en-us/library/windows/desktop/aa364418(v=vs.85).aspx
+ * Various function lookups from:		http://www.cplusplus.com/reference/fstream/fstream/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <string>
+#include <vector>
+
+#ifndef FILE_SYSTEM_H
+#define FILE_SYSTEM_H
+
+/**
+ * Static class with portable utilities for walking directory trees and
+ * reading or writing byte ranges of files.
+ */
+class FileSystem {
+
+public:
+	// Public Static Constants ***********************************************
+	static const char PATH_SEPARATOR = '/';	/**< Separator used when joining paths. Accepted by both POSIX and Windows. */
+
+	// Public Methods ********************************************************
+	/**
+	 * Recursively lists every regular file beneath the given directory.
+	 * Symbolic links are not followed.
+	 * @param directory to walk.
+	 * @param relativePaths, where to store the path of each file relative to
+	 * directory. Cleared automatically at the start of the function call.
+	 * @return true if the directory could be walked, otherwise false.
+	 */
+	static bool listFiles (const std::string& directory, std::vector<std::string>& relativePaths);
+
+	/**
+	 * Determines the size of the given file.
+	 * @param filename of the file.
+	 * @param size, where to store the size of the file in bytes.
+	 * @return true if the size was determined, otherwise false.
+	 */
+	static bool getFileSize (const std::string& filename, unsigned long long& size);
+
+	/**
+	 * Determines a number that identifies the given file on its volume for as
+	 * long as it exists, however it is renamed. A path whose identity changes
+	 * now names a different file, such as after a log rotation.
+	 * @param filename of the file.
+	 * @param identity, where to store the identity.
+	 * @return true if the identity was determined, otherwise false.
+	 */
+	static bool getFileIdentity (const std::string& filename, unsigned long long& identity);
+
+	/**
+	 * Cuts the given file off at the given size, or extends it with zeros.
+	 * @param filename of the file, which must exist.
+	 * @param size of the file in bytes.
+	 * @return true if resized, otherwise false.
+	 */
+	static bool resizeFile (const std::string& filename, const unsigned long long size);
+
+	/**
+	 * Creates the given directory and any missing parent directories.
+	 * @param path of the directory to create.
+	 * @return true if the directory exists after the call, otherwise false.
+	 */
+	static bool makeDirectories (const std::string& path);
+
+	/**
+	 * Creates (or truncates) the given file and extends it to the given size
+	 * so that byte ranges may later be written to it in any order.
+	 * @param filename of the file to create.
+	 * @param size of the file in bytes.
+	 * @return true if created, otherwise false.
+	 */
+	static bool createFile (const std::string& filename, const unsigned long long size);
+
+	/**
+	 * Creates (or truncates) the given file and writes the given contents to it
+	 * without any newline translation.
+	 * @param filename of the file to write.
+	 * @param contents to write.
+	 * @return true if written, otherwise false.
+	 */
+	static bool writeFile (const std::string& filename, const std::string& contents);
+
+	/**
+	 * Reads a range of bytes from the given file.
+	 * @param filename of the file to read.
+	 * @param offset of the first byte to read.
+	 * @param length, number of bytes to read.
+	 * @param contents, where to store the bytes read.
+	 * @return true if every requested byte was read, otherwise false.
+	 */
+	static bool readFileRange (const std::string& filename, const unsigned long long offset, const unsigned long long length, std::string& contents);
+
+	/**
+	 * Overwrites a range of bytes of an existing file.
+	 * @param filename of the file to write.
+	 * @param offset of the first byte to write.
+	 * @param contents to write.
+	 * @return true if written, otherwise false.
+	 */
+	static bool writeFileRange (const std::string& filename, const unsigned long long offset, const std::string& contents);
+
+	/**
+	 * Determines when the given file was last modified.
+	 * @param filename of the file.
+	 * @param modificationTime, where to store the time in seconds since the epoch.
+	 * @return true if the time was determined, otherwise false.
+	 */
+	static bool getModificationTime (const std::string& filename, long long& modificationTime);
+
+	/**
+	 * Sets the modification time of the given file to now.
+	 * @param filename of the file.
+	 * @return true if updated, otherwise false.
+	 */
+	static bool touchFile (const std::string& filename);
+
+	/**
+	 * Renames a file, replacing any file already at the destination. On the
+	 * same volume the replacement is atomic, so readers see either the old
+	 * or the new file but never a partial one.
+	 * @param sourceFilename, current name of the file.
+	 * @param destinationFilename, new name of the file.
+	 * @return true if renamed, otherwise false.
+	 */
+	static bool replaceFile (const std::string& sourceFilename, const std::string& destinationFilename);
+
+	/**
+	 * Deletes the given file.
+	 * @param filename of the file.
+	 * @return true if deleted, otherwise false.
+	 */
+	static bool removeFile (const std::string& filename);
+
+	/**
+	 * Deletes the given directory, which must be empty.
+	 * @param path of the directory.
+	 * @return true if deleted, otherwise false.
+	 */
+	static bool removeDirectory (const std::string& path);
+
+	/**
+	 * Returns an identifier of the running process, used to keep temporary
+	 * filenames of concurrent processes apart.
+	 * @return the process identifier.
+	 */
+	static unsigned long getProcessId (void);
+
+	/**
+	 * Joins two paths with the path separator.
+	 * @param directory, the leading path. May be empty.
+	 * @param name, the trailing path.
+	 * @return the joined path.
+	 */
+	static std::string joinPath (const std::string& directory, const std::string& name);
+
+	/**
+	 * Returns the directory portion of the given path.
+	 * @param path to examine.
+	 * @return everything before the last path separator, or an empty string
+	 * if the path has no directory portion.
+	 */
+	static std::string getParentDirectory (const std::string& path);
+
+private:
+	// Private Methods *******************************************************
+	/**
+	 * Appends every regular file beneath the given directory to the given list.
+	 * @param root directory of the walk.
+	 * @param relativeDirectory, the directory currently being walked relative to root.
+	 * @param relativePaths, where to append the path of each file relative to root.
+	 * @return true if the directory could be walked, otherwise false.
+	 */
+	static bool listFilesRecursive (const std::string& root, const std::string& relativeDirectory, std::vector<std::string>& relativePaths);
+
+	/**
+	 * Creates a single directory.
+	 * @param path of the directory to create.
+	 * @return true if the directory exists after the call, otherwise false.
+	 */
+	static bool makeDirectory (const std::string& path);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	FileSystem (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param fileSystem to copy from.
+	 */
+	FileSystem (const FileSystem& fileSystem);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param fileSystem to copy from.
+	 * @return this FileSystem.
+	 */
+	FileSystem& operator= (const FileSystem& fileSystem);
+
+};
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Various function lookups from:	http://www.cplusplus.com/reference/future/future/
+ *									http://www.cplusplus.com/reference/future/promise/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include "CaesarCipher.h"
+#include "JobRunner.h"
+#include "WorkStealingPool.h"
+
+// Method Definitions ********************************************************
+JobRunner::CancellationToken::CancellationToken (void) :
+	cancelled (std::make_shared<std::atomic<bool> > (false)) {
+
+}
+
+//****************************************************************************
+void JobRunner::CancellationToken::cancel (void) {
+
+	*cancelled = true;
+
+}
+
+//****************************************************************************
+bool JobRunner::CancellationToken::isCancelled (void) const {
+
+	return *cancelled;
+
+}
+
+//****************************************************************************
+JobRunner::JobRunner (WorkStealingPool& pool) :
+	pool (pool),
+	chunkSize (DEFAULT_CHUNK_SIZE) {
+
+}
+
+//****************************************************************************
+void JobRunner::setChunkSize (const std::size_t chunkSize) {
+
+	this->chunkSize = chunkSize;
+
+}
+
+//****************************************************************************
+std::future<JobRunner::Result> JobRunner::submit (const Operation operation, std::string input, const unsigned int key, const CancellationToken& token, const ProgressCallback& progress) {
+
+	// Tasks must be copyable, which neither the promise nor a moved input is,
+	// so both are shared with the task instead.
+	const std::shared_ptr<std::promise<Result> > promise = std::make_shared<std::promise<Result> > ();
+	const std::shared_ptr<const std::string> sharedInput = std::make_shared<const std::string> (std::move (input));
+	const std::size_t jobChunkSize = chunkSize;
+
+	pool.submit ([operation, sharedInput, key, jobChunkSize, token, progress, promise] (void) {
+
+		// Caught here rather than by the pool, so that one job's failure
+		// reaches its own future and no other.
+		try {
+
+			promise->set_value (run (operation, *sharedInput, key, jobChunkSize, token, progress));
+
+		} catch (...) {
+
+			promise->set_exception (std::current_exception ());
+
+		}
+
+	});
+
+	return promise->get_future ();
+
+}
+
+//****************************************************************************
+JobRunner::Result JobRunner::run (const Operation operation, const std::string& input, const unsigned int key, const std::size_t chunkSize, const CancellationToken& token, const ProgressCallback& progress) {
+
+	const std::size_t length = input.length ();
+	const unsigned int passCount = (operation == BRUTE_FORCE) ? CaesarCipher::ALPHABET_LENGTH : 1;
+	const unsigned long long total = static_cast<unsigned long long> (length) * ((operation == CRACK) ? 2 : passCount);
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH] = {};
+	unsigned int chunkCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned long long processed = 0;
+	Result result;
+
+	result.key = key % CaesarCipher::ALPHABET_LENGTH;
+	result.isCancelled = false;
+
+	// Cracking reads the input twice: once to count its letters, and once to
+	// decipher it with the key they point to.
+	for (std::size_t offset = 0; operation == CRACK && offset < length; offset += chunkSize) {
+
+		const std::size_t count = (length - offset < chunkSize) ? length - offset : chunkSize;
+
+		if (token.isCancelled ()) {
+
+			result.isCancelled = true;
+			return result;
+
+		}
+
+		CaesarCipher::countLetters (input.data () + offset, count, chunkCounts);
+
+		for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+			letterCounts[i] += chunkCounts[i];
+
+		}
+
+		processed += count;
+
+		if (progress) {
+
+			progress (processed, total);
+
+		}
+
+	}
+
+	if (operation == CRACK) {
+
+		result.key = CaesarCipher::crackKey (letterCounts);
+
+	}
+
+	result.output.resize ((operation == BRUTE_FORCE) ? passCount * (length + 1) : length);
+
+	for (unsigned int pass = 0; pass < passCount; pass++) {
+
+		const unsigned int passKey = (operation == BRUTE_FORCE) ? pass : result.key;
+		char* const passOutput = &result.output[0] + pass * (length + 1);
+
+		for (std::size_t offset = 0; offset < length; offset += chunkSize) {
+
+			const std::size_t count = (length - offset < chunkSize) ? length - offset : chunkSize;
+
+			if (token.isCancelled ()) {
+
+				result.output.clear ();
+				result.isCancelled = true;
+				return result;
+
+			}
+
+			if (operation == ENCIPHER) {
+
+				CaesarCipher::encipher (input.data () + offset, count, passKey, passOutput + offset);
+
+			} else {
+
+				CaesarCipher::decipher (input.data () + offset, count, passKey, passOutput + offset);
+
+			}
+
+			processed += count;
+
+			if (progress) {
+
+				progress (processed, total);
+
+			}
+
+		}
+
+		if (operation == BRUTE_FORCE) {
+
+			passOutput[length] = '\n';
+
+		}
+
+	}
+
+	return result;
+
+}
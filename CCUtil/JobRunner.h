@@ -0,0 +1,164 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Various function lookups from:	http://www.cplusplus.com/reference/future/future/
+ *									http://www.cplusplus.com/reference/future/promise/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include "WorkStealingPool.h"
+
+#ifndef JOB_RUNNER_H
+#define JOB_RUNNER_H
+
+/**
+ * Runs enciphering, deciphering, cracking and brute forcing as jobs on a
+ * shared pool, for callers such as services that must not block on a large
+ * input. Submitting a job returns at once with a future for its result. A job
+ * works through its input a chunk at a time, reporting progress and checking
+ * for cancellation between chunks, so a cancelled job stops within a chunk.
+ * Each job runs on a single worker, so any number of jobs may be submitted to
+ * a pool of a few threads and at most that many run at once.
+ */
+class JobRunner {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Operations a job can apply to its input.
+	 */
+	enum Operation {
+
+		ENCIPHER,		/**< Encipher with the given key. */
+		DECIPHER,		/**< Decipher with the given key. */
+		CRACK,			/**< Estimate the key and decipher with it. */
+		BRUTE_FORCE		/**< Decipher with every key. */
+
+	};
+
+	/**
+	 * Outcome of a job.
+	 */
+	struct Result {
+
+		std::string		output;			/**< The processed input. When brute forcing, the plaintext of every key in turn, each followed by a newline. Empty if cancelled. */
+		unsigned int	key;			/**< Key used, or found when cracking. */
+		bool			isCancelled;	/**< Whether the job stopped early because it was cancelled. */
+
+	};
+
+	/**
+	 * Flag shared by every copy of a token, set to ask the jobs given the
+	 * token to stop. Tokens may be copied and cancelled from any thread.
+	 */
+	class CancellationToken {
+
+	public:
+		/**
+		 * Creates a token that is not cancelled.
+		 */
+		CancellationToken (void);
+
+		/**
+		 * Asks every job given this token, or a copy of it, to stop.
+		 */
+		void cancel (void);
+
+		/**
+		 * Returns whether the token was cancelled.
+		 * @return true if cancelled, otherwise false.
+		 */
+		bool isCancelled (void) const;
+
+	private:
+		std::shared_ptr<std::atomic<bool> >	cancelled;	/**< Flag shared by every copy. */
+
+	};
+
+	/**
+	 * Called after each chunk with the bytes processed so far and the bytes
+	 * the job will process in all. Called from the worker running the job.
+	 */
+	typedef std::function<void (const unsigned long long processed, const unsigned long long total)> ProgressCallback;
+
+	// Public Static Constants ***********************************************
+	static const std::size_t DEFAULT_CHUNK_SIZE = 1 << 20;	/**< Bytes processed between progress reports and cancellation checks. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Prepares to run jobs on a pool. The pool must outlive every job.
+	 * @param pool to run jobs on, which may be shared with other work.
+	 */
+	explicit JobRunner (WorkStealingPool& pool);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Sets how many bytes jobs submitted from now on process between progress
+	 * reports and cancellation checks.
+	 * @param chunkSize in bytes. Must not be zero.
+	 */
+	void setChunkSize (const std::size_t chunkSize);
+
+	// Public Methods ********************************************************
+	/**
+	 * Queues a job on the pool. Never blocks. Waiting on the future from a
+	 * task of the same pool may deadlock if every worker is waiting.
+	 * @param operation to apply.
+	 * @param input to process, moved into the job.
+	 * @param key to encipher or decipher with. Ignored when cracking or brute
+	 * forcing.
+	 * @param token to cancel the job with.
+	 * @param progress to report progress to. May be empty.
+	 * @return a future for the result. Rethrows anything thrown by the job or
+	 * by the progress callback.
+	 */
+	std::future<Result> submit (const Operation operation, std::string input, const unsigned int key, const CancellationToken& token, const ProgressCallback& progress);
+
+private:
+	// Private Methods *******************************************************
+	/**
+	 * Runs a job to completion or cancellation on the calling thread.
+	 * @param operation to apply.
+	 * @param input to process.
+	 * @param key to encipher or decipher with.
+	 * @param chunkSize, bytes processed between checks.
+	 * @param token to check for cancellation.
+	 * @param progress to report progress to. May be empty.
+	 * @return the result.
+	 * @throw logic_error if cracking and a letter in the alphabet has a
+	 * frequency of zero.
+	 */
+	static Result run (const Operation operation, const std::string& input, const unsigned int key, const std::size_t chunkSize, const CancellationToken& token, const ProgressCallback& progress);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the runner from being copied.
+	 * @param jobRunner to copy from.
+	 */
+	JobRunner (const JobRunner& jobRunner);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the runner from being copied.
+	 * @param jobRunner to copy from.
+	 * @return this JobRunner.
+	 */
+	JobRunner& operator= (const JobRunner& jobRunner);
+
+	// Private Members *******************************************************
+	WorkStealingPool&	pool;		/**< Pool jobs run on. */
+	std::size_t			chunkSize;	/**< Bytes processed between checks. */
+
+};
+
+#endif
@@ -0,0 +1,392 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Cross-correlation from:			https://en.wikipedia.org/wiki/Cross-correlation
+ * Cosine similarity from:			https://en.wikipedia.org/wiki/Cosine_similarity
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "KeyClusterer.h"
+#include "WorkStealingPool.h"
+
+// Method Definitions ********************************************************
+void KeyClusterer::countLines (const std::string& text, WorkStealingPool& pool, std::vector<std::size_t>& lineStarts, std::vector<Histogram>& histograms) {
+
+	const std::size_t batchSize = BATCH_SIZE;
+	const char* const data = text.data ();
+	const char* newline = nullptr;
+	std::size_t lineStart = 0;
+
+	lineStarts.clear ();
+
+	while (lineStart < text.length ()) {
+
+		lineStarts.push_back (lineStart);
+		newline = static_cast<const char*> (memchr (data + lineStart, '\n', text.length () - lineStart));
+		lineStart = (newline != nullptr) ? static_cast<std::size_t> (newline - data) + 1 : text.length ();
+
+	}
+
+	histograms.resize (lineStarts.size ());
+
+	// Each task writes only its own batch of histograms, so no locking is
+	// needed.
+	for (std::size_t batchStart = 0; batchStart < lineStarts.size (); batchStart += batchSize) {
+
+		pool.submit ([&text, &lineStarts, &histograms, batchStart, batchSize] (void) {
+
+			const std::size_t batchEnd = std::min (batchStart + batchSize, lineStarts.size ());
+			std::size_t lineEnd = 0;
+
+			for (std::size_t i = batchStart; i < batchEnd; i++) {
+
+				lineEnd = (i + 1 < lineStarts.size ()) ? lineStarts[i + 1] : text.length ();
+				histograms[i].letterTotal = CaesarCipher::countLetters (text.data () + lineStarts[i], lineEnd - lineStarts[i], histograms[i].letterCounts);
+
+			}
+
+		});
+
+	}
+
+	pool.wait ();
+
+}
+
+//****************************************************************************
+void KeyClusterer::scoreShifts (const unsigned int messageCounts[CaesarCipher::ALPHABET_LENGTH], const unsigned int clusterCounts[CaesarCipher::ALPHABET_LENGTH], double similarities[CaesarCipher::ALPHABET_LENGTH]) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	double messageValues[ALPHABET_LENGTH];
+	double clusterValues[ALPHABET_LENGTH * 2];
+	double messageNorm = 0.0;
+	double clusterNorm = 0.0;
+	double runningSum = 0.0;
+
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		messageValues[i] = static_cast<double> (messageCounts[i]);
+		clusterValues[i] = static_cast<double> (clusterCounts[i]);
+		clusterValues[i + ALPHABET_LENGTH] = clusterValues[i];
+		messageNorm += messageValues[i] * messageValues[i];
+		clusterNorm += clusterValues[i] * clusterValues[i];
+
+	}
+
+	messageNorm = std::sqrt (messageNorm) * std::sqrt (clusterNorm);
+
+	for (unsigned int shift = 0; shift < ALPHABET_LENGTH; shift++) {
+
+		runningSum = 0.0;
+
+		for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+			runningSum += messageValues[i] * clusterValues[shift + i];
+
+		}
+
+		similarities[shift] = (messageNorm != 0.0) ? runningSum / messageNorm : 0.0;
+
+	}
+
+}
+
+//****************************************************************************
+void KeyClusterer::cluster (const std::vector<Histogram>& histograms, WorkStealingPool& pool, std::vector<Cluster>& clusters, std::vector<unsigned int>& assignments) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const std::size_t batchSize = BATCH_SIZE;
+	const unsigned int unclustered = UNCLUSTERED;
+	std::vector<std::size_t> order (histograms.size ());
+	std::vector<unsigned int> keyClusters (ALPHABET_LENGTH, unclustered);
+	std::vector<Cluster> larger;
+	std::vector<unsigned int> byLetters;
+	std::vector<unsigned int> targets;
+	std::size_t message = 0;
+	unsigned int best = 0;
+
+	clusters.clear ();
+	assignments.assign (histograms.size (), unclustered);
+
+	for (std::size_t i = 0; i < order.size (); i++) {
+
+		order[i] = i;
+
+	}
+
+	// Longer messages first, since their histograms are the most telling and
+	// make the best seeds.
+	std::stable_sort (order.begin (), order.end (), [&histograms] (const std::size_t left, const std::size_t right) {
+
+		return histograms[left].letterTotal > histograms[right].letterTotal;
+
+	});
+
+	for (std::size_t i = 0; i < order.size (); i++) {
+
+		message = order[i];
+
+		if (histograms[message].letterTotal != 0) {
+
+			best = findCluster (histograms[message].letterCounts, clusters, UNCLUSTERED);
+
+			if (best == UNCLUSTERED) {
+
+				best = static_cast<unsigned int> (clusters.size ());
+				clusters.push_back (Cluster ());
+				memset (clusters[best].letterCounts, 0, sizeof (clusters[best].letterCounts));
+
+			}
+
+			for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+				clusters[best].letterCounts[letter] += histograms[message].letterCounts[letter];
+
+			}
+
+			assignments[message] = best;
+
+		}
+
+	}
+
+	rebuildClusters (histograms, clusters, assignments);
+
+	for (unsigned int pass = 0; pass < REFINEMENT_PASSES; pass++) {
+
+		// The clusters are only read while messages are reassigned, and each
+		// task writes only its own batch of assignments.
+		for (std::size_t batchStart = 0; batchStart < histograms.size (); batchStart += batchSize) {
+
+			pool.submit ([&histograms, &clusters, &assignments, batchStart, batchSize] (void) {
+
+				const std::size_t batchEnd = std::min (batchStart + batchSize, histograms.size ());
+				unsigned int found = 0;
+
+				for (std::size_t i = batchStart; i < batchEnd; i++) {
+
+					if (histograms[i].letterTotal != 0) {
+
+						found = findCluster (histograms[i].letterCounts, clusters, assignments[i]);
+
+						if (found != UNCLUSTERED) {
+
+							assignments[i] = found;
+
+						}
+
+					}
+
+				}
+
+			});
+
+		}
+
+		pool.wait ();
+		rebuildClusters (histograms, clusters, assignments);
+
+	}
+
+	// Clusters whose pooled histograms line up at no shift share a key, and
+	// pooled histograms are far steadier than those of single messages. Each
+	// cluster, from the one with fewest letters up, merges into the larger
+	// cluster it lines up with best, if any.
+	byLetters.resize (clusters.size ());
+	targets.resize (clusters.size ());
+
+	for (unsigned int i = 0; i < clusters.size (); i++) {
+
+		byLetters[i] = i;
+		targets[i] = i;
+
+	}
+
+	std::stable_sort (byLetters.begin (), byLetters.end (), [&clusters] (const unsigned int left, const unsigned int right) {
+
+		return clusters[left].letterTotal < clusters[right].letterTotal;
+
+	});
+
+	for (unsigned int i = 0; i < byLetters.size (); i++) {
+
+		larger.clear ();
+
+		for (unsigned int j = i + 1; j < byLetters.size (); j++) {
+
+			larger.push_back (clusters[byLetters[j]]);
+
+		}
+
+		best = findCluster (clusters[byLetters[i]].letterCounts, larger, UNCLUSTERED);
+
+		if (best != UNCLUSTERED) {
+
+			best = byLetters[i + 1 + best];
+			targets[byLetters[i]] = best;
+
+			for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+				clusters[best].letterCounts[letter] += clusters[byLetters[i]].letterCounts[letter];
+
+			}
+
+		}
+
+	}
+
+	for (std::size_t i = 0; i < assignments.size (); i++) {
+
+		if (assignments[i] != UNCLUSTERED) {
+
+			while (targets[assignments[i]] != assignments[i]) {
+
+				assignments[i] = targets[assignments[i]];
+
+			}
+
+		}
+
+	}
+
+	rebuildClusters (histograms, clusters, assignments);
+
+	// Clusters that cracked to the same key were split by noise in short
+	// messages, and are merged into the first of them.
+	for (std::size_t i = 0; i < assignments.size (); i++) {
+
+		if (assignments[i] != UNCLUSTERED) {
+
+			best = clusters[assignments[i]].key;
+
+			if (keyClusters[best] == UNCLUSTERED) {
+
+				keyClusters[best] = assignments[i];
+
+			}
+
+			assignments[i] = keyClusters[best];
+
+		}
+
+	}
+
+	rebuildClusters (histograms, clusters, assignments);
+
+}
+
+//****************************************************************************
+unsigned int KeyClusterer::findCluster (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], const std::vector<Cluster>& clusters, const unsigned int ownCluster) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	unsigned int otherCounts[ALPHABET_LENGTH];
+	double similarities[ALPHABET_LENGTH];
+	double bestSimilarity = -1.0;
+	unsigned int best = UNCLUSTERED;
+	bool isAligned = false;
+
+	for (unsigned int i = 0; i < clusters.size (); i++) {
+
+		if (i == ownCluster) {
+
+			// Left out of its own cluster, a message is judged by the others
+			// alone rather than partly agreeing with itself.
+			for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+				otherCounts[letter] = clusters[i].letterCounts[letter] - letterCounts[letter];
+
+			}
+
+			scoreShifts (letterCounts, otherCounts, similarities);
+
+		} else {
+
+			scoreShifts (letterCounts, clusters[i].letterCounts, similarities);
+
+		}
+
+		isAligned = true;
+
+		for (unsigned int shift = 1; shift < ALPHABET_LENGTH; shift++) {
+
+			if (similarities[shift] > similarities[0]) {
+
+				isAligned = false;
+
+			}
+
+		}
+
+		if (isAligned && similarities[0] > bestSimilarity) {
+
+			bestSimilarity = similarities[0];
+			best = i;
+
+		}
+
+	}
+
+	return best;
+
+}
+
+//****************************************************************************
+void KeyClusterer::rebuildClusters (const std::vector<Histogram>& histograms, std::vector<Cluster>& clusters, std::vector<unsigned int>& assignments) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const unsigned int unclustered = UNCLUSTERED;
+	std::vector<unsigned int> renumbering (clusters.size (), unclustered);
+	std::vector<Cluster> rebuilt;
+	unsigned int index = 0;
+
+	// Clusters are renumbered in order of their first message, so the result
+	// does not depend on the order clusters were made in.
+	for (std::size_t i = 0; i < assignments.size (); i++) {
+
+		if (assignments[i] != UNCLUSTERED) {
+
+			if (renumbering[assignments[i]] == UNCLUSTERED) {
+
+				renumbering[assignments[i]] = static_cast<unsigned int> (rebuilt.size ());
+				rebuilt.push_back (Cluster ());
+				memset (rebuilt.back ().letterCounts, 0, sizeof (rebuilt.back ().letterCounts));
+				rebuilt.back ().letterTotal = 0;
+				rebuilt.back ().messageCount = 0;
+
+			}
+
+			index = renumbering[assignments[i]];
+			assignments[i] = index;
+			rebuilt[index].letterTotal += histograms[i].letterTotal;
+			rebuilt[index].messageCount++;
+
+			for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+				rebuilt[index].letterCounts[letter] += histograms[i].letterCounts[letter];
+
+			}
+
+		}
+
+	}
+
+	for (std::size_t i = 0; i < rebuilt.size (); i++) {
+
+		rebuilt[i].key = CaesarCipher::crackKey (rebuilt[i].letterCounts);
+
+	}
+
+	clusters.swap (rebuilt);
+
+}
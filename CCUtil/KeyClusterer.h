@@ -0,0 +1,146 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Cross-correlation from:			https://en.wikipedia.org/wiki/Cross-correlation
+ * Cosine similarity from:			https://en.wikipedia.org/wiki/Cosine_similarity
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "WorkStealingPool.h"
+
+#ifndef KEY_CLUSTERER_H
+#define KEY_CLUSTERER_H
+
+/**
+ * Static class that cracks many short messages enciphered under a few keys.
+ * A message of a few dozen letters has too few for its own histogram to
+ * point to its key, but messages sharing a key have histograms that line up
+ * with no shift between them, while messages under different keys line up
+ * best at some other shift. Messages are clustered on that, and each cluster
+ * is cracked on the pooled histogram of all its messages.
+ */
+class KeyClusterer {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Letters of one message.
+	 */
+	struct Histogram {
+
+		unsigned int	letterCounts[CaesarCipher::ALPHABET_LENGTH];	/**< Number of times each letter occurs. */
+		unsigned int	letterTotal;									/**< Number of letters. */
+
+	};
+
+	/**
+	 * Messages taken to share a key.
+	 */
+	struct Cluster {
+
+		unsigned int		letterCounts[CaesarCipher::ALPHABET_LENGTH];	/**< Pooled letter counts of every message in the cluster. */
+		unsigned int		key;										/**< Key cracked from the pooled counts. */
+		unsigned long long	letterTotal;								/**< Number of letters in every message of the cluster. */
+		std::size_t			messageCount;								/**< Number of messages in the cluster. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int UNCLUSTERED = 0xFFFFFFFF;		/**< Cluster of messages without letters. */
+	static const std::size_t BATCH_SIZE = 4096;				/**< Number of lines counted by each task. */
+
+	// Public Methods ********************************************************
+	/**
+	 * Counts the letters of every line of a text, one batch of lines per task.
+	 * A final newline does not start another line.
+	 * @param text, one message per line.
+	 * @param pool to count batches on.
+	 * @param lineStarts, where to store the offset of each line.
+	 * @param histograms, where to store the histogram of each line.
+	 */
+	static void countLines (const std::string& text, WorkStealingPool& pool, std::vector<std::size_t>& lineStarts, std::vector<Histogram>& histograms);
+
+	/**
+	 * Measures how well a message's histogram lines up with a cluster's at
+	 * each relative shift, as the cosine similarity of the message counts and
+	 * the cluster counts rotated by the shift. The cluster counts are laid out
+	 * twice in a row so that every rotation is a contiguous window and the
+	 * inner loop vectorizes.
+	 * @param messageCounts, letter counts of the message.
+	 * @param clusterCounts, letter counts of the cluster.
+	 * @param similarities, where to store the similarity at each shift, from
+	 * zero, where a message under the cluster's key scores best, to one.
+	 */
+	static void scoreShifts (const unsigned int messageCounts[CaesarCipher::ALPHABET_LENGTH], const unsigned int clusterCounts[CaesarCipher::ALPHABET_LENGTH], double similarities[CaesarCipher::ALPHABET_LENGTH]);
+
+	/**
+	 * Clusters messages by key and cracks each cluster. Messages join, from
+	 * the longest down, the cluster they line up with best among those they
+	 * line up with at no shift, or else start a cluster of their own. Every
+	 * message is then reassigned against the pooled histograms, in parallel.
+	 * Clusters whose pooled histograms line up at no shift are merged, and
+	 * finally so are clusters that cracked to the same key.
+	 * @param histograms of the messages.
+	 * @param pool to reassign messages on.
+	 * @param clusters, where to store the clusters.
+	 * @param assignments, where to store the cluster of each message, or
+	 * UNCLUSTERED if it has no letters.
+	 */
+	static void cluster (const std::vector<Histogram>& histograms, WorkStealingPool& pool, std::vector<Cluster>& clusters, std::vector<unsigned int>& assignments);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int REFINEMENT_PASSES = 2;	/**< Times every message is reassigned against the pooled histograms. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Finds the cluster a histogram lines up with best at no shift, among the
+	 * clusters it lines up with better at no shift than at any other.
+	 * @param letterCounts of a message or of a cluster.
+	 * @param clusters to choose from.
+	 * @param ownCluster, the cluster a message is in, scored without the
+	 * message, or UNCLUSTERED.
+	 * @return the index of the cluster, or UNCLUSTERED if there is none.
+	 */
+	static unsigned int findCluster (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], const std::vector<Cluster>& clusters, const unsigned int ownCluster);
+
+	/**
+	 * Rebuilds every cluster's pooled counts from the assignments, drops the
+	 * clusters left empty, and cracks the rest.
+	 * @param histograms of the messages.
+	 * @param clusters to rebuild.
+	 * @param assignments of the messages, renumbered if clusters are dropped.
+	 */
+	static void rebuildClusters (const std::vector<Histogram>& histograms, std::vector<Cluster>& clusters, std::vector<unsigned int>& assignments);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	KeyClusterer (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param keyClusterer to copy from.
+	 */
+	KeyClusterer (const KeyClusterer& keyClusterer);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param keyClusterer to copy from.
+	 * @return this KeyClusterer.
+	 */
+	KeyClusterer& operator= (const KeyClusterer& keyClusterer);
+
+};
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Various function lookups from:	http://www.cplusplus.com/reference/fstream/ofstream/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "KeyFanOut.h"
+#include "WorkStealingPool.h"
+
+// Method Definitions ********************************************************
+std::string KeyFanOut::getOutputName (const unsigned int key) {
+
+	return "key_" + std::to_string (key % CaesarCipher::ALPHABET_LENGTH) + ".txt";
+
+}
+
+//****************************************************************************
+bool KeyFanOut::encipher (const char* const text, const std::size_t length, const std::vector<unsigned int>& keys, const std::vector<std::string>& filenames, const std::size_t chunkSize, WorkStealingPool& pool) {
+
+	std::vector<Sink> sinks (keys.size ());
+	std::size_t count = 0;
+	bool succeeded = true;
+
+	for (std::size_t i = 0; i < sinks.size (); i++) {
+
+		sinks[i].stream.open (filenames[i], std::ios::out | std::ios::binary | std::ios::trunc);
+		sinks[i].buffer.resize ((length < chunkSize) ? length : chunkSize);
+		sinks[i].failed = !sinks[i].stream.good ();
+
+	}
+
+	// Every key translates the same chunk before the sweep moves on, so the
+	// chunk is read from memory once and from cache by every other key. The
+	// translation kernels keep each key's table in registers, so a chunk is
+	// translated about as fast as it can be written.
+	for (std::size_t offset = 0; offset < length; offset += chunkSize) {
+
+		count = (length - offset < chunkSize) ? length - offset : chunkSize;
+
+		for (std::size_t i = 0; i < sinks.size (); i++) {
+
+			Sink& sink = sinks[i];
+			const unsigned int key = keys[i];
+
+			pool.submit ([text, offset, count, key, &sink] (void) {
+
+				if (!sink.failed) {
+
+					CaesarCipher::encipher (text + offset, count, key, sink.buffer.data ());
+					sink.stream.write (sink.buffer.data (), static_cast<std::streamsize> (count));
+					sink.failed = !sink.stream.good ();
+
+				}
+
+			});
+
+		}
+
+		pool.wait ();
+
+	}
+
+	for (Sink& sink : sinks) {
+
+		sink.stream.close ();
+
+		if (sink.failed || sink.stream.fail ()) {
+
+			succeeded = false;
+
+		}
+
+	}
+
+	return succeeded;
+
+}
@@ -0,0 +1,90 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Various function lookups from:	http://www.cplusplus.com/reference/fstream/ofstream/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "WorkStealingPool.h"
+
+#ifndef KEY_FAN_OUT_H
+#define KEY_FAN_OUT_H
+
+/**
+ * Static class that enciphers one text under many keys at once, such as to
+ * build sets of ciphertexts to test crackers on. The text is swept a chunk at
+ * a time. Each chunk is translated under every key while it is still in
+ * cache, one task per key. Each key has a sink of its own, with its own
+ * buffer and file, so the outputs are written in parallel and the text is
+ * read only once however many keys there are.
+ */
+class KeyFanOut {
+
+public:
+	// Public Methods ********************************************************
+	/**
+	 * Returns the name of the file a key's ciphertext is written to.
+	 * @param key of the ciphertext.
+	 * @return the filename, without a directory.
+	 */
+	static std::string getOutputName (const unsigned int key);
+
+	/**
+	 * Enciphers a text under every key of a list, writing each ciphertext to
+	 * its own file.
+	 * @param text to encipher.
+	 * @param length, number of characters in text.
+	 * @param keys to encipher with. No two may share a file.
+	 * @param filenames, the file to write under each key, created or
+	 * truncated.
+	 * @param chunkSize, characters translated under every key before moving
+	 * on. Must not be 0.
+	 * @param pool to translate and write on.
+	 * @return true if every file was written, otherwise false.
+	 */
+	static bool encipher (const char* const text, const std::size_t length, const std::vector<unsigned int>& keys, const std::vector<std::string>& filenames, const std::size_t chunkSize, WorkStealingPool& pool);
+
+private:
+	// Private Types *********************************************************
+	/**
+	 * Where the ciphertext of one key goes.
+	 */
+	struct Sink {
+
+		std::ofstream		stream;		/**< File the ciphertext is written to. */
+		std::vector<char>	buffer;		/**< Translation of the current chunk. */
+		bool				failed;		/**< Whether the file could not be opened or written. */
+
+	};
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	KeyFanOut (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param keyFanOut to copy from.
+	 */
+	KeyFanOut (const KeyFanOut& keyFanOut);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param keyFanOut to copy from.
+	 * @return this KeyFanOut.
+	 */
+	KeyFanOut& operator= (const KeyFanOut& keyFanOut);
+
+};
+
+#endif
@@ -0,0 +1,340 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Change point detection from:	https://en.wikipedia.org/wiki/Change_detection
+ * CUSUM from:					https://en.wikipedia.org/wiki/CUSUM
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "CaesarCipher.h"
+#include "KeySegmenter.h"
+#include "LanguageProfile.h"
+#include "WorkStealingPool.h"
+
+// Static Constant Definitions ***********************************************
+const double KeySegmenter::WEIGHT_SCALE = 65536.0;
+
+// Method Definitions ********************************************************
+KeySegmenter::KeySegmenter (const LanguageProfile& profile, const unsigned int windowLength) :
+	windowLength ((windowLength > 2) ? windowLength : 2),
+	chunkLength (DEFAULT_CHUNK_LENGTH) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const double* const frequencies = profile.getFrequencies ();
+
+	// Under key k, ciphertext letter c is plaintext letter c - k.
+	for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+		for (unsigned int key = 0; key < ALPHABET_LENGTH; key++) {
+
+			const double frequency = frequencies[(letter + ALPHABET_LENGTH - key) % ALPHABET_LENGTH];
+
+			rotatedWeights[letter][key] = static_cast<long long> (std::floor (WEIGHT_SCALE / frequency + 0.5));
+			logFrequencies[letter][key] = std::log (frequency);
+
+		}
+
+	}
+
+}
+
+//****************************************************************************
+void KeySegmenter::setChunkLength (const std::size_t chunkLength) {
+
+	if (chunkLength != 0) {
+
+		this->chunkLength = chunkLength;
+
+	}
+
+}
+
+//****************************************************************************
+std::vector<KeySegmenter::Segment> KeySegmenter::segment (const char* const text, const std::size_t length, WorkStealingPool& pool) const {
+
+	// A run must hold the best key for this many window positions to count as
+	// a segment rather than noise where the window straddles a boundary.
+	const std::size_t MINIMUM_RUN = windowLength / 4;
+	const std::size_t HALF_WINDOW = windowLength / 2;
+	std::vector<unsigned char> letters;
+	std::vector<unsigned char> windowKeys;
+	std::vector<std::size_t> runStarts;
+	std::vector<std::size_t> runEnds;
+	std::vector<unsigned int> runKeys;
+	std::vector<std::size_t> boundaries;
+	std::vector<Segment> segments;
+	unsigned long long letterCounts[CaesarCipher::ALPHABET_LENGTH] = { 0 };
+	std::size_t runStart = 0;
+	std::size_t letterIndex = 0;
+	unsigned int index = 0;
+	Segment current;
+
+	letters.reserve (length);
+
+	for (std::size_t i = 0; i < length; i++) {
+
+		index = CaesarCipher::getLetterIndex (text[i]);
+
+		if (index < CaesarCipher::ALPHABET_LENGTH) {
+
+			letters.push_back (index);
+
+		}
+
+	}
+
+	if (letters.size () >= windowLength) {
+
+		const std::size_t positions = letters.size () - windowLength + 1;
+
+		windowKeys.resize (positions);
+
+		// Each chunk rebuilds the window that straddles its first position, so
+		// chunks share nothing but the read only letters.
+		for (std::size_t first = 0; first < positions; first += chunkLength) {
+
+			const std::size_t last = (positions - first > chunkLength) ? first + chunkLength : positions;
+
+			pool.submit ([this, &letters, &windowKeys, first, last] (void) {
+
+				scanWindows (letters, first, last, windowKeys);
+
+			});
+
+		}
+
+		pool.wait ();
+
+		for (std::size_t position = 1; position <= positions; position++) {
+
+			if (position == positions || windowKeys[position] != windowKeys[runStart]) {
+
+				if (position - runStart >= MINIMUM_RUN || position - runStart == positions) {
+
+					// Noise between two runs of one key does not split them.
+					if (!runKeys.empty () && runKeys.back () == windowKeys[runStart]) {
+
+						runEnds.back () = position;
+
+					} else {
+
+						runStarts.push_back (runStart);
+						runEnds.push_back (position);
+						runKeys.push_back (windowKeys[runStart]);
+
+					}
+
+				}
+
+				runStart = position;
+
+			}
+
+		}
+
+	}
+
+	// A window stands for the letter at its centre, so each boundary lies
+	// between the centres of the runs on either side of it.
+	for (std::size_t run = 1; run < runKeys.size (); run++) {
+
+		std::size_t first = runStarts[run - 1] + HALF_WINDOW;
+		const std::size_t last = runEnds[run] - 1 + HALF_WINDOW;
+
+		if (!boundaries.empty () && first <= boundaries.back ()) {
+
+			first = boundaries.back () + 1;
+
+		}
+
+		if (first <= last) {
+
+			boundaries.push_back (findBoundary (letters, first, last, runKeys[run - 1], runKeys[run]));
+
+		}
+
+	}
+
+	boundaries.push_back (letters.size ());
+
+	// Turn letter boundaries into character offsets and crack each segment
+	// from its own histogram.
+	current.offset = 0;
+
+	for (std::size_t i = 0, boundary = 0; i <= length; i++) {
+
+		const bool isLetter = (i < length) && CaesarCipher::getLetterIndex (text[i]) < CaesarCipher::ALPHABET_LENGTH;
+
+		if (i == length || (isLetter && letterIndex == boundaries[boundary] && boundary + 1 < boundaries.size ())) {
+
+			current.length = i - current.offset;
+			current.key = findBestKey (letterCounts);
+
+			if (!segments.empty () && segments.back ().key == current.key) {
+
+				segments.back ().length += current.length;
+
+			} else {
+
+				segments.push_back (current);
+
+			}
+
+			current.offset = i;
+			boundary++;
+
+			for (unsigned int letter = 0; letter < CaesarCipher::ALPHABET_LENGTH; letter++) {
+
+				letterCounts[letter] = 0;
+
+			}
+
+		}
+
+		if (isLetter) {
+
+			letterCounts[letters[letterIndex]]++;
+			letterIndex++;
+
+		}
+
+	}
+
+	return segments;
+
+}
+
+//****************************************************************************
+void KeySegmenter::scanWindows (const std::vector<unsigned char>& letters, const std::size_t first, const std::size_t last, std::vector<unsigned char>& windowKeys) const {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	long long letterCounts[ALPHABET_LENGTH] = { 0 };
+	long long scores[ALPHABET_LENGTH] = { 0 };
+	unsigned int bestKey = 0;
+
+	for (std::size_t i = first; i < first + windowLength; i++) {
+
+		letterCounts[letters[i]]++;
+
+	}
+
+	// Since the window length is fixed, ranking keys by the sum of squared
+	// counts over expected frequencies ranks them as chi squared would.
+	for (unsigned int letter = 0; letter < ALPHABET_LENGTH; letter++) {
+
+		for (unsigned int key = 0; key < ALPHABET_LENGTH; key++) {
+
+			scores[key] += letterCounts[letter] * letterCounts[letter] * rotatedWeights[letter][key];
+
+		}
+
+	}
+
+	for (std::size_t position = first; position < last; position++) {
+
+		if (position != first) {
+
+			const unsigned char removed = letters[position - 1];
+			const unsigned char added = letters[position + windowLength - 1];
+
+			// A count going from x to x - 1 lowers its square by 2x - 1, and
+			// from x to x + 1 raises it by 2x + 1.
+			if (removed != added) {
+
+				const long long removedChange = 2 * letterCounts[removed] - 1;
+				const long long addedChange = 2 * letterCounts[added] + 1;
+
+				for (unsigned int key = 0; key < ALPHABET_LENGTH; key++) {
+
+					scores[key] += addedChange * rotatedWeights[added][key] - removedChange * rotatedWeights[removed][key];
+
+				}
+
+				letterCounts[removed]--;
+				letterCounts[added]++;
+
+			}
+
+		}
+
+		bestKey = 0;
+
+		for (unsigned int key = 1; key < ALPHABET_LENGTH; key++) {
+
+			if (scores[key] < scores[bestKey]) {
+
+				bestKey = key;
+
+			}
+
+		}
+
+		windowKeys[position] = static_cast<unsigned char> (bestKey);
+
+	}
+
+}
+
+//****************************************************************************
+unsigned int KeySegmenter::findBestKey (const unsigned long long letterCounts[CaesarCipher::ALPHABET_LENGTH]) const {
+
+	double scores[CaesarCipher::ALPHABET_LENGTH] = { 0.0 };
+	unsigned int bestKey = 0;
+
+	// Doubles, since squared counts of a long segment overflow integers.
+	for (unsigned int letter = 0; letter < CaesarCipher::ALPHABET_LENGTH; letter++) {
+
+		const double squaredCount = static_cast<double> (letterCounts[letter]) * letterCounts[letter];
+
+		for (unsigned int key = 0; key < CaesarCipher::ALPHABET_LENGTH; key++) {
+
+			scores[key] += squaredCount * rotatedWeights[letter][key];
+
+		}
+
+	}
+
+	for (unsigned int key = 1; key < CaesarCipher::ALPHABET_LENGTH; key++) {
+
+		if (scores[key] < scores[bestKey]) {
+
+			bestKey = key;
+
+		}
+
+	}
+
+	return bestKey;
+
+}
+
+//****************************************************************************
+std::size_t KeySegmenter::findBoundary (const std::vector<unsigned char>& letters, const std::size_t first, const std::size_t last, const unsigned int firstKey, const unsigned int secondKey) const {
+
+	double runningSum = 0.0;
+	double highestSum = 0.0;
+	std::size_t boundary = first;
+
+	for (std::size_t i = first; i < last; i++) {
+
+		runningSum += logFrequencies[letters[i]][firstKey] - logFrequencies[letters[i]][secondKey];
+
+		if (runningSum > highestSum) {
+
+			highestSum = runningSum;
+			boundary = i + 1;
+
+		}
+
+	}
+
+	return boundary;
+
+}
@@ -0,0 +1,122 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Change point detection from:	https://en.wikipedia.org/wiki/Change_detection
+ * CUSUM from:					https://en.wikipedia.org/wiki/CUSUM
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <vector>
+#include "CaesarCipher.h"
+#include "LanguageProfile.h"
+#include "WorkStealingPool.h"
+
+#ifndef KEY_SEGMENTER_H
+#define KEY_SEGMENTER_H
+
+/**
+ * Splits a text whose key changes partway through, such as several messages
+ * enciphered under different keys and concatenated, into segments that each
+ * have a single key. A window of letters slides over the text and the best
+ * key of every window position is found; where the best key changes, the
+ * exact boundary is the point that best separates the letters before it,
+ * under the old key, from those after it, under the new one.
+ */
+class KeySegmenter {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * A run of text enciphered under one key.
+	 */
+	struct Segment {
+
+		std::size_t		offset;		/**< Index of the segment's first character. */
+		std::size_t		length;		/**< Number of characters in the segment. */
+		unsigned int	key;		/**< Estimated key of the segment. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int	DEFAULT_WINDOW_LENGTH = 256;		/**< Letters in the sliding window. Shorter segments blend into their neighbours. */
+	static const std::size_t	DEFAULT_CHUNK_LENGTH = 1 << 20;		/**< Window positions scanned by each task. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Prepares to segment texts of one language.
+	 * @param profile of the language the plaintext is in.
+	 * @param windowLength, number of letters in the sliding window. At least
+	 * two are used.
+	 */
+	KeySegmenter (const LanguageProfile& profile, const unsigned int windowLength);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Sets how many window positions each task scans.
+	 * @param chunkLength in window positions. Must not be zero.
+	 */
+	void setChunkLength (const std::size_t chunkLength);
+
+	// Public Methods ********************************************************
+	/**
+	 * Splits a text into segments with their own keys. Runs in time linear in
+	 * the length of the text, with the window scan spread over the pool in
+	 * chunks that each start from the window straddling their first position.
+	 * @param text to segment.
+	 * @param length, number of characters in text.
+	 * @param pool to scan on.
+	 * @return the segments in order, covering the whole text. Text without
+	 * enough letters for a window is a single segment.
+	 */
+	std::vector<Segment> segment (const char* const text, const std::size_t length, WorkStealingPool& pool) const;
+
+private:
+	// Private Static Constants **********************************************
+	static const double WEIGHT_SCALE;	/**< Scale of the integer inverse frequencies. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Finds the best key of every window position in a range. The window's
+	 * histogram and the score of every key are updated as each letter enters
+	 * and leaves, in integers so that no error builds up however long the text.
+	 * @param letters, index of each letter of the text in order.
+	 * @param first window position to scan.
+	 * @param last window position to scan, exclusive.
+	 * @param windowKeys, where to store the best key of each position.
+	 */
+	void scanWindows (const std::vector<unsigned char>& letters, const std::size_t first, const std::size_t last, std::vector<unsigned char>& windowKeys) const;
+
+	/**
+	 * Finds the key of a run of letters from its histogram.
+	 * @param letterCounts, number of times each letter occurs in the run.
+	 * @return the key with the lowest chi squared sum.
+	 */
+	unsigned int findBestKey (const unsigned long long letterCounts[CaesarCipher::ALPHABET_LENGTH]) const;
+
+	/**
+	 * Finds where one key gives way to another: the letter before which the
+	 * running sum of how much better the first key explains each letter than
+	 * the second peaks.
+	 * @param letters, index of each letter of the text in order.
+	 * @param first letter the boundary may be at.
+	 * @param last letter the boundary may be at, inclusive.
+	 * @param firstKey, key of the letters before the boundary.
+	 * @param secondKey, key of the letters from the boundary on.
+	 * @return index of the first letter under secondKey.
+	 */
+	std::size_t findBoundary (const std::vector<unsigned char>& letters, const std::size_t first, const std::size_t last, const unsigned int firstKey, const unsigned int secondKey) const;
+
+	// Private Members *******************************************************
+	unsigned int		windowLength;	/**< Letters in the sliding window. */
+	std::size_t			chunkLength;	/**< Window positions scanned by each task. */
+	long long			rotatedWeights[CaesarCipher::ALPHABET_LENGTH][CaesarCipher::ALPHABET_LENGTH];	/**< Scaled inverse frequency of the plaintext of each ciphertext letter under each key. */
+	double				logFrequencies[CaesarCipher::ALPHABET_LENGTH][CaesarCipher::ALPHABET_LENGTH];	/**< Log frequency of the plaintext of each ciphertext letter under each key. */
+
+};
+
+#endif
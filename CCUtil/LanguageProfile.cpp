@@ -0,0 +1,290 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Letter frequencies from:			https://en.wikipedia.org/wiki/Letter_frequency#Relative_frequencies_of_letters_in_other_languages
+ * Chi squared formula from:		https://en.wikipedia.org/wiki/Chi-squared_test
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "CaesarCipher.h"
+#include "FileSystem.h"
+#include "LanguageProfile.h"
+
+// Static Constant Definitions ***********************************************
+const double LanguageProfile::MINIMUM_FREQUENCY = 0.00001;
+const double LanguageProfile::PARTS_PER_BILLION = 1000000000.0;
+const char LanguageProfile::MAGIC[4] = { 'C', 'C', 'L', 'P' };
+
+// Bundled Profiles **********************************************************
+/**
+ * Letter frequencies of the bundled profiles, obtained from:
+ * https://en.wikipedia.org/wiki/Letter_frequency#Relative_frequencies_of_letters_in_other_languages
+ * Accented letters are left out, which is why the rows do not sum to one;
+ * the constructor normalizes them.
+ */
+static const char* const BUNDLED_NAMES[] = { "en", "de", "fr", "es" };
+
+static const double BUNDLED_FREQUENCIES[][CaesarCipher::ALPHABET_LENGTH] = {
+
+	// English, matching CaesarCipher::ALPHABET_FREQUENCIES.
+	{ 0.08167, 0.01492, 0.02782, 0.04253, 0.12702, 0.02228, 0.02015, 0.06094, 0.06966, 0.00153, 0.00772, 0.04025, 0.02406,
+	  0.06749, 0.07507, 0.01929, 0.00095, 0.05987, 0.06327, 0.09056, 0.02758, 0.00978, 0.02361, 0.00150, 0.01974, 0.00074 },
+
+	// German
+	{ 0.06516, 0.01886, 0.02732, 0.05076, 0.16396, 0.01656, 0.03009, 0.04577, 0.06550, 0.00268, 0.01417, 0.03437, 0.02534,
+	  0.09776, 0.02594, 0.00670, 0.00018, 0.07003, 0.07270, 0.06154, 0.04166, 0.00846, 0.01921, 0.00034, 0.00039, 0.01134 },
+
+	// French
+	{ 0.07636, 0.00901, 0.03260, 0.03669, 0.14715, 0.01066, 0.00866, 0.00737, 0.07529, 0.00613, 0.00074, 0.05456, 0.02968,
+	  0.07095, 0.05796, 0.02521, 0.01362, 0.06693, 0.07948, 0.07244, 0.06311, 0.01838, 0.00049, 0.00427, 0.00128, 0.00326 },
+
+	// Spanish
+	{ 0.11525, 0.02215, 0.04019, 0.05010, 0.12181, 0.00692, 0.01768, 0.00703, 0.06247, 0.00493, 0.00011, 0.04967, 0.03157,
+	  0.06712, 0.08683, 0.02510, 0.00877, 0.06871, 0.07977, 0.04632, 0.02927, 0.01138, 0.00017, 0.00215, 0.01008, 0.00467 }
+
+};
+
+// Method Definitions ********************************************************
+LanguageProfile::LanguageProfile (const std::string& name, const double frequencies[CaesarCipher::ALPHABET_LENGTH]) :
+	name (name.substr (0, MAXIMUM_NAME_LENGTH)) {
+
+	double sum = 0.0;
+
+	// Letters that never occurred in the source of a profile would otherwise
+	// make chi squared infinite for any text that contains them.
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		this->frequencies[i] = (frequencies[i] > MINIMUM_FREQUENCY) ? frequencies[i] : MINIMUM_FREQUENCY;
+		sum += this->frequencies[i];
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		this->frequencies[i] /= sum;
+		inverseFrequencies[i] = 1.0 / this->frequencies[i];
+
+	}
+
+}
+
+//****************************************************************************
+const std::string& LanguageProfile::getName (void) const {
+
+	return name;
+
+}
+
+//****************************************************************************
+const double* LanguageProfile::getFrequencies (void) const {
+
+	return frequencies;
+
+}
+
+//****************************************************************************
+std::vector<LanguageProfile> LanguageProfile::getBundledProfiles (void) {
+
+	std::vector<LanguageProfile> profiles;
+
+	for (unsigned int i = 0; i < sizeof (BUNDLED_NAMES) / sizeof (BUNDLED_NAMES[0]); i++) {
+
+		profiles.push_back (LanguageProfile (BUNDLED_NAMES[i], BUNDLED_FREQUENCIES[i]));
+
+	}
+
+	return profiles;
+
+}
+
+//****************************************************************************
+void LanguageProfile::scoreKeys (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], const std::vector<LanguageProfile>& profiles, std::vector<double>& scores) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	double squaredFrequencies[ALPHABET_LENGTH * 2];
+	double observedTotal = 0.0;
+	unsigned int numberOfLetters = 0;
+	double runningSum = 0.0;
+
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		numberOfLetters += letterCounts[i];
+
+	}
+
+	// Lay the squared observed frequencies out twice in a row so that every
+	// rotation is a contiguous window, which lets the inner loop vectorize
+	// without any modulo.
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		const double frequency = (numberOfLetters != 0) ? static_cast<double> (letterCounts[i]) / numberOfLetters : 0.0;
+
+		squaredFrequencies[i] = frequency * frequency;
+		squaredFrequencies[i + ALPHABET_LENGTH] = squaredFrequencies[i];
+		observedTotal += frequency;
+
+	}
+
+	scores.resize (profiles.size () * ALPHABET_LENGTH);
+
+	for (unsigned int profile = 0; profile < profiles.size (); profile++) {
+
+		const double* const inverseFrequencies = profiles[profile].inverseFrequencies;
+
+		for (unsigned int key = 0; key < ALPHABET_LENGTH; key++) {
+
+			runningSum = 0.0;
+
+			for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+				runningSum += squaredFrequencies[key + i] * inverseFrequencies[i];
+
+			}
+
+			// Expanding (o - e)^2 / e leaves o^2 / e - 2o + e, and both o and e sum to one.
+			scores[profile * ALPHABET_LENGTH + key] = runningSum - 2.0 * observedTotal + 1.0;
+
+		}
+
+	}
+
+}
+
+//****************************************************************************
+LanguageProfile::Estimate LanguageProfile::crackKey (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], const std::vector<LanguageProfile>& profiles, std::vector<double>& scores) {
+
+	Estimate estimate;
+
+	estimate.profileIndex = 0;
+	estimate.key = 0;
+	estimate.score = std::numeric_limits<double>::max ();
+
+	scoreKeys (letterCounts, profiles, scores);
+
+	for (unsigned int i = 0; i < scores.size (); i++) {
+
+		if (scores[i] < estimate.score) {
+
+			estimate.profileIndex = i / CaesarCipher::ALPHABET_LENGTH;
+			estimate.key = i % CaesarCipher::ALPHABET_LENGTH;
+			estimate.score = scores[i];
+
+		}
+
+	}
+
+	return estimate;
+
+}
+
+//****************************************************************************
+bool LanguageProfile::saveProfiles (const std::string& filename, const std::vector<LanguageProfile>& profiles) {
+
+	return FileSystem::writeFile (filename, serializeProfiles (profiles));
+
+}
+
+//****************************************************************************
+bool LanguageProfile::loadProfiles (const std::string& filename, std::vector<LanguageProfile>& profiles) {
+
+	std::string contents;
+	unsigned long long size = 0;
+
+	if (!FileSystem::getFileSize (filename, size) || !FileSystem::readFileRange (filename, 0, size, contents)) {
+
+		return false;
+
+	}
+
+	return deserializeProfiles (contents, profiles);
+
+}
+
+//****************************************************************************
+std::string LanguageProfile::serializeProfiles (const std::vector<LanguageProfile>& profiles) {
+
+	std::string buffer;
+
+	buffer.append (MAGIC, sizeof (MAGIC));
+	BinaryFormat::appendInteger (buffer, FORMAT_VERSION, 2);
+	BinaryFormat::appendInteger (buffer, profiles.size (), 2);
+
+	for (const LanguageProfile& profile : profiles) {
+
+		BinaryFormat::appendInteger (buffer, profile.name.length (), 1);
+		buffer += profile.name;
+
+		for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+			BinaryFormat::appendInteger (buffer, static_cast<unsigned long long> (std::floor (profile.frequencies[i] * PARTS_PER_BILLION + 0.5)), 4);
+
+		}
+
+	}
+
+	BinaryFormat::appendChecksum (buffer);
+
+	return buffer;
+
+}
+
+//****************************************************************************
+bool LanguageProfile::deserializeProfiles (const std::string& contents, std::vector<LanguageProfile>& profiles) {
+
+	std::string::size_type offset = sizeof (MAGIC);
+	std::vector<LanguageProfile> loadedProfiles;
+	unsigned long long formatVersion = 0;
+	unsigned long long profileCount = 0;
+	unsigned long long nameLength = 0;
+	unsigned long long value = 0;
+	double frequencies[CaesarCipher::ALPHABET_LENGTH];
+	std::string name;
+
+	if (contents.compare (0, sizeof (MAGIC), MAGIC, sizeof (MAGIC)) != 0 || !BinaryFormat::verifyChecksum (contents) ||
+		!BinaryFormat::readInteger (contents, offset, 2, formatVersion) || formatVersion != FORMAT_VERSION ||
+		!BinaryFormat::readInteger (contents, offset, 2, profileCount)) {
+
+		return false;
+
+	}
+
+	for (unsigned long long profile = 0; profile < profileCount; profile++) {
+
+		if (!BinaryFormat::readInteger (contents, offset, 1, nameLength) || contents.length () - offset < nameLength) {
+
+			return false;
+
+		}
+
+		name = contents.substr (offset, static_cast<std::string::size_type> (nameLength));
+		offset += static_cast<std::string::size_type> (nameLength);
+
+		for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+			if (!BinaryFormat::readInteger (contents, offset, 4, value)) {
+
+				return false;
+
+			}
+
+			frequencies[i] = static_cast<double> (value) / PARTS_PER_BILLION;
+
+		}
+
+		loadedProfiles.push_back (LanguageProfile (name, frequencies));
+
+	}
+
+	profiles.insert (profiles.end (), loadedProfiles.begin (), loadedProfiles.end ());
+	return true;
+
+}
@@ -0,0 +1,142 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Letter frequencies from:			https://en.wikipedia.org/wiki/Letter_frequency#Relative_frequencies_of_letters_in_other_languages
+ * Chi squared formula from:		https://en.wikipedia.org/wiki/Chi-squared_test
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+
+#ifndef LANGUAGE_PROFILE_H
+#define LANGUAGE_PROFILE_H
+
+/**
+ * Expected letter frequencies of a language, used to crack ciphertexts that
+ * are not English. Several profiles are scored against one letter histogram
+ * at once, so cracking against every loaded language costs a single pass
+ * over the text.
+ */
+class LanguageProfile {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Result of cracking a histogram against several profiles.
+	 */
+	struct Estimate {
+
+		unsigned int	profileIndex;	/**< Index of the best fitting profile. */
+		unsigned int	key;			/**< Best fitting key for that profile. */
+		double			score;			/**< Chi squared sum of that profile and key. Lower is better. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int MAXIMUM_NAME_LENGTH = 255;	/**< Longest name a profile file can hold. */
+	static const double MINIMUM_FREQUENCY;					/**< Frequencies are raised to at least this to keep chi squared finite. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Creates a profile. Frequencies are normalized to sum to one.
+	 * @param name of the language.
+	 * @param frequencies at which each letter occurs in the language.
+	 */
+	LanguageProfile (const std::string& name, const double frequencies[CaesarCipher::ALPHABET_LENGTH]);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the name of the language.
+	 * @return the name of the language.
+	 */
+	const std::string& getName (void) const;
+
+	/**
+	 * Returns the normalized frequency of each letter.
+	 * @return the normalized frequency of each letter, indexed from A.
+	 */
+	const double* getFrequencies (void) const;
+
+	/**
+	 * Returns the profiles built into CCUtil: English, German, French and Spanish.
+	 * @return the built in profiles.
+	 */
+	static std::vector<LanguageProfile> getBundledProfiles (void);
+
+	// Public Methods ********************************************************
+	/**
+	 * Scores every key of every profile against one letter histogram. Since
+	 * observed frequencies always sum to one, the chi squared sum of profile p
+	 * and key k reduces to sum over i of o[i + k]^2 / e[p][i], minus one. That
+	 * is the product of a profiles-by-letters matrix of inverse frequencies and
+	 * a circulant letters-by-keys matrix of squared observed frequencies.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @param profiles to score against.
+	 * @param scores, where to store the chi squared sums, profiles.size () rows
+	 * of ALPHABET_LENGTH keys each.
+	 */
+	static void scoreKeys (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], const std::vector<LanguageProfile>& profiles, std::vector<double>& scores);
+
+	/**
+	 * Finds the profile and key that fit one letter histogram best.
+	 * @param letterCounts, number of times each letter occurs in the ciphertext.
+	 * @param profiles to score against. Must not be empty.
+	 * @param scores, where to store every chi squared sum as for scoreKeys.
+	 * @return the best fitting profile and key.
+	 */
+	static Estimate crackKey (const unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], const std::vector<LanguageProfile>& profiles, std::vector<double>& scores);
+
+	/**
+	 * Saves profiles to a binary file.
+	 * @param filename to save to.
+	 * @param profiles to save.
+	 * @return true if saved, otherwise false.
+	 */
+	static bool saveProfiles (const std::string& filename, const std::vector<LanguageProfile>& profiles);
+
+	/**
+	 * Loads every profile of a binary file.
+	 * @param filename to load from.
+	 * @param profiles, where to append the loaded profiles.
+	 * @return true if the file was intact and loaded, otherwise false.
+	 */
+	static bool loadProfiles (const std::string& filename, std::vector<LanguageProfile>& profiles);
+
+	/**
+	 * Serializes profiles into the binary profile format: the bytes "CCLP",
+	 * a 2 byte format version, a 2 byte profile count, then for each profile a
+	 * 1 byte name length, the name, and each letter's frequency in parts per
+	 * billion as 4 bytes, followed by an 8 byte checksum.
+	 * @param profiles to serialize.
+	 * @return the serialized profiles.
+	 */
+	static std::string serializeProfiles (const std::vector<LanguageProfile>& profiles);
+
+	/**
+	 * Deserializes profiles written by serializeProfiles.
+	 * @param contents to deserialize.
+	 * @param profiles, where to append the profiles.
+	 * @return true if the contents were intact, otherwise false.
+	 */
+	static bool deserializeProfiles (const std::string& contents, std::vector<LanguageProfile>& profiles);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;				/**< Version of the binary profile format. */
+	static const char MAGIC[4];									/**< Bytes every profile file starts with. */
+	static const double PARTS_PER_BILLION;						/**< Scale of the frequencies stored in profile files. */
+
+	// Private Members *******************************************************
+	std::string	name;												/**< Name of the language. */
+	double		frequencies[CaesarCipher::ALPHABET_LENGTH];			/**< Normalized frequency of each letter. */
+	double		inverseFrequencies[CaesarCipher::ALPHABET_LENGTH];	/**< Reciprocal of each frequency, a row of the scoring matrix. */
+
+};
+
+#endif
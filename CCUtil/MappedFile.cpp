@@ -0,0 +1,162 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Memory mapping reference from:	http://pubs.opengroup.org/onlinepubs/9699919799/functions/mmap.html
+ *									https://msdn.microsoft.com/en-us/library/windows/desktop/aa366761(v=vs.85).aspx
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Method Definitions ********************************************************
+MappedFile::MappedFile (void) :
+	data (nullptr),
+	size (0) {
+
+}
+
+//****************************************************************************
+MappedFile::~MappedFile (void) {
+
+	close ();
+
+}
+
+//****************************************************************************
+const char* MappedFile::getData (void) const {
+
+	return data;
+
+}
+
+//****************************************************************************
+std::size_t MappedFile::getSize (void) const {
+
+	return size;
+
+}
+
+//****************************************************************************
+bool MappedFile::open (const std::string& filename) {
+
+	close ();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA (filename.c_str (), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	LARGE_INTEGER fileSize;
+	HANDLE mapping = NULL;
+
+	if (file == INVALID_HANDLE_VALUE) {
+
+		return false;
+
+	}
+
+	if (!GetFileSizeEx (file, &fileSize)) {
+
+		CloseHandle (file);
+		return false;
+
+	}
+
+	// Empty files cannot be mapped, but are valid views of nothing.
+	if (fileSize.QuadPart != 0) {
+
+		mapping = CreateFileMappingA (file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+		if (mapping != NULL) {
+
+			data = static_cast<const char*> (MapViewOfFile (mapping, FILE_MAP_READ, 0, 0, 0));
+
+			// The view keeps the mapping alive on its own.
+			CloseHandle (mapping);
+
+		}
+
+		if (data == nullptr) {
+
+			CloseHandle (file);
+			return false;
+
+		}
+
+	}
+
+	size = static_cast<std::size_t> (fileSize.QuadPart);
+	CloseHandle (file);
+	return true;
+#else
+	const int file = ::open (filename.c_str (), O_RDONLY);
+	struct stat status;
+	void* mapping = nullptr;
+
+	if (file < 0) {
+
+		return false;
+
+	}
+
+	if (fstat (file, &status) != 0 || !S_ISREG (status.st_mode)) {
+
+		::close (file);
+		return false;
+
+	}
+
+	// Empty files cannot be mapped, but are valid views of nothing.
+	if (status.st_size != 0) {
+
+		mapping = mmap (nullptr, static_cast<std::size_t> (status.st_size), PROT_READ, MAP_SHARED, file, 0);
+
+		if (mapping == MAP_FAILED) {
+
+			::close (file);
+			return false;
+
+		}
+
+		data = static_cast<const char*> (mapping);
+
+	}
+
+	size = static_cast<std::size_t> (status.st_size);
+
+	// The mapping keeps the file alive on its own.
+	::close (file);
+	return true;
+#endif
+
+}
+
+//****************************************************************************
+void MappedFile::close (void) {
+
+	if (data != nullptr) {
+
+#ifdef _WIN32
+		UnmapViewOfFile (data);
+#else
+		munmap (const_cast<char*> (data), size);
+#endif
+
+	}
+
+	data = nullptr;
+	size = 0;
+
+}
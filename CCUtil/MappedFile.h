@@ -0,0 +1,87 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Memory mapping reference from:	http://pubs.opengroup.org/onlinepubs/9699919799/functions/mmap.html
+ *									https://msdn.microsoft.com/en-us/library/windows/desktop/aa366761(v=vs.85).aspx
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+/**
+ * Read only view of a whole file mapped into memory. Pages are read from disk
+ * as they are touched and shared by every process mapping the same file, so
+ * large precompiled tables cost nothing to load.
+ */
+class MappedFile {
+
+public:
+	// Public Ctors **********************************************************
+	/**
+	 * Creates a view of nothing.
+	 */
+	MappedFile (void);
+
+	/**
+	 * Unmaps the file, if any.
+	 */
+	~MappedFile (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the contents of the mapped file.
+	 * @return the first byte of the file, or nullptr if nothing is mapped or
+	 * the file is empty.
+	 */
+	const char* getData (void) const;
+
+	/**
+	 * Returns the size of the mapped file.
+	 * @return the size in bytes.
+	 */
+	std::size_t getSize (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Maps a file, unmapping any file mapped before.
+	 * @param filename of the file to map.
+	 * @return true if mapped, otherwise false.
+	 */
+	bool open (const std::string& filename);
+
+	/**
+	 * Unmaps the file, if any.
+	 */
+	void close (void);
+
+private:
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the mapping from being copied.
+	 * @param mappedFile to copy from.
+	 */
+	MappedFile (const MappedFile& mappedFile);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the mapping from being copied.
+	 * @param mappedFile to copy from.
+	 * @return this MappedFile.
+	 */
+	MappedFile& operator= (const MappedFile& mappedFile);
+
+	// Private Members *******************************************************
+	const char*		data;		/**< First byte of the mapping. */
+	std::size_t		size;		/**< Size of the mapping in bytes. */
+
+};
+
+#endif
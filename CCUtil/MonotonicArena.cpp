@@ -0,0 +1,108 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Region based allocation overview from:	https://en.wikipedia.org/wiki/Region-based_memory_management
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "MonotonicArena.h"
+
+// Method Definitions ********************************************************
+MonotonicArena::MonotonicArena (const std::size_t blockSize) :
+	blockSize (blockSize > ALIGNMENT ? blockSize : ALIGNMENT),
+	currentBlock (0),
+	currentOffset (0) {
+
+}
+
+//****************************************************************************
+MonotonicArena::~MonotonicArena (void) {
+
+	for (Block& block : blocks) {
+
+		delete[] block.data;
+
+	}
+
+}
+
+//****************************************************************************
+std::size_t MonotonicArena::getCapacity (void) const {
+
+	std::size_t capacity = 0;
+
+	for (const Block& block : blocks) {
+
+		capacity += block.size;
+
+	}
+
+	return capacity;
+
+}
+
+//****************************************************************************
+MonotonicArena& MonotonicArena::getThreadArena (void) {
+
+	static thread_local MonotonicArena threadArena (DEFAULT_BLOCK_SIZE);
+
+	return threadArena;
+
+}
+
+//****************************************************************************
+char* MonotonicArena::allocate (const std::size_t size) {
+
+	// Rounding every size up keeps every allocation aligned, since blocks
+	// come from new[] which is at least this aligned on supported platforms.
+	const std::size_t alignedSize = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	char* allocation = nullptr;
+	Block block;
+
+	if (currentBlock < blocks.size () && blocks[currentBlock].size - currentOffset >= alignedSize) {
+
+		allocation = blocks[currentBlock].data + currentOffset;
+		currentOffset += alignedSize;
+		return allocation;
+
+	}
+
+	// Move on to the next kept block that is large enough. Any smaller blocks
+	// in between are skipped for the rest of this batch.
+	for (std::size_t i = currentBlock + 1; i < blocks.size (); i++) {
+
+		if (blocks[i].size >= alignedSize) {
+
+			currentBlock = i;
+			currentOffset = alignedSize;
+			return blocks[i].data;
+
+		}
+
+	}
+
+	block.size = std::max (blockSize, alignedSize);
+	block.data = new char[block.size];
+	blocks.push_back (block);
+
+	currentBlock = blocks.size () - 1;
+	currentOffset = alignedSize;
+
+	return block.data;
+
+}
+
+//****************************************************************************
+void MonotonicArena::reset (void) {
+
+	currentBlock = 0;
+	currentOffset = 0;
+
+}
@@ -0,0 +1,106 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Region based allocation overview from:	https://en.wikipedia.org/wiki/Region-based_memory_management
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <vector>
+
+#ifndef MONOTONIC_ARENA_H
+#define MONOTONIC_ARENA_H
+
+/**
+ * Allocator that hands out memory by bumping a pointer through large blocks
+ * and frees everything at once with reset. Blocks are kept across resets, so
+ * once a batch of a given shape has been processed, processing another one
+ * like it does not touch the heap at all.
+ */
+class MonotonicArena {
+
+public:
+	// Public Static Constants ***********************************************
+	static const std::size_t DEFAULT_BLOCK_SIZE = 1 << 20;	/**< Default size of each block in bytes. */
+	static const std::size_t ALIGNMENT = 16;				/**< Alignment of every allocation in bytes. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Creates an empty arena. No memory is allocated until it is needed.
+	 * @param blockSize, minimum size of each block in bytes.
+	 */
+	explicit MonotonicArena (const std::size_t blockSize);
+
+	/**
+	 * Frees every block.
+	 */
+	~MonotonicArena (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the total size of every block owned by the arena.
+	 * @return the capacity in bytes.
+	 */
+	std::size_t getCapacity (void) const;
+
+	/**
+	 * Returns the arena of the calling thread, creating it on first use.
+	 * Each worker thread thereby gets a pool of its own that needs no locking.
+	 * @return the arena of the calling thread.
+	 */
+	static MonotonicArena& getThreadArena (void);
+
+	// Public Methods ********************************************************
+	/**
+	 * Allocates memory that lives until the next reset.
+	 * @param size of the allocation in bytes.
+	 * @return the allocated memory, aligned to ALIGNMENT.
+	 * @throw bad_alloc if a new block could not be allocated.
+	 */
+	char* allocate (const std::size_t size);
+
+	/**
+	 * Releases every allocation at once while keeping the blocks for reuse.
+	 */
+	void reset (void);
+
+private:
+	// Private Types *********************************************************
+	/**
+	 * A single block of memory.
+	 */
+	struct Block {
+
+		char*		data;	/**< Start of the block. */
+		std::size_t	size;	/**< Size of the block in bytes. */
+
+	};
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the arena from being copied.
+	 * @param monotonicArena to copy from.
+	 */
+	MonotonicArena (const MonotonicArena& monotonicArena);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the arena from being copied.
+	 * @param monotonicArena to copy from.
+	 * @return this MonotonicArena.
+	 */
+	MonotonicArena& operator= (const MonotonicArena& monotonicArena);
+
+	// Private Members *******************************************************
+	std::vector<Block>	blocks;			/**< Every block owned by the arena, in the order they are used. */
+	std::size_t			blockSize;		/**< Minimum size of each block in bytes. */
+	std::size_t			currentBlock;	/**< Index of the block being allocated from. */
+	std::size_t			currentOffset;	/**< Bytes used in the current block. */
+
+};
+
+#endif
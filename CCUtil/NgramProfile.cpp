@@ -0,0 +1,336 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * N-gram scoring from:				http://practicalcryptography.com/cryptanalysis/text-characterisation/quadgrams/
+ * Log probabilities from:			https://en.wikipedia.org/wiki/Log_probability
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "CaesarCipher.h"
+#include "NgramProfile.h"
+#include "WorkStealingPool.h"
+
+// Static Constant Definitions ***********************************************
+const double NgramProfile::UNSEEN_COUNT = 0.01;
+const std::size_t NgramProfile::ORDER_OFFSETS[MAXIMUM_ORDER] = { 0, 26, 702, 18278 };
+const char NgramProfile::MAGIC[4] = { 'C', 'C', 'N', 'G' };
+
+// Helper Functions **********************************************************
+/**
+ * Reads the little endian 2 byte cost of an n-gram.
+ * @param data, the first byte of the cost.
+ * @return the cost.
+ */
+static inline unsigned int readCost (const char* const data) {
+
+	return static_cast<unsigned int> (static_cast<unsigned char> (data[0])) | (static_cast<unsigned int> (static_cast<unsigned char> (data[1])) << 8);
+
+}
+
+// Method Definitions ********************************************************
+NgramProfile::NgramProfile (void) :
+	costs (nullptr),
+	letterCount (0) {
+
+}
+
+//****************************************************************************
+unsigned long long NgramProfile::getLetterCount (void) const {
+
+	return letterCount;
+
+}
+
+//****************************************************************************
+bool NgramProfile::open (const std::string& filename) {
+
+	contents.clear ();
+
+	if (!mappedFile.open (filename)) {
+
+		return attach (nullptr, 0);
+
+	}
+
+	return attach (mappedFile.getData (), mappedFile.getSize ());
+
+}
+
+//****************************************************************************
+bool NgramProfile::load (const std::string& contents) {
+
+	mappedFile.close ();
+	this->contents = contents;
+
+	return attach (this->contents.data (), this->contents.length ());
+
+}
+
+//****************************************************************************
+double NgramProfile::scoreKey (const char* const ciphertext, const std::size_t length, const unsigned int key) const {
+
+	unsigned char letters[SAMPLE_LETTERS];
+
+	return scoreLetters (letters, collectLetters (ciphertext, length, letters), key);
+
+}
+
+//****************************************************************************
+void NgramProfile::rankKeys (const char* const ciphertext, const std::size_t length, unsigned int rankedKeys[CaesarCipher::ALPHABET_LENGTH], double rankedScores[CaesarCipher::ALPHABET_LENGTH]) const {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	unsigned char letters[SAMPLE_LETTERS];
+	const std::size_t count = collectLetters (ciphertext, length, letters);
+	double scores[CaesarCipher::ALPHABET_LENGTH];
+
+	for (unsigned int key = 0; key < ALPHABET_LENGTH; key++) {
+
+		scores[key] = scoreLetters (letters, count, key);
+
+	}
+
+	CaesarCipher::rankScores (scores, ALPHABET_LENGTH, rankedKeys, rankedScores);
+
+}
+
+//****************************************************************************
+std::string NgramProfile::train (const char* const corpus, const std::size_t length, WorkStealingPool& pool) {
+
+	const std::size_t entryCount = ENTRY_COUNT;
+	const unsigned int spanCount = pool.getThreadCount ();
+	std::vector<std::vector<unsigned long long> > spanCounts (spanCount, std::vector<unsigned long long> (entryCount, 0));
+	std::vector<unsigned long long>& counts = spanCounts[0];
+	unsigned long long orderTotals[MAXIMUM_ORDER] = {};
+	unsigned long long trainedLetterCount = 0;
+	unsigned int order = 0;
+	double cost = 0.0;
+	std::string buffer;
+
+	// Each span is counted into tables of its own, so spans share nothing
+	// while they are counted.
+	for (unsigned int i = 0; i < spanCount; i++) {
+
+		pool.submit ([corpus, length, spanCount, i, &spanCounts] (void) {
+
+			const std::size_t start = static_cast<std::size_t> (static_cast<unsigned long long> (length) * i / spanCount);
+			const std::size_t end = static_cast<std::size_t> (static_cast<unsigned long long> (length) * (i + 1) / spanCount);
+
+			countSpan (corpus, start, end, spanCounts[i].data ());
+
+		});
+
+	}
+
+	pool.wait ();
+
+	for (unsigned int i = 1; i < spanCount; i++) {
+
+		for (std::size_t entry = 0; entry < entryCount; entry++) {
+
+			counts[entry] += spanCounts[i][entry];
+
+		}
+
+	}
+
+	for (std::size_t entry = 0; entry < entryCount; entry++) {
+
+		order = (entry < ORDER_OFFSETS[1]) ? 0 : (entry < ORDER_OFFSETS[2]) ? 1 : (entry < ORDER_OFFSETS[3]) ? 2 : 3;
+		orderTotals[order] += counts[entry];
+
+	}
+
+	trainedLetterCount = orderTotals[0];
+
+	buffer.reserve (HEADER_LENGTH + entryCount * 2 + 8);
+	buffer.append (MAGIC, sizeof (MAGIC));
+	BinaryFormat::appendInteger (buffer, FORMAT_VERSION, 2);
+	BinaryFormat::appendInteger (buffer, trainedLetterCount, 8);
+
+	for (std::size_t entry = 0; entry < entryCount; entry++) {
+
+		order = (entry < ORDER_OFFSETS[1]) ? 0 : (entry < ORDER_OFFSETS[2]) ? 1 : (entry < ORDER_OFFSETS[3]) ? 2 : 3;
+
+		// An n-gram the corpus never had is rare rather than impossible, so
+		// that a single typo cannot rule out the right key.
+		cost = -std::log2 (((counts[entry] != 0) ? static_cast<double> (counts[entry]) : UNSEEN_COUNT) / static_cast<double> ((orderTotals[order] != 0) ? orderTotals[order] : 1)) * COST_SCALE;
+		BinaryFormat::appendInteger (buffer, (cost < MAXIMUM_COST) ? static_cast<unsigned long long> (cost + 0.5) : static_cast<unsigned long long> (MAXIMUM_COST), 2);
+
+	}
+
+	BinaryFormat::appendChecksum (buffer);
+
+	return buffer;
+
+}
+
+//****************************************************************************
+bool NgramProfile::attach (const char* const data, const std::size_t length) {
+
+	std::size_t offset = sizeof (MAGIC);
+	unsigned long long formatVersion = 0;
+	unsigned long long loadedLetterCount = 0;
+
+	costs = nullptr;
+	letterCount = 0;
+
+	if (data == nullptr || length != HEADER_LENGTH + ENTRY_COUNT * 2 + 8 || memcmp (data, MAGIC, sizeof (MAGIC)) != 0 || !BinaryFormat::verifyChecksum (data, length) ||
+		!BinaryFormat::readInteger (data, length, offset, 2, formatVersion) || formatVersion != FORMAT_VERSION ||
+		!BinaryFormat::readInteger (data, length, offset, 8, loadedLetterCount)) {
+
+		return false;
+
+	}
+
+	costs = data + HEADER_LENGTH;
+	letterCount = loadedLetterCount;
+
+	return true;
+
+}
+
+//****************************************************************************
+double NgramProfile::scoreLetters (const unsigned char* const letters, const std::size_t count, const unsigned int key) const {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const unsigned int maximumOrder = MAXIMUM_ORDER;
+	const unsigned int shift = (ALPHABET_LENGTH - key % ALPHABET_LENGTH) % ALPHABET_LENGTH;
+	const unsigned int order = (count < maximumOrder) ? static_cast<unsigned int> (count) : maximumOrder;
+	unsigned int gramCount = 1;
+	unsigned int gram = 0;
+	unsigned long long totalCost = 0;
+
+	if (costs == nullptr || count == 0) {
+
+		return 0.0;
+
+	}
+
+	for (unsigned int i = 0; i < order; i++) {
+
+		gramCount *= ALPHABET_LENGTH;
+
+	}
+
+	// A sliding window over the letters, in base 26, indexes the table of
+	// the chosen order directly.
+	for (std::size_t i = 0; i < count; i++) {
+
+		gram = (gram * ALPHABET_LENGTH + (letters[i] + shift) % ALPHABET_LENGTH) % gramCount;
+
+		if (i + 1 >= order) {
+
+			totalCost += readCost (costs + (ORDER_OFFSETS[order - 1] + gram) * 2);
+
+		}
+
+	}
+
+	return static_cast<double> (totalCost) / static_cast<double> (count - order + 1) / COST_SCALE;
+
+}
+
+//****************************************************************************
+std::size_t NgramProfile::collectLetters (const char* const text, const std::size_t length, unsigned char letters[SAMPLE_LETTERS]) {
+
+	const std::size_t sampleLetters = SAMPLE_LETTERS;
+	std::size_t count = 0;
+	unsigned int index = 0;
+
+	for (std::size_t i = 0; i < length && count < sampleLetters; i++) {
+
+		index = CaesarCipher::getLetterIndex (text[i]);
+
+		if (index < CaesarCipher::ALPHABET_LENGTH) {
+
+			letters[count] = index;
+			count++;
+
+		}
+
+	}
+
+	return count;
+
+}
+
+//****************************************************************************
+void NgramProfile::countSpan (const char* const corpus, const std::size_t start, const std::size_t end, unsigned long long* const counts) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const unsigned int maximumOrder = MAXIMUM_ORDER;
+	const unsigned int recentModulus = ALPHABET_LENGTH * ALPHABET_LENGTH * ALPHABET_LENGTH;
+	std::size_t position = start;
+	unsigned int seedCount = 0;
+	unsigned int recent = 0;
+	unsigned int recentCount = 0;
+	unsigned int index = 0;
+
+	// Back up over the letters that begin n-grams ending in this span. They
+	// are read but not counted, since the span before counts them.
+	while (position > 0 && seedCount < maximumOrder - 1) {
+
+		position--;
+
+		if (CaesarCipher::getLetterIndex (corpus[position]) < ALPHABET_LENGTH) {
+
+			seedCount++;
+
+		}
+
+	}
+
+	for (; position < end; position++) {
+
+		index = CaesarCipher::getLetterIndex (corpus[position]);
+
+		if (index < ALPHABET_LENGTH) {
+
+			if (position >= start) {
+
+				counts[index]++;
+
+				if (recentCount >= 1) {
+
+					counts[ORDER_OFFSETS[1] + (recent % ALPHABET_LENGTH) * ALPHABET_LENGTH + index]++;
+
+				}
+
+				if (recentCount >= 2) {
+
+					counts[ORDER_OFFSETS[2] + (recent % (ALPHABET_LENGTH * ALPHABET_LENGTH)) * ALPHABET_LENGTH + index]++;
+
+				}
+
+				if (recentCount >= 3) {
+
+					counts[ORDER_OFFSETS[3] + recent * ALPHABET_LENGTH + index]++;
+
+				}
+
+			}
+
+			// The last three letters, in base 26.
+			recent = (recent * ALPHABET_LENGTH + index) % recentModulus;
+
+			if (recentCount < maximumOrder - 1) {
+
+				recentCount++;
+
+			}
+
+		}
+
+	}
+
+}
@@ -0,0 +1,178 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * N-gram scoring from:				http://practicalcryptography.com/cryptanalysis/text-characterisation/quadgrams/
+ * Log probabilities from:			https://en.wikipedia.org/wiki/Log_probability
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "CaesarCipher.h"
+#include "MappedFile.h"
+#include "WorkStealingPool.h"
+
+#ifndef NGRAM_PROFILE_H
+#define NGRAM_PROFILE_H
+
+/**
+ * How often every letter, pair, triple and quadruple of letters occurs in a
+ * body of text, trained from a corpus of the text a cipher is expected to
+ * hide rather than typed in. Keys are ranked by how likely the n-grams of
+ * their plaintext are, which tells keys apart on messages far too short for
+ * letter frequencies alone. Profiles are stored as tables of costs, so a
+ * memory mapped profile is scored against without being parsed.
+ */
+class NgramProfile {
+
+public:
+	// Public Static Constants ***********************************************
+	static const unsigned int MAXIMUM_ORDER = 4;		/**< Longest n-grams counted, quadgrams. */
+	static const std::size_t SAMPLE_LETTERS = 4096;		/**< Letters of a text read when ranking keys. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Creates an empty profile.
+	 */
+	NgramProfile (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the number of letters the profile was trained on.
+	 * @return the number of letters in the corpus.
+	 */
+	unsigned long long getLetterCount (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Opens a profile file by mapping it into memory.
+	 * @param filename of the profile.
+	 * @return true if opened, otherwise false.
+	 */
+	bool open (const std::string& filename);
+
+	/**
+	 * Replaces the profile with one held in memory.
+	 * @param contents, a profile as returned by train.
+	 * @return true if loaded, otherwise false.
+	 */
+	bool load (const std::string& contents);
+
+	/**
+	 * Deciphers a text with a key and measures how unlikely its n-grams are.
+	 * Only letters count, so n-grams run across spaces and punctuation. The
+	 * longest order the text has enough letters for is used.
+	 * @param ciphertext to decipher.
+	 * @param length, number of characters in ciphertext.
+	 * @param key to decipher with. Zero measures the text as it is.
+	 * @return the mean cost of an n-gram in bits, or zero if the text has no
+	 * letters. Lower is better.
+	 */
+	double scoreKey (const char* const ciphertext, const std::size_t length, const unsigned int key) const;
+
+	/**
+	 * Scores every key over the first SAMPLE_LETTERS letters of a text and
+	 * ranks them, best first. The lowest key comes first among equal scores.
+	 * Does not allocate from the heap.
+	 * @param ciphertext to rank keys for.
+	 * @param length, number of characters in ciphertext.
+	 * @param rankedKeys, where to store every key, best first.
+	 * @param rankedScores, where to store the score of each ranked key.
+	 */
+	void rankKeys (const char* const ciphertext, const std::size_t length, unsigned int rankedKeys[CaesarCipher::ALPHABET_LENGTH], double rankedScores[CaesarCipher::ALPHABET_LENGTH]) const;
+
+	/**
+	 * Counts every unigram through quadgram of a corpus and builds a profile
+	 * in the binary profile format: the bytes "CCNG", a 2 byte format version,
+	 * an 8 byte letter count, a 2 byte cost for each of the 26 unigrams, 676
+	 * bigrams, 17576 trigrams and 456976 quadgrams in alphabetical order, and
+	 * an 8 byte checksum. A cost is the n-gram's negative log probability in
+	 * 1024ths of a bit. The corpus is split into one span per thread of the
+	 * pool, each counted into its own tables, which are merged once every
+	 * span is done.
+	 * @param corpus to train on.
+	 * @param length, number of characters in corpus.
+	 * @param pool to count spans on.
+	 * @return the profile.
+	 */
+	static std::string train (const char* const corpus, const std::size_t length, WorkStealingPool& pool);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;			/**< Version of the binary profile format. */
+	static const std::size_t HEADER_LENGTH = 14;			/**< Bytes before the cost tables. */
+	static const std::size_t ENTRY_COUNT = 475254;			/**< Number of n-grams of every order together. */
+	static const unsigned int COST_SCALE = 1024;			/**< Costs are stored in 1/COST_SCALE bits. */
+	static const unsigned int MAXIMUM_COST = 0xFFFF;		/**< Largest cost that can be stored. */
+	static const double UNSEEN_COUNT;						/**< Count an n-gram missing from the corpus is given, to keep its cost finite. */
+	static const std::size_t ORDER_OFFSETS[MAXIMUM_ORDER];	/**< Index of the first n-gram of each order, from unigrams. */
+	static const char MAGIC[4];								/**< Bytes every profile starts with. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Points the profile at a profile after checking it.
+	 * @param data, the profile, which must outlive the view.
+	 * @param length, number of bytes in data.
+	 * @return true if intact, otherwise false.
+	 */
+	bool attach (const char* const data, const std::size_t length);
+
+	/**
+	 * Measures the mean cost of the n-grams of letters deciphered with a key.
+	 * @param letters, the alphabet index of each letter, from zero for A.
+	 * @param count, number of letters.
+	 * @param key to decipher with.
+	 * @return the mean cost of an n-gram in bits, or zero if there are no
+	 * letters.
+	 */
+	double scoreLetters (const unsigned char* const letters, const std::size_t count, const unsigned int key) const;
+
+	/**
+	 * Collects the alphabet index of each letter at the start of a text.
+	 * @param text to collect letters from.
+	 * @param length, number of characters in text.
+	 * @param letters, where to store the indices, SAMPLE_LETTERS long.
+	 * @return the number of letters collected, at most SAMPLE_LETTERS.
+	 */
+	static std::size_t collectLetters (const char* const text, const std::size_t length, unsigned char letters[SAMPLE_LETTERS]);
+
+	/**
+	 * Counts the n-grams of the letters in one span of a corpus. N-grams that
+	 * start before the span but end inside it are counted, so that spans
+	 * together count every n-gram exactly once.
+	 * @param corpus being trained on.
+	 * @param start of the span.
+	 * @param end of the span, one past its last character.
+	 * @param counts, where to add the count of each n-gram, ENTRY_COUNT long.
+	 */
+	static void countSpan (const char* const corpus, const std::size_t start, const std::size_t end, unsigned long long* const counts);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the profile, which may point into its own
+	 * members, from being copied.
+	 * @param ngramProfile to copy from.
+	 */
+	NgramProfile (const NgramProfile& ngramProfile);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the profile from being copied.
+	 * @param ngramProfile to copy from.
+	 * @return this NgramProfile.
+	 */
+	NgramProfile& operator= (const NgramProfile& ngramProfile);
+
+	// Private Members *******************************************************
+	MappedFile			mappedFile;		/**< Mapping of an opened profile. */
+	std::string			contents;		/**< Profile, when loaded in memory. */
+	const char*			costs;			/**< Cost of each n-gram, 2 bytes each. */
+	unsigned long long	letterCount;	/**< Letters the profile was trained on. */
+
+};
+
+#endif
@@ -0,0 +1,454 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * SIMD character classification from:	http://0x80.pl/articles/simd-byte-lookup.html
+ * Base64 from:							https://en.wikipedia.org/wiki/Base64
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include "CaesarCipher.h"
+#include "ProseFilter.h"
+
+// Every x86-64 processor has SSE2, so unlike the translation kernels the mask
+// builder needs no run time check.
+#if defined(__GNUC__) && defined(__x86_64__)
+#define PROSE_FILTER_SSE2_MASKS
+#include <emmintrin.h>
+#endif
+
+// Helper Functions **********************************************************
+/**
+ * Counts the set bits of a mask.
+ * @param mask to count.
+ * @return the number of set bits.
+ */
+static inline unsigned int countBits (unsigned long long mask) {
+
+#ifdef __GNUC__
+	return static_cast<unsigned int> (__builtin_popcountll (mask));
+#else
+	unsigned int count = 0;
+
+	for (; mask != 0; mask &= mask - 1) {
+
+		count++;
+
+	}
+
+	return count;
+#endif
+
+}
+
+/**
+ * Finds the lowest set bit of a mask.
+ * @param mask to search, which must not be zero.
+ * @return the index of the lowest set bit.
+ */
+static inline unsigned int findLowestBit (const unsigned long long mask) {
+
+#ifdef __GNUC__
+	return static_cast<unsigned int> (__builtin_ctzll (mask));
+#else
+	unsigned int index = 0;
+
+	while (((mask >> index) & 1) == 0) {
+
+		index++;
+
+	}
+
+	return index;
+#endif
+
+}
+
+/**
+ * Finds the highest set bit of a mask.
+ * @param mask to search, which must not be zero.
+ * @return the index of the highest set bit.
+ */
+static inline unsigned int findHighestBit (const unsigned long long mask) {
+
+#ifdef __GNUC__
+	return 63 - static_cast<unsigned int> (__builtin_clzll (mask));
+#else
+	unsigned int index = 63;
+
+	while (((mask >> index) & 1) == 0) {
+
+		index--;
+
+	}
+
+	return index;
+#endif
+
+}
+
+/**
+ * Checks whether a mask has a run of more than 24 set bits, by shifting it
+ * onto itself so that a bit survives only at the end of a long enough run.
+ * @param mask to check.
+ * @return true if there is such a run, otherwise false.
+ */
+static inline bool hasLongRun (const unsigned long long mask) {
+
+	unsigned long long runs = mask & (mask >> 1);
+
+	runs &= runs >> 2;
+	runs &= runs >> 4;
+	runs &= runs >> 8;
+
+	// Runs of 16 or more, then of 16 + 9.
+	return (runs & (runs >> 9)) != 0;
+
+}
+
+// Method Definitions ********************************************************
+const char* ProseFilter::getClassName (const SpanClass spanClass) {
+
+	switch (spanClass) {
+
+	case URL:
+		return "url";
+
+	case ENCODED:
+		return "encoded";
+
+	case IDENTIFIER:
+		return "identifier";
+
+	case BINARY:
+		return "binary";
+
+	default:
+		return "prose";
+
+	}
+
+}
+
+//****************************************************************************
+unsigned int ProseFilter::countProseLetters (const char* const text, const std::size_t length, unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], unsigned long long classBytes[CLASS_COUNT]) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const std::size_t blockSize = BLOCK_SIZE;
+	const unsigned char* const bytes = reinterpret_cast<const unsigned char*> (text);
+	unsigned int spanCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int totalLetters = 0;
+	std::size_t proseStart = 0;
+	unsigned long long carriedLowercase = 0;
+	unsigned long long lowercase = 0;
+	unsigned long long innerCapitals = 0;
+	unsigned long long segment = 0;
+	unsigned int position = 0;
+	unsigned int end = 0;
+	bool isInToken = false;
+	Token token;
+	BlockMasks masks;
+
+	memset (letterCounts, 0, sizeof (unsigned int) * ALPHABET_LENGTH);
+	memset (classBytes, 0, sizeof (unsigned long long) * CLASS_COUNT);
+
+	// Prose runs on until a token that is not prose ends it, so the letters
+	// of a whole run are counted at once.
+	auto countProse = [&] (const std::size_t proseEnd) {
+
+		if (proseEnd > proseStart) {
+
+			totalLetters += CaesarCipher::countLetters (text + proseStart, proseEnd - proseStart, spanCounts);
+
+			for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+				letterCounts[i] += spanCounts[i];
+
+			}
+
+		}
+
+	};
+
+	auto finishToken = [&] (const std::size_t tokenEnd) {
+
+		const SpanClass spanClass = classifyToken (token, tokenEnd - token.start);
+
+		classBytes[spanClass] += tokenEnd - token.start;
+
+		if (spanClass != PROSE) {
+
+			countProse (token.start);
+			proseStart = tokenEnd;
+
+		}
+
+	};
+
+	for (std::size_t blockStart = 0; blockStart < length; blockStart += blockSize) {
+
+		if (length - blockStart >= blockSize) {
+
+			classifyBlock (bytes + blockStart, masks);
+
+		} else {
+
+			classifyBlockScalar (bytes + blockStart, length - blockStart, masks);
+
+		}
+
+		lowercase = masks.letters & ~masks.uppercase;
+		innerCapitals = masks.uppercase & ((lowercase << 1) | carriedLowercase);
+		carriedLowercase = lowercase >> (blockSize - 1);
+		position = 0;
+
+		// In a block of plain words, which is most blocks of prose, every
+		// token between the first and last whitespace is prose, so only the
+		// tokens at the ends of the block need walking.
+		if (masks.whitespace != 0 && (masks.digits | masks.controls | masks.underscores | masks.slashes | innerCapitals) == 0 && !hasLongRun (~masks.whitespace)) {
+
+			position = findLowestBit (masks.whitespace);
+			end = findHighestBit (masks.whitespace);
+
+			if (isInToken) {
+
+				token.letterCount += countBits (masks.letters & ((1ULL << position) - 1));
+				finishToken (blockStart + position);
+				isInToken = false;
+
+			} else {
+
+				// A word that starts the block, with whitespace before it in
+				// the block before, is as much prose as those after it.
+				classBytes[PROSE] += countBits (~masks.whitespace & ((1ULL << position) - 1));
+
+			}
+
+			classBytes[PROSE] += countBits (~masks.whitespace & (~0ULL << position) & ((end + 1 == blockSize) ? ~0ULL : ((1ULL << (end + 1)) - 1)));
+			position = end + 1;
+
+		}
+
+		// Each pass of the loop jumps straight to the next token boundary, so
+		// a long token costs a few mask operations per block whatever it holds.
+		while (position < blockSize) {
+
+			if (!isInToken) {
+
+				segment = ~masks.whitespace >> position;
+
+				if (segment != 0) {
+
+					position += findLowestBit (segment);
+					isInToken = true;
+					memset (&token, 0, sizeof (token));
+					token.start = blockStart + position;
+
+				} else {
+
+					position = blockSize;
+
+				}
+
+			}
+
+			if (isInToken) {
+
+				segment = masks.whitespace >> position;
+				end = (segment != 0) ? position + findLowestBit (segment) : blockSize;
+				segment = ((end - position == blockSize) ? ~0ULL : ((1ULL << (end - position)) - 1)) << position;
+
+				token.letterCount += countBits (masks.letters & segment);
+				token.digitCount += countBits (masks.digits & segment);
+				token.slashCount += countBits (masks.slashes & segment);
+				token.hasControl = token.hasControl || (masks.controls & segment) != 0;
+				token.hasUnderscore = token.hasUnderscore || (masks.underscores & segment) != 0;
+				token.hasInnerCapital = token.hasInnerCapital || (innerCapitals & segment) != 0;
+
+				if (end < blockSize) {
+
+					finishToken (blockStart + end);
+					isInToken = false;
+
+				}
+
+				position = end;
+
+			}
+
+		}
+
+	}
+
+	if (isInToken) {
+
+		finishToken (length);
+
+	}
+
+	countProse (length);
+
+	return totalLetters;
+
+}
+
+//****************************************************************************
+unsigned int ProseFilter::countProseLetters (const std::string& text, unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], unsigned long long classBytes[CLASS_COUNT]) {
+
+	return countProseLetters (text.data (), text.length (), letterCounts, classBytes);
+
+}
+
+//****************************************************************************
+void ProseFilter::classifyBlockScalar (const unsigned char* const block, const std::size_t count, BlockMasks& masks) {
+
+	const std::size_t blockSize = BLOCK_SIZE;
+	unsigned long long bit = 0;
+	unsigned char character = 0;
+
+	memset (&masks, 0, sizeof (masks));
+
+	for (std::size_t i = 0; i < blockSize; i++) {
+
+		bit = 1ULL << i;
+
+		if (i >= count) {
+
+			masks.whitespace |= bit;
+
+		} else {
+
+			character = block[i];
+
+			if (character == ' ' || static_cast<unsigned char> (character - '\t') <= '\r' - '\t') {
+
+				masks.whitespace |= bit;
+
+			} else if (character < ' ' || character == 0x7F) {
+
+				masks.controls |= bit;
+
+			}
+
+			if (CaesarCipher::getLetterIndex (character) < CaesarCipher::ALPHABET_LENGTH) {
+
+				masks.letters |= bit;
+
+			}
+
+			if (static_cast<unsigned char> (character - 'A') < CaesarCipher::ALPHABET_LENGTH) {
+
+				masks.uppercase |= bit;
+
+			}
+
+			if (static_cast<unsigned char> (character - '0') < 10) {
+
+				masks.digits |= bit;
+
+			}
+
+			if (character == '_') {
+
+				masks.underscores |= bit;
+
+			}
+
+			if (character == '/') {
+
+				masks.slashes |= bit;
+
+			}
+
+		}
+
+	}
+
+}
+
+//****************************************************************************
+void ProseFilter::classifyBlock (const unsigned char* const block, BlockMasks& masks) {
+
+#ifdef PROSE_FILTER_SSE2_MASKS
+	const __m128i caseBit = _mm_set1_epi8 (0x20);
+	const __m128i firstLetter = _mm_set1_epi8 ('a');
+	const __m128i firstUppercase = _mm_set1_epi8 ('A');
+	const __m128i lastLetterIndex = _mm_set1_epi8 (CaesarCipher::ALPHABET_LENGTH - 1);
+	const __m128i firstDigit = _mm_set1_epi8 ('0');
+	const __m128i lastDigitIndex = _mm_set1_epi8 (9);
+	const __m128i firstSpacing = _mm_set1_epi8 ('\t');
+	const __m128i lastSpacingIndex = _mm_set1_epi8 ('\r' - '\t');
+	const __m128i lastControl = _mm_set1_epi8 (' ' - 1);
+	const __m128i space = _mm_set1_epi8 (' ');
+	const __m128i deleteCharacter = _mm_set1_epi8 (0x7F);
+	const __m128i underscore = _mm_set1_epi8 ('_');
+	const __m128i slash = _mm_set1_epi8 ('/');
+
+	memset (&masks, 0, sizeof (masks));
+
+	for (unsigned int i = 0; i < BLOCK_SIZE; i += 16) {
+
+		const __m128i bytes = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (block + i));
+
+		// A byte is in a range when subtracting the range's start leaves it no
+		// larger than the range's length, compared unsigned through min.
+		const __m128i letterIndex = _mm_sub_epi8 (_mm_or_si128 (bytes, caseBit), firstLetter);
+		const __m128i uppercaseIndex = _mm_sub_epi8 (bytes, firstUppercase);
+		const __m128i digitIndex = _mm_sub_epi8 (bytes, firstDigit);
+		const __m128i spacingIndex = _mm_sub_epi8 (bytes, firstSpacing);
+		const __m128i isSpacing = _mm_cmpeq_epi8 (_mm_min_epu8 (spacingIndex, lastSpacingIndex), spacingIndex);
+		const __m128i isControl = _mm_or_si128 (_mm_cmpeq_epi8 (_mm_min_epu8 (bytes, lastControl), bytes), _mm_cmpeq_epi8 (bytes, deleteCharacter));
+
+		masks.whitespace |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_or_si128 (isSpacing, _mm_cmpeq_epi8 (bytes, space))))) << i;
+		masks.controls |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_andnot_si128 (isSpacing, isControl)))) << i;
+		masks.letters |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_min_epu8 (letterIndex, lastLetterIndex), letterIndex)))) << i;
+		masks.uppercase |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_min_epu8 (uppercaseIndex, lastLetterIndex), uppercaseIndex)))) << i;
+		masks.digits |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_min_epu8 (digitIndex, lastDigitIndex), digitIndex)))) << i;
+		masks.underscores |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (bytes, underscore)))) << i;
+		masks.slashes |= static_cast<unsigned long long> (static_cast<unsigned int> (_mm_movemask_epi8 (_mm_cmpeq_epi8 (bytes, slash)))) << i;
+
+	}
+#else
+	classifyBlockScalar (block, BLOCK_SIZE, masks);
+#endif
+
+}
+
+//****************************************************************************
+ProseFilter::SpanClass ProseFilter::classifyToken (const Token& token, const std::size_t length) {
+
+	// Vowels would tell identifiers from words, but which letters are vowels
+	// depends on the key, so only the kinds of characters are used.
+	if (token.hasControl) {
+
+		return BINARY;
+
+	}
+
+	if (token.slashCount >= URL_SLASHES) {
+
+		return URL;
+
+	}
+
+	if (token.letterCount != 0 && token.digitCount != 0 && length >= MINIMUM_ENCODED_LENGTH) {
+
+		return ENCODED;
+
+	}
+
+	if (token.hasUnderscore || token.hasInnerCapital || length > MAXIMUM_WORD_LENGTH) {
+
+		return IDENTIFIER;
+
+	}
+
+	return PROSE;
+
+}
@@ -0,0 +1,170 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * SIMD character classification from:	http://0x80.pl/articles/simd-byte-lookup.html
+ * Base64 from:							https://en.wikipedia.org/wiki/Base64
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "CaesarCipher.h"
+
+#ifndef PROSE_FILTER_H
+#define PROSE_FILTER_H
+
+/**
+ * Static class that keeps the letters of URLs, encoded blobs, identifiers and
+ * binary data out of a histogram, since letters that are not prose skew it
+ * toward the wrong key. Text is split into tokens at whitespace and each
+ * token is classified by what it is made of. Only the character classes are
+ * looked at, never which letters a token has, so the classification is the
+ * same whatever key the text is enciphered under. Character classes are
+ * found 64 bytes at a time as bit masks, so tokens that are not prose are
+ * classified without their bytes being looked at one by one.
+ */
+class ProseFilter {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * What a token most likely is.
+	 */
+	enum SpanClass {
+
+		PROSE,			/**< Words of natural language. */
+		URL,			/**< URLs and paths, with two or more slashes. */
+		ENCODED,		/**< Long runs of letters mixed with digits, such as hex and base64. */
+		IDENTIFIER,		/**< Over long words, or ones with underscores or inner capitals. */
+		BINARY			/**< Runs containing control characters. */
+
+	};
+
+	static const unsigned int CLASS_COUNT = BINARY + 1;		/**< Number of span classes. */
+
+	// Public Static Constants ***********************************************
+	static const std::size_t MAXIMUM_WORD_LENGTH = 24;		/**< Longest token, in bytes, taken for a word. */
+	static const std::size_t MINIMUM_ENCODED_LENGTH = 8;	/**< Shortest token, in bytes, taken for an encoding. */
+
+	// Public Methods ********************************************************
+	/**
+	 * Returns the name of a span class.
+	 * @param spanClass to name.
+	 * @return the name of the class.
+	 */
+	static const char* getClassName (const SpanClass spanClass);
+
+	/**
+	 * Counts the letters of the prose in a text. Runs of prose tokens are
+	 * counted with CaesarCipher::countLetters, so the selected counting
+	 * kernel is used.
+	 * @param text to count.
+	 * @param length, number of characters in text.
+	 * @param letterCounts, where to store the number of times each letter
+	 * occurs in the prose.
+	 * @param classBytes, where to store the number of bytes of the tokens of
+	 * each class. Whitespace between tokens is not counted.
+	 * @return the number of letters in the prose.
+	 */
+	static unsigned int countProseLetters (const char* const text, const std::size_t length, unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], unsigned long long classBytes[CLASS_COUNT]);
+
+	/**
+	 * Counts the letters of the prose in a text.
+	 * @param text to count.
+	 * @param letterCounts, where to store the number of times each letter
+	 * occurs in the prose.
+	 * @param classBytes, where to store the number of bytes of the tokens of
+	 * each class.
+	 * @return the number of letters in the prose.
+	 */
+	static unsigned int countProseLetters (const std::string& text, unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH], unsigned long long classBytes[CLASS_COUNT]);
+
+private:
+	// Private Types *********************************************************
+	/**
+	 * Character classes of 64 bytes, one bit per byte.
+	 */
+	struct BlockMasks {
+
+		unsigned long long	whitespace;		/**< Spaces, tabs and line breaks, and every byte past the end of the text. */
+		unsigned long long	letters;		/**< Letters of either case. */
+		unsigned long long	uppercase;		/**< Uppercase letters. */
+		unsigned long long	digits;			/**< Decimal digits. */
+		unsigned long long	controls;		/**< Control characters other than whitespace. */
+		unsigned long long	underscores;	/**< Underscores. */
+		unsigned long long	slashes;		/**< Forward slashes. */
+
+	};
+
+	/**
+	 * Character classes seen so far in a token.
+	 */
+	struct Token {
+
+		std::size_t		start;				/**< Offset of the token's first byte. */
+		unsigned int	letterCount;		/**< Number of letters. */
+		unsigned int	digitCount;			/**< Number of digits. */
+		unsigned int	slashCount;			/**< Number of forward slashes. */
+		bool			hasControl;			/**< Whether the token has a control character. */
+		bool			hasUnderscore;		/**< Whether the token has an underscore. */
+		bool			hasInnerCapital;	/**< Whether an uppercase letter follows a lowercase one. */
+
+	};
+
+	// Private Static Constants **********************************************
+	static const std::size_t BLOCK_SIZE = 64;		/**< Bytes classified at once, one per mask bit. */
+	static const unsigned int URL_SLASHES = 2;		/**< Fewest slashes a URL or path is taken to have. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Classifies the bytes of a block one at a time.
+	 * @param block to classify.
+	 * @param count, number of bytes in block, at most BLOCK_SIZE. The rest
+	 * are taken for whitespace.
+	 * @param masks, where to store the character classes.
+	 */
+	static void classifyBlockScalar (const unsigned char* const block, const std::size_t count, BlockMasks& masks);
+
+	/**
+	 * Classifies a whole block 16 bytes at a time with SSE2, which every
+	 * x86-64 processor has. Falls back to classifyBlockScalar elsewhere.
+	 * @param block to classify, BLOCK_SIZE bytes long.
+	 * @param masks, where to store the character classes.
+	 */
+	static void classifyBlock (const unsigned char* const block, BlockMasks& masks);
+
+	/**
+	 * Decides what a finished token is.
+	 * @param token to classify.
+	 * @param length, number of bytes in the token.
+	 * @return the class of the token.
+	 */
+	static SpanClass classifyToken (const Token& token, const std::size_t length);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	ProseFilter (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param proseFilter to copy from.
+	 */
+	ProseFilter (const ProseFilter& proseFilter);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param proseFilter to copy from.
+	 * @return this ProseFilter.
+	 */
+	ProseFilter& operator= (const ProseFilter& proseFilter);
+
+};
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Region based allocation overview from:	https://en.wikipedia.org/wiki/Region-based_memory_management
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "MonotonicArena.h"
+#include "RecordProcessor.h"
+#include "TreeProcessor.h"
+#include "WordDictionary.h"
+#include "WorkStealingPool.h"
+
+// Method Definitions ********************************************************
+RecordProcessor::RecordProcessor (const TreeProcessor::Operation operation, const unsigned int key) :
+	operation (operation),
+	key (key),
+	batchSize (DEFAULT_BATCH_SIZE),
+	dictionary (nullptr) {
+
+}
+
+//****************************************************************************
+void RecordProcessor::setBatchSize (const unsigned int batchSize) {
+
+	if (batchSize != 0) {
+
+		this->batchSize = batchSize;
+
+	}
+
+}
+
+//****************************************************************************
+void RecordProcessor::setDictionary (const WordDictionary* const dictionary) {
+
+	this->dictionary = dictionary;
+
+}
+
+//****************************************************************************
+std::string RecordProcessor::run (const std::string& records, WorkStealingPool& pool) const {
+
+	std::vector<std::size_t> batchStarts;
+	std::vector<std::string> batchOutputs;
+	std::string output;
+	std::size_t position = 0;
+	std::size_t outputLength = 0;
+	unsigned int linesInBatch = 0;
+
+	// Split the text into batches of whole lines.
+	batchStarts.push_back (0);
+
+	while (position < records.length ()) {
+
+		position = records.find ('\n', position);
+		position = (position == std::string::npos) ? records.length () : position + 1;
+
+		if (++linesInBatch == batchSize && position < records.length ()) {
+
+			batchStarts.push_back (position);
+			linesInBatch = 0;
+
+		}
+
+	}
+
+	batchStarts.push_back (records.length ());
+	batchOutputs.resize (batchStarts.size () - 1);
+
+	for (std::size_t i = 0; i + 1 < batchStarts.size (); i++) {
+
+		pool.submit ([this, &records, &batchStarts, &batchOutputs, i] {
+
+			MonotonicArena& arena = MonotonicArena::getThreadArena ();
+			TextSpan batchOutput;
+
+			// One reset releases everything the previous batch on this
+			// thread allocated.
+			arena.reset ();
+			batchOutput = processBatch (records.data () + batchStarts[i], batchStarts[i + 1] - batchStarts[i], arena);
+			batchOutputs[i].assign (batchOutput.data, batchOutput.length);
+
+		});
+
+	}
+
+	pool.wait ();
+
+	for (const std::string& batchOutput : batchOutputs) {
+
+		outputLength += batchOutput.length ();
+
+	}
+
+	output.reserve (outputLength);
+
+	for (const std::string& batchOutput : batchOutputs) {
+
+		output += batchOutput;
+
+	}
+
+	return output;
+
+}
+
+//****************************************************************************
+RecordProcessor::TextSpan RecordProcessor::processBatch (const char* const records, const std::size_t length, MonotonicArena& arena) const {
+
+	const char* const end = records + length;
+	const char* recordStart = records;
+	const char* recordEnd = nullptr;
+	std::size_t recordCount = 0;
+	std::size_t recordLength = 0;
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	unsigned int rankedKeys[CaesarCipher::ALPHABET_LENGTH];
+	double rankedScores[CaesarCipher::ALPHABET_LENGTH];
+	WordDictionary::Candidate candidates[WordDictionary::DEFAULT_CANDIDATE_COUNT];
+	unsigned int recordKey = key;
+	char* output = nullptr;
+	char* outputPosition = nullptr;
+	TextSpan result;
+
+	// Size the output up front so that every record is written straight into
+	// one arena buffer.
+	if (operation == TreeProcessor::CRACK) {
+
+		for (const char* position = records; position < end; position++) {
+
+			recordCount += (*position == '\n') ? 1 : 0;
+
+		}
+
+		recordCount++;
+
+	}
+
+	output = arena.allocate (length + recordCount * MAXIMUM_KEY_PREFIX_LENGTH);
+	outputPosition = output;
+
+	while (recordStart < end) {
+
+		recordEnd = static_cast<const char*> (memchr (recordStart, '\n', end - recordStart));
+		recordEnd = (recordEnd == nullptr) ? end : recordEnd;
+		recordLength = recordEnd - recordStart;
+
+		if (operation == TreeProcessor::ENCIPHER) {
+
+			CaesarCipher::encipher (recordStart, recordLength, key, outputPosition);
+
+		} else {
+
+			if (operation == TreeProcessor::CRACK) {
+
+				CaesarCipher::countLetters (recordStart, recordLength, letterCounts);
+
+				if (dictionary != nullptr) {
+
+					CaesarCipher::rankKeys (letterCounts, rankedKeys, rankedScores);
+
+					for (unsigned int i = 0; i < WordDictionary::DEFAULT_CANDIDATE_COUNT; i++) {
+
+						candidates[i].key = rankedKeys[i];
+						candidates[i].score = rankedScores[i];
+
+					}
+
+					dictionary->verifyKeys (recordStart, recordLength, candidates, WordDictionary::DEFAULT_CANDIDATE_COUNT);
+					recordKey = candidates[0].key;
+
+				} else {
+
+					recordKey = CaesarCipher::crackKey (letterCounts);
+
+				}
+
+				if (recordKey >= 10) {
+
+					*outputPosition++ = static_cast<char> ('0' + recordKey / 10);
+
+				}
+
+				*outputPosition++ = static_cast<char> ('0' + recordKey % 10);
+				*outputPosition++ = '\t';
+
+			}
+
+			CaesarCipher::decipher (recordStart, recordLength, recordKey, outputPosition);
+
+		}
+
+		outputPosition += recordLength;
+
+		if (recordEnd < end) {
+
+			*outputPosition++ = '\n';
+
+		}
+
+		recordStart = recordEnd + 1;
+
+	}
+
+	result.data = output;
+	result.length = outputPosition - output;
+
+	return result;
+
+}
@@ -0,0 +1,103 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Region based allocation overview from:	https://en.wikipedia.org/wiki/Region-based_memory_management
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "MonotonicArena.h"
+#include "TreeProcessor.h"
+#include "WordDictionary.h"
+#include "WorkStealingPool.h"
+
+#ifndef RECORD_PROCESSOR_H
+#define RECORD_PROCESSOR_H
+
+/**
+ * Enciphers, deciphers, or cracks each line of a text as a separate message.
+ * Lines are grouped into batches that run on a WorkStealingPool, and every
+ * buffer a batch needs comes from the worker's MonotonicArena, which is reset
+ * once per batch. Processing a message therefore never touches the heap once
+ * the arena has grown to fit a batch.
+ */
+class RecordProcessor {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Characters owned by an arena.
+	 */
+	struct TextSpan {
+
+		const char*	data;	/**< First character. */
+		std::size_t	length;	/**< Number of characters. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int DEFAULT_BATCH_SIZE = 4096;	/**< Number of records in each batch. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Prepares to process records.
+	 * @param operation to apply to each record.
+	 * @param key to encipher or decipher with. Ignored when cracking.
+	 */
+	RecordProcessor (const TreeProcessor::Operation operation, const unsigned int key);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Sets the number of records in each batch.
+	 * @param batchSize, number of records. Must not be zero.
+	 */
+	void setBatchSize (const unsigned int batchSize);
+
+	/**
+	 * Sets a dictionary to verify cracked keys with. The best few keys of each
+	 * record are then re-ranked by how many of their words it holds.
+	 * @param dictionary to verify with, which must outlive the processor, or
+	 * nullptr to rank by letter frequencies alone.
+	 */
+	void setDictionary (const WordDictionary* const dictionary);
+
+	// Public Methods ********************************************************
+	/**
+	 * Processes every line of the given text.
+	 * @param records, the text to process, one record per line.
+	 * @param pool to run batches on.
+	 * @return the processed records, one per line. When cracking each line is
+	 * the estimated key, a tab, and the plaintext.
+	 */
+	std::string run (const std::string& records, WorkStealingPool& pool) const;
+
+	/**
+	 * Processes a batch of whole lines. The result lives in the given arena
+	 * and does not allocate from the heap once the arena is large enough.
+	 * @param records, the lines to process.
+	 * @param length, number of characters in records.
+	 * @param arena to allocate the result from.
+	 * @return the processed lines.
+	 * @throw logic_error if cracking and a letter in the alphabet has a
+	 * frequency of zero.
+	 */
+	TextSpan processBatch (const char* const records, const std::size_t length, MonotonicArena& arena) const;
+
+private:
+	// Private Static Constants **********************************************
+	static const std::size_t MAXIMUM_KEY_PREFIX_LENGTH = 3;	/**< Characters a crack adds to a record: up to two digits and a tab. */
+
+	// Private Members *******************************************************
+	TreeProcessor::Operation	operation;	/**< Operation applied to each record. */
+	unsigned int				key;		/**< Key to encipher or decipher with. */
+	unsigned int				batchSize;	/**< Number of records in each batch. */
+	const WordDictionary*		dictionary;	/**< Dictionary to verify cracked keys with. May be nullptr. */
+
+};
+
+#endif
@@ -0,0 +1,692 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Substitution cipher from:		https://en.wikipedia.org/wiki/Substitution_cipher
+ * Hill climbing crack from:		http://practicalcryptography.com/cryptanalysis/stochastic-searching/cryptanalysis-simple-substitution-cipher/
+ * Incremental bigram fitness from:	Jakobsen, T. "A Fast Method for the Cryptanalysis of Substitution Ciphers", Cryptologia 19(3), 1995.
+ * Shuffle lookups from:			https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "SubstitutionCipher.h"
+#include "WorkStealingPool.h"
+
+// The shuffle kernels are compiled for their own instruction sets and picked
+// at run time, so a plain build still uses them where the processor can.
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SUBSTITUTION_CIPHER_SHUFFLE_KERNELS
+#include <immintrin.h>
+#endif
+
+// Static Variables **********************************************************
+static std::atomic<int> selectedTranslationKernel (-1);	/**< Translation kernel in use, or -1 until first chosen. */
+
+// Static Constant Definitions ***********************************************
+const double SubstitutionCipher::MINIMUM_FREQUENCY = 0.5;
+
+/**
+ * Bigram frequencies counted within the words of Isaac Newton's Opticks and
+ * several software licenses, about 410,000 bigrams in all. Rows are the first
+ * letter and columns the second.
+ */
+const double SubstitutionCipher::BIGRAM_FREQUENCIES[BIGRAM_COUNT] = {
+
+	// A
+	10, 1842, 5362, 2418, 12, 617, 1532, 15, 2225, 46, 1220, 8229, 2559,
+	22066, 7, 2188, 61, 10766, 7919, 13152, 678, 1086, 354, 215, 3486, 12,
+
+	// B
+	373, 171, 122, 54, 7048, 5, 2, 44, 761, 439, 0, 3489, 24,
+	10, 2449, 5, 2, 1337, 966, 107, 2022, 5, 0, 20, 4221, 0,
+
+	// C
+	2535, 54, 751, 46, 7519, 20, 10, 5470, 2557, 15, 1391, 1578, 0,
+	17, 10142, 15, 20, 883, 44, 5840, 1788, 0, 0, 2, 39, 0,
+
+	// D
+	656, 10, 10, 556, 6838, 12, 256, 24, 6699, 27, 15, 383, 17,
+	12, 1637, 5, 2, 339, 847, 220, 586, 39, 15, 0, 359, 0,
+
+	// E
+	5789, 256, 4989, 10620, 3784, 4769, 961, 112, 2869, 17, 227, 2869, 2259,
+	13011, 288, 1071, 954, 21779, 13791, 4279, 12, 1195, 600, 2542, 1822, 12,
+
+	// F
+	1425, 2, 5, 0, 1620, 961, 54, 2, 3328, 0, 7, 1554, 24,
+	2, 4660, 0, 2, 5106, 17, 1122, 417, 0, 0, 0, 195, 0,
+
+	// G
+	739, 0, 0, 15, 3469, 5, 122, 4311, 1225, 0, 5, 1996, 83,
+	442, 605, 22, 7, 2806, 688, 254, 578, 0, 0, 2, 24, 0,
+
+	// H
+	8444, 10, 0, 5, 40000, 10, 2, 0, 8031, 12, 2, 20, 59,
+	15, 3437, 5, 5, 998, 90, 3445, 364, 0, 2, 0, 212, 2,
+
+	// I
+	1188, 2347, 6994, 2935, 2574, 3025, 4350, 2, 183, 0, 454, 3479, 2486,
+	23096, 8231, 388, 422, 4784, 10693, 11688, 446, 1632, 0, 749, 0, 146,
+
+	// J
+	46, 0, 0, 0, 488, 0, 0, 0, 0, 0, 7, 0, 0,
+	0, 61, 2, 0, 0, 0, 5, 76, 0, 0, 0, 0, 0,
+
+	// K
+	105, 0, 2, 0, 1576, 2, 0, 10, 546, 0, 2, 37, 7,
+	720, 27, 2, 10, 0, 298, 5, 7, 0, 7, 0, 10, 0,
+
+	// L
+	4765, 0, 32, 1227, 9905, 398, 41, 0, 7787, 5, 22, 6553, 105,
+	24, 4674, 93, 0, 34, 1005, 586, 2061, 332, 76, 0, 3476, 0,
+
+	// M
+	4840, 586, 46, 2, 6999, 76, 7, 5, 2798, 0, 5, 41, 368,
+	124, 3272, 1420, 2, 22, 1044, 20, 1020, 15, 0, 5, 188, 0,
+
+	// N
+	1566, 0, 5126, 15621, 6636, 488, 9258, 2, 1630, 12, 129, 483, 32,
+	546, 4164, 27, 22, 15, 6482, 8000, 808, 503, 54, 2, 1637, 0,
+
+	// O
+	393, 1705, 683, 1998, 220, 15274, 803, 68, 695, 7, 407, 4896, 5179,
+	16121, 934, 2806, 0, 12025, 3450, 5579, 9829, 1371, 3074, 17, 61, 20,
+
+	// P
+	4862, 0, 2, 10, 5318, 0, 7, 551, 866, 0, 0, 2174, 5,
+	10, 3974, 1622, 22, 4382, 178, 873, 861, 0, 29, 0, 515, 0,
+
+	// Q
+	0, 0, 7, 0, 2, 5, 0, 0, 0, 0, 7, 0, 2,
+	2, 0, 0, 0, 59, 0, 5, 2091, 0, 0, 0, 0, 0,
+
+	// R
+	9266, 154, 1466, 1759, 21578, 710, 700, 56, 6858, 22, 1088, 359, 1705,
+	534, 6816, 639, 5, 615, 4230, 4099, 749, 856, 242, 0, 2052, 0,
+
+	// S
+	1715, 2, 893, 12, 10864, 78, 10, 2003, 5035, 0, 93, 385, 1598,
+	17, 4269, 2130, 156, 2, 4579, 8114, 3494, 20, 105, 0, 229, 0,
+
+	// T
+	3681, 5, 71, 5, 11244, 7, 0, 51976, 11234, 0, 0, 1122, 124,
+	68, 8690, 46, 22, 3564, 3516, 1520, 1388, 12, 1732, 20, 1320, 5,
+
+	// U
+	1476, 1054, 1940, 415, 1532, 210, 1093, 0, 803, 0, 5, 2230, 2113,
+	2862, 227, 1471, 0, 5855, 3325, 4347, 68, 7, 0, 10, 2, 2,
+
+	// V
+	1356, 0, 0, 0, 6536, 0, 0, 0, 1905, 0, 0, 0, 0,
+	7, 173, 0, 0, 0, 7, 12, 32, 0, 2, 12, 17, 0,
+
+	// W
+	3245, 0, 0, 78, 2384, 0, 0, 5967, 4001, 0, 0, 66, 0,
+	393, 1932, 0, 0, 105, 246, 7, 0, 0, 37, 0, 0, 0,
+
+	// X
+	102, 0, 351, 0, 220, 0, 0, 149, 725, 0, 0, 7, 5,
+	0, 2, 827, 0, 10, 0, 661, 2, 24, 0, 7, 63, 0,
+
+	// Y
+	32, 12, 2, 2, 1271, 2, 5, 2, 261, 0, 7, 29, 34,
+	12, 1471, 73, 0, 246, 2096, 12, 0, 0, 0, 5, 7, 17,
+
+	// Z
+	29, 0, 0, 2, 68, 0, 0, 0, 27, 0, 0, 2, 0,
+	0, 37, 0, 0, 0, 0, 0, 5, 0, 0, 0, 2, 0
+
+};
+
+// Translation Kernels *******************************************************
+/**
+ * Translates the letters of a buffer through a table one byte at a time.
+ * Setting the case bit of a letter and subtracting 'a' yields its index in
+ * the alphabet; anything else yields an index past the end.
+ * @param input to translate.
+ * @param length, number of bytes in input.
+ * @param table, the lowercase letter each letter becomes.
+ * @param output, where to store length translated bytes.
+ */
+static void translateScalar (const unsigned char* const input, const std::size_t length, const unsigned char* const table, unsigned char* const output) {
+
+	unsigned char character = 0;
+	unsigned int index = 0;
+
+	for (std::size_t i = 0; i < length; i++) {
+
+		character = input[i];
+		index = CaesarCipher::getLetterIndex (character);
+
+		// Uppercase letters are the ones without the case bit, so flipping it
+		// back on the lowercase replacement restores their case.
+		output[i] = (index < CaesarCipher::ALPHABET_LENGTH) ? static_cast<unsigned char> (table[index] ^ (~character & 0x20)) : character;
+
+	}
+
+}
+
+#ifdef SUBSTITUTION_CIPHER_SHUFFLE_KERNELS
+/**
+ * Translates 16 bytes at a time with pshufb. One shuffle only reaches 16
+ * entries, so each half of the alphabet has its own table.
+ * @param input to translate.
+ * @param length, number of bytes in input.
+ * @param table, the lowercase letter each letter becomes.
+ * @param output, where to store length translated bytes.
+ */
+__attribute__ ((target ("ssse3")))
+static void translateSsse3 (const unsigned char* const input, const std::size_t length, const unsigned char* const table, unsigned char* const output) {
+
+	const __m128i lowTable = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (table));
+	const __m128i highTable = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (table + 16));
+	const __m128i caseBit = _mm_set1_epi8 (0x20);
+	const __m128i firstLetter = _mm_set1_epi8 ('a');
+	const __m128i lastIndex = _mm_set1_epi8 (CaesarCipher::ALPHABET_LENGTH - 1);
+	const __m128i half = _mm_set1_epi8 (16);
+	std::size_t i = 0;
+
+	for (; i + 16 <= length; i += 16) {
+
+		const __m128i bytes = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (input + i));
+		const __m128i index = _mm_sub_epi8 (_mm_or_si128 (bytes, caseBit), firstLetter);
+		const __m128i isLetter = _mm_cmpeq_epi8 (_mm_min_epu8 (index, lastIndex), index);
+
+		// pshufb zeroes any lane whose index has its high bit set, which is
+		// every first half letter once 16 is subtracted.
+		const __m128i low = _mm_and_si128 (_mm_cmpgt_epi8 (half, index), _mm_shuffle_epi8 (lowTable, index));
+		const __m128i high = _mm_shuffle_epi8 (highTable, _mm_sub_epi8 (index, half));
+		const __m128i letters = _mm_xor_si128 (_mm_or_si128 (low, high), _mm_andnot_si128 (bytes, caseBit));
+
+		_mm_storeu_si128 (reinterpret_cast<__m128i*> (output + i), _mm_or_si128 (_mm_and_si128 (isLetter, letters), _mm_andnot_si128 (isLetter, bytes)));
+
+	}
+
+	translateScalar (input + i, length - i, table, output + i);
+
+}
+
+/**
+ * Translates 64 bytes at a time with vpermb, whose 64 entry reach covers the
+ * whole alphabet in one lookup. Masked loads and stores handle the tail.
+ * @param input to translate.
+ * @param length, number of bytes in input.
+ * @param table, the lowercase letter each letter becomes, padded to 64 bytes.
+ * @param output, where to store length translated bytes.
+ */
+__attribute__ ((target ("avx512f,avx512bw,avx512vbmi")))
+static void translateAvx512 (const unsigned char* const input, const std::size_t length, const unsigned char* const table, unsigned char* const output) {
+
+	const __m512i lookup = _mm512_loadu_si512 (table);
+	const __m512i caseBit = _mm512_set1_epi8 (0x20);
+	const __m512i firstLetter = _mm512_set1_epi8 ('a');
+	const __m512i alphabetLength = _mm512_set1_epi8 (CaesarCipher::ALPHABET_LENGTH);
+
+	for (std::size_t i = 0; i < length; i += 64) {
+
+		const __mmask64 lanes = (length - i >= 64) ? ~0ULL : ((1ULL << (length - i)) - 1);
+		const __m512i bytes = _mm512_maskz_loadu_epi8 (lanes, input + i);
+		const __m512i index = _mm512_sub_epi8 (_mm512_or_si512 (bytes, caseBit), firstLetter);
+		const __mmask64 isLetter = _mm512_cmplt_epu8_mask (index, alphabetLength);
+		// Uppercase letters lack the case bit, so flipping it and keeping only
+		// it gives the bit that turns a lowercase translation back to upper.
+		// The masked lookup and plain operators also keep GCC 12 from warning
+		// about the undefined pass-through of the unmasked intrinsics.
+		const __m512i letters = _mm512_xor_si512 (_mm512_maskz_permutexvar_epi8 (isLetter, index, lookup), _mm512_and_si512 (_mm512_xor_si512 (bytes, caseBit), caseBit));
+
+		_mm512_mask_storeu_epi8 (output + i, lanes, _mm512_mask_mov_epi8 (bytes, isLetter, letters));
+
+	}
+
+}
+#endif
+
+// Method Definitions ********************************************************
+bool SubstitutionCipher::isTranslationKernelSupported (const TranslationKernel kernel) {
+
+	switch (kernel) {
+
+	case SCALAR_TRANSLATION:
+		return true;
+
+#ifdef SUBSTITUTION_CIPHER_SHUFFLE_KERNELS
+	case SSSE3_TRANSLATION:
+		return __builtin_cpu_supports ("ssse3");
+
+	case AVX512_TRANSLATION:
+		return __builtin_cpu_supports ("avx512vbmi") && __builtin_cpu_supports ("avx512bw");
+#endif
+
+	default:
+		return false;
+
+	}
+
+}
+
+//****************************************************************************
+SubstitutionCipher::TranslationKernel SubstitutionCipher::getWidestTranslationKernel (void) {
+
+	if (isTranslationKernelSupported (AVX512_TRANSLATION)) {
+
+		return AVX512_TRANSLATION;
+
+	}
+
+	if (isTranslationKernelSupported (SSSE3_TRANSLATION)) {
+
+		return SSSE3_TRANSLATION;
+
+	}
+
+	return SCALAR_TRANSLATION;
+
+}
+
+//****************************************************************************
+SubstitutionCipher::TranslationKernel SubstitutionCipher::getTranslationKernel (void) {
+
+	int kernel = selectedTranslationKernel;
+
+	// Racing first calls all store the same kernel, so no lock is needed.
+	if (kernel < 0) {
+
+		kernel = getWidestTranslationKernel ();
+		selectedTranslationKernel = kernel;
+
+	}
+
+	return static_cast<TranslationKernel> (kernel);
+
+}
+
+//****************************************************************************
+bool SubstitutionCipher::setTranslationKernel (const TranslationKernel kernel) {
+
+	if (!isTranslationKernelSupported (kernel)) {
+
+		return false;
+
+	}
+
+	selectedTranslationKernel = kernel;
+	return true;
+
+}
+
+//****************************************************************************
+bool SubstitutionCipher::isValidAlphabet (const std::string& alphabet) {
+
+	bool isUsed[CaesarCipher::ALPHABET_LENGTH] = { false };
+	unsigned int index = 0;
+
+	if (alphabet.length () != CaesarCipher::ALPHABET_LENGTH) {
+
+		return false;
+
+	}
+
+	for (const char character : alphabet) {
+
+		index = CaesarCipher::getLetterIndex (character);
+
+		if (index >= CaesarCipher::ALPHABET_LENGTH || isUsed[index]) {
+
+			return false;
+
+		}
+
+		isUsed[index] = true;
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+std::string SubstitutionCipher::getCaesarAlphabet (const unsigned int key) {
+
+	std::string alphabet (CaesarCipher::ALPHABET_LENGTH, 'A');
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		alphabet[i] = static_cast<char> ('A' + (i + key) % CaesarCipher::ALPHABET_LENGTH);
+
+	}
+
+	return alphabet;
+
+}
+
+//****************************************************************************
+std::string SubstitutionCipher::invertAlphabet (const std::string& alphabet) {
+
+	std::string inverse (CaesarCipher::ALPHABET_LENGTH, 'A');
+
+	if (!isValidAlphabet (alphabet)) {
+
+		throw std::logic_error ("Substitution alphabet must hold each letter exactly once.");
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		inverse[CaesarCipher::getLetterIndex (alphabet[i])] = static_cast<char> ('A' + i);
+
+	}
+
+	return inverse;
+
+}
+
+//****************************************************************************
+std::string SubstitutionCipher::encipher (const std::string& plaintext, const std::string& alphabet) {
+
+	std::string ciphertext (plaintext.length (), '\0');
+
+	if (!isValidAlphabet (alphabet)) {
+
+		throw std::logic_error ("Substitution alphabet must hold each letter exactly once.");
+
+	}
+
+	encipher (plaintext.data (), plaintext.length (), alphabet.data (), &ciphertext[0]);
+
+	return ciphertext;
+
+}
+
+//****************************************************************************
+void SubstitutionCipher::encipher (const char* const plaintext, const std::size_t length, const char alphabet[CaesarCipher::ALPHABET_LENGTH], char* const ciphertext) {
+
+	// Padded so that the widest kernel can load the table in one go.
+	unsigned char table[64] = { 0 };
+	const unsigned char* const input = reinterpret_cast<const unsigned char*> (plaintext);
+	unsigned char* const output = reinterpret_cast<unsigned char*> (ciphertext);
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		table[i] = static_cast<unsigned char> (alphabet[i] | 0x20);
+
+	}
+
+	switch (getTranslationKernel ()) {
+
+#ifdef SUBSTITUTION_CIPHER_SHUFFLE_KERNELS
+	case AVX512_TRANSLATION:
+		translateAvx512 (input, length, table, output);
+		break;
+
+	case SSSE3_TRANSLATION:
+		translateSsse3 (input, length, table, output);
+		break;
+#endif
+
+	default:
+		translateScalar (input, length, table, output);
+		break;
+
+	}
+
+}
+
+//****************************************************************************
+std::string SubstitutionCipher::decipher (const std::string& ciphertext, const std::string& alphabet) {
+
+	return encipher (ciphertext, invertAlphabet (alphabet));
+
+}
+
+//****************************************************************************
+unsigned int SubstitutionCipher::countBigrams (const char* const text, const std::size_t length, unsigned int bigramCounts[BIGRAM_COUNT]) {
+
+	unsigned int totalBigrams = 0;
+	unsigned int previousIndex = CaesarCipher::ALPHABET_LENGTH;
+	unsigned int index = 0;
+
+	memset (bigramCounts, 0, sizeof (unsigned int) * BIGRAM_COUNT);
+
+	for (std::size_t i = 0; i < length; i++) {
+
+		index = CaesarCipher::getLetterIndex (text[i]);
+
+		// Anything but a letter ends the word.
+		if (index < CaesarCipher::ALPHABET_LENGTH && previousIndex < CaesarCipher::ALPHABET_LENGTH) {
+
+			bigramCounts[previousIndex * CaesarCipher::ALPHABET_LENGTH + index]++;
+			totalBigrams++;
+
+		}
+
+		previousIndex = index;
+
+	}
+
+	return totalBigrams;
+
+}
+
+//****************************************************************************
+SubstitutionCipher::Estimate SubstitutionCipher::crackKey (const std::string& ciphertext, const unsigned int restarts, WorkStealingPool& pool) {
+
+	// English letters from most to least frequent.
+	const char* const FREQUENCY_ORDER = "ETAOINSHRDLCUMWFGYPBVKJXQZ";
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const unsigned int climbs = (restarts != 0) ? restarts : 1;
+	unsigned int bigramCounts[BIGRAM_COUNT];
+	unsigned int letterCounts[ALPHABET_LENGTH];
+	unsigned int frequencyOrder[ALPHABET_LENGTH];
+	std::vector<double> fitnesses (climbs);
+	std::vector<std::string> keys (climbs, std::string (ALPHABET_LENGTH, '\0'));
+	unsigned int totalBigrams = 0;
+	unsigned int best = 0;
+	Estimate estimate;
+
+	totalBigrams = countBigrams (ciphertext.data (), ciphertext.length (), bigramCounts);
+	CaesarCipher::countLetters (ciphertext, letterCounts);
+	getLogBigramFrequencies ();
+
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		frequencyOrder[i] = i;
+
+	}
+
+	std::stable_sort (frequencyOrder, frequencyOrder + ALPHABET_LENGTH, [&letterCounts] (const unsigned int left, const unsigned int right) {
+
+		return letterCounts[left] > letterCounts[right];
+
+	});
+
+	for (unsigned int restart = 0; restart < climbs; restart++) {
+
+		pool.submit ([&, restart] (void) {
+
+			unsigned char plaintextLetters[ALPHABET_LENGTH];
+
+			// The first climb starts by matching letter frequencies, the rest
+			// from shuffles seeded by their number so that cracks repeat.
+			for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+				plaintextLetters[frequencyOrder[i]] = static_cast<unsigned char> (FREQUENCY_ORDER[i] - 'A');
+
+			}
+
+			if (restart != 0) {
+
+				std::mt19937 generator (restart);
+
+				std::shuffle (plaintextLetters, plaintextLetters + ALPHABET_LENGTH, generator);
+
+			}
+
+			fitnesses[restart] = climb (bigramCounts, plaintextLetters);
+
+			for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+				keys[restart][plaintextLetters[i]] = static_cast<char> ('A' + i);
+
+			}
+
+		});
+
+	}
+
+	pool.wait ();
+
+	for (unsigned int restart = 1; restart < climbs; restart++) {
+
+		if (fitnesses[restart] > fitnesses[best]) {
+
+			best = restart;
+
+		}
+
+	}
+
+	estimate.alphabet = keys[best];
+	estimate.score = (totalBigrams != 0) ? fitnesses[best] / totalBigrams : 0.0;
+
+	return estimate;
+
+}
+
+//****************************************************************************
+const double* SubstitutionCipher::getLogBigramFrequencies (void) {
+
+	// Initialized once, safely, by whichever thread gets here first.
+	static const std::vector<double> logFrequencies = [] (void) {
+
+		std::vector<double> frequencies (BIGRAM_COUNT);
+
+		for (unsigned int i = 0; i < BIGRAM_COUNT; i++) {
+
+			frequencies[i] = std::log10 (std::max (BIGRAM_FREQUENCIES[i], MINIMUM_FREQUENCY) / 1000000.0);
+
+		}
+
+		return frequencies;
+
+	} ();
+
+	return logFrequencies.data ();
+
+}
+
+//****************************************************************************
+double SubstitutionCipher::climb (const unsigned int bigramCounts[BIGRAM_COUNT], unsigned char plaintextLetters[CaesarCipher::ALPHABET_LENGTH]) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const double* const logFrequencies = getLogBigramFrequencies ();
+	double fitness = 0.0;
+	double before = 0.0;
+	double after = 0.0;
+	bool isImproving = true;
+
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		for (unsigned int j = 0; j < ALPHABET_LENGTH; j++) {
+
+			fitness += bigramCounts[i * ALPHABET_LENGTH + j] * logFrequencies[plaintextLetters[i] * ALPHABET_LENGTH + plaintextLetters[j]];
+
+		}
+
+	}
+
+	while (isImproving) {
+
+		isImproving = false;
+
+		for (unsigned int first = 0; first < ALPHABET_LENGTH - 1; first++) {
+
+			for (unsigned int second = first + 1; second < ALPHABET_LENGTH; second++) {
+
+				before = computePartialFitness (bigramCounts, plaintextLetters, first, second);
+				std::swap (plaintextLetters[first], plaintextLetters[second]);
+				after = computePartialFitness (bigramCounts, plaintextLetters, first, second);
+
+				// A tiny margin keeps rounding from swapping back and forth forever.
+				if (after > before + 0.000001) {
+
+					fitness += after - before;
+					isImproving = true;
+
+				} else {
+
+					std::swap (plaintextLetters[first], plaintextLetters[second]);
+
+				}
+
+			}
+
+		}
+
+	}
+
+	return fitness;
+
+}
+
+//****************************************************************************
+double SubstitutionCipher::computePartialFitness (const unsigned int bigramCounts[BIGRAM_COUNT], const unsigned char plaintextLetters[CaesarCipher::ALPHABET_LENGTH], const unsigned int first, const unsigned int second) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const double* const logFrequencies = getLogBigramFrequencies ();
+	const unsigned int firstRow = plaintextLetters[first] * ALPHABET_LENGTH;
+	const unsigned int secondRow = plaintextLetters[second] * ALPHABET_LENGTH;
+	double sum = 0.0;
+
+	// Rows of both letters in full, then their columns less the four cells
+	// the rows already covered.
+	for (unsigned int i = 0; i < ALPHABET_LENGTH; i++) {
+
+		sum += bigramCounts[first * ALPHABET_LENGTH + i] * logFrequencies[firstRow + plaintextLetters[i]];
+		sum += bigramCounts[second * ALPHABET_LENGTH + i] * logFrequencies[secondRow + plaintextLetters[i]];
+
+		if (i != first && i != second) {
+
+			sum += bigramCounts[i * ALPHABET_LENGTH + first] * logFrequencies[plaintextLetters[i] * ALPHABET_LENGTH + plaintextLetters[first]];
+			sum += bigramCounts[i * ALPHABET_LENGTH + second] * logFrequencies[plaintextLetters[i] * ALPHABET_LENGTH + plaintextLetters[second]];
+
+		}
+
+	}
+
+	return sum;
+
+}
+
+//****************************************************************************
+SubstitutionCipher::SubstitutionCipher (void) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+SubstitutionCipher::SubstitutionCipher (const SubstitutionCipher& substitutionCipher) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+SubstitutionCipher& SubstitutionCipher::operator= (const SubstitutionCipher& substitutionCipher) {
+
+	// Dummy
+	return *this;
+
+}
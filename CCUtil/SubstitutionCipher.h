@@ -0,0 +1,219 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Substitution cipher from:		https://en.wikipedia.org/wiki/Substitution_cipher
+ * Hill climbing crack from:		http://practicalcryptography.com/cryptanalysis/stochastic-searching/cryptanalysis-simple-substitution-cipher/
+ * Incremental bigram fitness from:	Jakobsen, T. "A Fast Method for the Cryptanalysis of Substitution Ciphers", Cryptologia 19(3), 1995.
+ * Shuffle lookups from:			https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "CaesarCipher.h"
+#include "WorkStealingPool.h"
+
+#ifndef SUBSTITUTION_CIPHER_H
+#define SUBSTITUTION_CIPHER_H
+
+/**
+ * Static class for enciphering, deciphering and cracking monoalphabetic
+ * substitution ciphers. A key is an alphabet of the 26 letters in any order;
+ * plaintext A becomes the alphabet's first letter, B its second and so on. A
+ * Caesar cipher is the special case of a rotated alphabet.
+ */
+class SubstitutionCipher {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Implementations of the letter translation at the heart of enciphering.
+	 */
+	enum TranslationKernel {
+
+		SCALAR_TRANSLATION,		/**< One byte at a time, on any processor. */
+		SSSE3_TRANSLATION,		/**< 16 bytes at a time with pshufb. */
+		AVX512_TRANSLATION		/**< 64 bytes at a time with vpermb. */
+
+	};
+
+	/**
+	 * Result of cracking a ciphertext.
+	 */
+	struct Estimate {
+
+		std::string	alphabet;	/**< Best fitting key. */
+		double		score;		/**< Mean log10 probability of the plaintext's bigrams. Higher is better. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int BIGRAM_COUNT = CaesarCipher::ALPHABET_LENGTH * CaesarCipher::ALPHABET_LENGTH;	/**< Number of distinct bigrams. */
+	static const unsigned int DEFAULT_RESTARTS = 64;	/**< Number of hill climbs a crack starts from. */
+
+	// Public Accessors ******************************************************
+	/**
+	 * Checks whether this build and processor can run a translation kernel.
+	 * @param kernel to check.
+	 * @return true if it can, otherwise false.
+	 */
+	static bool isTranslationKernelSupported (const TranslationKernel kernel);
+
+	/**
+	 * Returns the widest translation kernel this build and processor can run,
+	 * which is used until another is set.
+	 * @return the widest supported kernel.
+	 */
+	static TranslationKernel getWidestTranslationKernel (void);
+
+	/**
+	 * Returns the translation kernel enciphering uses.
+	 * @return the kernel in use.
+	 */
+	static TranslationKernel getTranslationKernel (void);
+
+	/**
+	 * Sets the translation kernel enciphering uses from now on, on every thread.
+	 * @param kernel to use.
+	 * @return true if set, otherwise false if the kernel is not supported.
+	 */
+	static bool setTranslationKernel (const TranslationKernel kernel);
+
+	// Public Methods ********************************************************
+	/**
+	 * Checks whether a string is a key: each of the 26 letters exactly once,
+	 * in either case.
+	 * @param alphabet to check.
+	 * @return true if it is a key, otherwise false.
+	 */
+	static bool isValidAlphabet (const std::string& alphabet);
+
+	/**
+	 * Returns the key equivalent to a Caesar cipher key.
+	 * @param key of the Caesar cipher.
+	 * @return the rotated alphabet, in uppercase.
+	 */
+	static std::string getCaesarAlphabet (const unsigned int key);
+
+	/**
+	 * Returns the key that undoes a key.
+	 * @param alphabet to invert.
+	 * @return the inverse alphabet, in uppercase.
+	 * @throw logic_error if alphabet is not a key.
+	 */
+	static std::string invertAlphabet (const std::string& alphabet);
+
+	/**
+	 * Enciphers a string. Letters keep their case and anything else is left as is.
+	 * @param plaintext to encipher.
+	 * @param alphabet to encipher with.
+	 * @return ciphertext.
+	 * @throw logic_error if alphabet is not a key.
+	 */
+	static std::string encipher (const std::string& plaintext, const std::string& alphabet);
+
+	/**
+	 * Enciphers a buffer with the selected translation kernel, by default the
+	 * widest shuffle instructions the processor has.
+	 * @param plaintext to encipher.
+	 * @param length, number of characters in plaintext.
+	 * @param alphabet to encipher with. Must be a key; it is not checked.
+	 * @param ciphertext, where to store length enciphered characters. May be
+	 * plaintext itself.
+	 */
+	static void encipher (const char* const plaintext, const std::size_t length, const char alphabet[CaesarCipher::ALPHABET_LENGTH], char* const ciphertext);
+
+	/**
+	 * Deciphers a string.
+	 * @param ciphertext to decipher.
+	 * @param alphabet the ciphertext was enciphered with.
+	 * @return plaintext.
+	 * @throw logic_error if alphabet is not a key.
+	 */
+	static std::string decipher (const std::string& ciphertext, const std::string& alphabet);
+
+	/**
+	 * Counts how often each letter follows each other letter within a word.
+	 * @param text to count.
+	 * @param length, number of characters in text.
+	 * @param bigramCounts, where to store the counts, indexed by first letter
+	 * times ALPHABET_LENGTH plus second letter.
+	 * @return total number of bigrams counted.
+	 */
+	static unsigned int countBigrams (const char* const text, const std::size_t length, unsigned int bigramCounts[BIGRAM_COUNT]);
+
+	/**
+	 * Guesses the key of a ciphertext by hill climbing: starting from some key,
+	 * any swap of two letters that makes the plaintext's bigrams more English
+	 * is kept until none does. The climbs start from different keys in
+	 * parallel and the best one wins. Each swap is scored from the
+	 * ciphertext's bigram counts in time proportional to the alphabet, not the
+	 * text, so long ciphertexts cost no more to climb than short ones.
+	 * @param ciphertext to crack.
+	 * @param restarts, number of climbs. At least one is made.
+	 * @param pool to run the climbs on.
+	 * @return the best fitting key and its score. Letters absent from the
+	 * ciphertext are placed arbitrarily.
+	 */
+	static Estimate crackKey (const std::string& ciphertext, const unsigned int restarts, WorkStealingPool& pool);
+
+private:
+	// Private Static Constants **********************************************
+	static const double BIGRAM_FREQUENCIES[BIGRAM_COUNT];	/**< Frequency of each bigram within English words, in parts per million. */
+	static const double MINIMUM_FREQUENCY;					/**< Unseen bigrams are scored as if this frequent. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Returns the log10 frequency of each English bigram, computed on first use.
+	 * @return the log10 frequencies, indexed as BIGRAM_FREQUENCIES.
+	 */
+	static const double* getLogBigramFrequencies (void);
+
+	/**
+	 * Climbs from one key until no swap of two letters improves it.
+	 * @param bigramCounts of the ciphertext.
+	 * @param plaintextLetters, the plaintext letter of each ciphertext letter,
+	 * which is climbed in place.
+	 * @return the fitness reached.
+	 */
+	static double climb (const unsigned int bigramCounts[BIGRAM_COUNT], unsigned char plaintextLetters[CaesarCipher::ALPHABET_LENGTH]);
+
+	/**
+	 * Sums the log10 frequencies of the bigrams that involve either of two
+	 * ciphertext letters, weighted by how often they occur. Swapping those
+	 * letters changes the fitness by exactly the change in this sum.
+	 * @param bigramCounts of the ciphertext.
+	 * @param plaintextLetters, the plaintext letter of each ciphertext letter.
+	 * @param first ciphertext letter.
+	 * @param second ciphertext letter.
+	 * @return the partial fitness.
+	 */
+	static double computePartialFitness (const unsigned int bigramCounts[BIGRAM_COUNT], const unsigned char plaintextLetters[CaesarCipher::ALPHABET_LENGTH], const unsigned int first, const unsigned int second);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	SubstitutionCipher (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param substitutionCipher to copy from.
+	 */
+	SubstitutionCipher (const SubstitutionCipher& substitutionCipher);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param substitutionCipher to copy from.
+	 * @return this SubstitutionCipher.
+	 */
+	SubstitutionCipher& operator= (const SubstitutionCipher& substitutionCipher);
+
+};
+
+#endif
@@ -0,0 +1,524 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Various function lookups from:	http://www.cplusplus.com/reference/atomic/atomic/
+ *									http://www.cplusplus.com/reference/fstream/ofstream/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "CrackCache.h"
+#include "FileSystem.h"
+#include "TreeProcessor.h"
+#include "WorkStealingPool.h"
+
+// Method Definitions ********************************************************
+TreeProcessor::TreeProcessor (const Operation operation, const unsigned int key, const std::string& inputDirectory, const std::string& outputDirectory, const std::string& manifestFilename, const std::string& checkpointFilename) :
+	operation (operation),
+	key (key),
+	inputDirectory (inputDirectory),
+	outputDirectory (outputDirectory),
+	manifestFilename (manifestFilename),
+	checkpointFilename (checkpointFilename),
+	chunkSize (DEFAULT_CHUNK_SIZE),
+	crackCache (nullptr),
+	filesProcessed (0) {
+
+}
+
+//****************************************************************************
+void TreeProcessor::setChunkSize (const unsigned long long chunkSize) {
+
+	if (chunkSize != 0) {
+
+		this->chunkSize = chunkSize;
+
+	}
+
+}
+
+//****************************************************************************
+void TreeProcessor::setCrackCache (CrackCache* const crackCache) {
+
+	this->crackCache = crackCache;
+
+}
+
+//****************************************************************************
+unsigned int TreeProcessor::getFilesProcessed (void) const {
+
+	return filesProcessed;
+
+}
+
+//****************************************************************************
+unsigned int TreeProcessor::getFilesResumed (void) const {
+
+	return static_cast<unsigned int> (resumedFiles.size ());
+
+}
+
+//****************************************************************************
+const std::vector<std::string>& TreeProcessor::getFailedFiles (void) const {
+
+	return failedFiles;
+
+}
+
+//****************************************************************************
+bool TreeProcessor::run (WorkStealingPool& pool) {
+
+	std::vector<std::string> relativePaths;
+	std::vector<std::unique_ptr<FileJob> > jobs;
+	std::string outputPrefix;
+
+	results.clear ();
+	failedFiles.clear ();
+	resumedFiles.clear ();
+	filesProcessed = 0;
+
+	if (!FileSystem::listFiles (inputDirectory, relativePaths)) {
+
+		return false;
+
+	}
+
+	if (!openCheckpoint ()) {
+
+		return false;
+
+	}
+
+	if (!outputDirectory.empty ()) {
+
+		outputPrefix = FileSystem::joinPath (outputDirectory, "");
+
+	}
+
+	for (const std::string& relativePath : relativePaths) {
+
+		std::unique_ptr<FileJob> job (new FileJob ());
+
+		if (resumedFiles.count (relativePath) != 0) {
+
+			continue;
+
+		}
+
+		job->relativePath = relativePath;
+		job->inputPath = FileSystem::joinPath (inputDirectory, relativePath);
+
+		// Never feed our own output, manifest or checkpoint back in, which
+		// happens when they are written inside the input tree.
+		if ((!outputPrefix.empty () && job->inputPath.compare (0, outputPrefix.length (), outputPrefix) == 0) ||
+			job->inputPath == manifestFilename || job->inputPath == checkpointFilename) {
+
+			continue;
+
+		}
+
+		if (!outputDirectory.empty ()) {
+
+			job->outputPath = FileSystem::joinPath (outputDirectory, relativePath);
+
+		}
+
+		job->key = key;
+		job->chunksRemaining = 0;
+		job->failed = !FileSystem::getFileSize (job->inputPath, job->size);
+		job->chunkCount = static_cast<unsigned int> (std::max (1ULL, (job->size + chunkSize - 1) / chunkSize));
+
+		jobs.push_back (std::move (job));
+
+	}
+
+	for (std::unique_ptr<FileJob>& job : jobs) {
+
+		scheduleFile (pool, *job);
+
+	}
+
+	pool.wait ();
+
+	checkpointStream.close ();
+	std::sort (failedFiles.begin (), failedFiles.end ());
+
+	if (!manifestFilename.empty ()) {
+
+		return writeManifest ();
+
+	}
+
+	return true;
+
+}
+
+//****************************************************************************
+bool TreeProcessor::openCheckpoint (void) {
+
+	std::string contents;
+	std::string line;
+	std::string::size_type lineStart = 0;
+	std::string::size_type lineEnd = 0;
+	std::string::size_type tabIndex = 0;
+	unsigned long long size = 0;
+	std::ostringstream rewrittenContents;
+
+	if (checkpointFilename.empty ()) {
+
+		return true;
+
+	}
+
+	rewrittenContents << getCheckpointHeader () << '\n';
+
+	if (FileSystem::getFileSize (checkpointFilename, size)) {
+
+		if (!FileSystem::readFileRange (checkpointFilename, 0, size, contents)) {
+
+			return false;
+
+		}
+
+		lineEnd = contents.find ('\n');
+
+		// Refuse to resume a checkpoint that was written for another operation or key.
+		if (lineEnd == std::string::npos || contents.substr (0, lineEnd) != getCheckpointHeader ()) {
+
+			return false;
+
+		}
+
+		// Only lines ending in a newline were completely written; a partial
+		// final line from an interrupted run is dropped.
+		lineStart = lineEnd + 1;
+
+		while ((lineEnd = contents.find ('\n', lineStart)) != std::string::npos) {
+
+			line = contents.substr (lineStart, lineEnd - lineStart);
+			tabIndex = line.find ('\t');
+			lineStart = lineEnd + 1;
+
+			if (tabIndex == std::string::npos || resumedFiles.count (line.substr (tabIndex + 1)) != 0) {
+
+				continue;
+
+			}
+
+			try {
+
+				results.push_back (std::make_pair (line.substr (tabIndex + 1), static_cast<unsigned int> (std::stoul (line.substr (0, tabIndex)))));
+				resumedFiles.insert (results.back ().first);
+				rewrittenContents << line << '\n';
+
+			} catch (...) {
+
+				// Skip malformed lines.
+
+			}
+
+		}
+
+	}
+
+	// Rewrite the journal without any partial line so that appends start on
+	// a fresh line.
+	checkpointStream.open (checkpointFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+	checkpointStream << rewrittenContents.str () << std::flush;
+
+	return checkpointStream.good ();
+
+}
+
+//****************************************************************************
+void TreeProcessor::scheduleFile (WorkStealingPool& pool, FileJob& job) {
+
+	if (job.failed) {
+
+		finishFile (job);
+
+	} else if (job.chunkCount == 1) {
+
+		pool.submit ([this, &job] { processWholeFile (job); });
+
+	} else {
+
+		pool.submit ([this, &pool, &job] { prepareChunkedFile (pool, job); });
+
+	}
+
+}
+
+//****************************************************************************
+void TreeProcessor::processWholeFile (FileJob& job) {
+
+	unsigned int letterCounts[CaesarCipher::ALPHABET_LENGTH];
+	CrackCache::Entry entry;
+	std::string contents;
+
+	try {
+
+		if (!FileSystem::readFileRange (job.inputPath, 0, job.size, contents)) {
+
+			job.failed = true;
+
+		} else {
+
+			if (operation == CRACK && crackCache != nullptr) {
+
+				crackCache->crack (contents, entry);
+				job.key = entry.rankedKeys[0];
+
+			} else if (operation == CRACK) {
+
+				CaesarCipher::countLetters (contents, letterCounts);
+				job.key = CaesarCipher::crackKey (letterCounts);
+
+			}
+
+			if (!job.outputPath.empty ()) {
+
+				job.failed = !FileSystem::makeDirectories (FileSystem::getParentDirectory (job.outputPath)) ||
+							 !FileSystem::writeFile (job.outputPath, translate (job, contents));
+
+			}
+
+		}
+
+	} catch (...) {
+
+		job.failed = true;
+
+	}
+
+	finishFile (job);
+
+}
+
+//****************************************************************************
+void TreeProcessor::prepareChunkedFile (WorkStealingPool& pool, FileJob& job) {
+
+	if (operation != CRACK) {
+
+		scheduleTranslation (pool, job);
+		return;
+
+	}
+
+	job.letterCounts.assign (job.chunkCount * CaesarCipher::ALPHABET_LENGTH, 0);
+	job.chunksRemaining = job.chunkCount;
+
+	for (unsigned int i = 0; i < job.chunkCount; i++) {
+
+		pool.submit ([this, &pool, &job, i] { countChunk (pool, job, i); });
+
+	}
+
+}
+
+//****************************************************************************
+void TreeProcessor::translateChunk (FileJob& job, const unsigned int chunkIndex) {
+
+	const unsigned long long offset = chunkIndex * chunkSize;
+	std::string contents;
+
+	try {
+
+		if (!job.failed) {
+
+			if (!FileSystem::readFileRange (job.inputPath, offset, std::min (chunkSize, job.size - offset), contents) ||
+				!FileSystem::writeFileRange (job.outputPath, offset, translate (job, contents))) {
+
+				job.failed = true;
+
+			}
+
+		}
+
+	} catch (...) {
+
+		job.failed = true;
+
+	}
+
+	if (--job.chunksRemaining == 0) {
+
+		finishFile (job);
+
+	}
+
+}
+
+//****************************************************************************
+void TreeProcessor::countChunk (WorkStealingPool& pool, FileJob& job, const unsigned int chunkIndex) {
+
+	const unsigned long long offset = chunkIndex * chunkSize;
+	unsigned int mergedCounts[CaesarCipher::ALPHABET_LENGTH] = { 0 };
+	std::string contents;
+
+	try {
+
+		if (!job.failed) {
+
+			if (FileSystem::readFileRange (job.inputPath, offset, std::min (chunkSize, job.size - offset), contents)) {
+
+				CaesarCipher::countLetters (contents, &job.letterCounts[chunkIndex * CaesarCipher::ALPHABET_LENGTH]);
+
+			} else {
+
+				job.failed = true;
+
+			}
+
+		}
+
+	} catch (...) {
+
+		job.failed = true;
+
+	}
+
+	if (--job.chunksRemaining != 0) {
+
+		return;
+
+	}
+
+	// This was the last chunk to be counted, so the histogram is complete.
+	if (job.failed) {
+
+		finishFile (job);
+		return;
+
+	}
+
+	for (unsigned int i = 0; i < job.letterCounts.size (); i++) {
+
+		mergedCounts[i % CaesarCipher::ALPHABET_LENGTH] += job.letterCounts[i];
+
+	}
+
+	try {
+
+		job.key = CaesarCipher::crackKey (mergedCounts);
+
+	} catch (...) {
+
+		job.failed = true;
+		finishFile (job);
+		return;
+
+	}
+
+	scheduleTranslation (pool, job);
+
+}
+
+//****************************************************************************
+void TreeProcessor::scheduleTranslation (WorkStealingPool& pool, FileJob& job) {
+
+	// Cracking into a manifest alone has nothing left to write.
+	if (job.outputPath.empty ()) {
+
+		finishFile (job);
+		return;
+
+	}
+
+	if (!FileSystem::makeDirectories (FileSystem::getParentDirectory (job.outputPath)) ||
+		!FileSystem::createFile (job.outputPath, job.size)) {
+
+		job.failed = true;
+		finishFile (job);
+		return;
+
+	}
+
+	job.chunksRemaining = job.chunkCount;
+
+	for (unsigned int i = 0; i < job.chunkCount; i++) {
+
+		pool.submit ([this, &job, i] { translateChunk (job, i); });
+
+	}
+
+}
+
+//****************************************************************************
+void TreeProcessor::finishFile (FileJob& job) {
+
+	std::lock_guard<std::mutex> lock (resultsMutex);
+
+	if (job.failed) {
+
+		failedFiles.push_back (job.relativePath);
+		return;
+
+	}
+
+	results.push_back (std::make_pair (job.relativePath, job.key));
+	filesProcessed++;
+
+	if (checkpointStream.is_open ()) {
+
+		checkpointStream << job.key << '\t' << job.relativePath << '\n' << std::flush;
+
+	}
+
+}
+
+//****************************************************************************
+std::string TreeProcessor::translate (const FileJob& job, const std::string& text) const {
+
+	if (operation == ENCIPHER) {
+
+		return CaesarCipher::encipher (text, job.key);
+
+	}
+
+	return CaesarCipher::decipher (text, job.key);
+
+}
+
+//****************************************************************************
+bool TreeProcessor::writeManifest (void) {
+
+	std::ostringstream contents;
+
+	std::sort (results.begin (), results.end ());
+
+	contents << "Key\tFile\n";
+
+	for (const std::pair<std::string, unsigned int>& result : results) {
+
+		contents << result.second << '\t' << result.first << '\n';
+
+	}
+
+	return FileSystem::writeFile (manifestFilename, contents.str ());
+
+}
+
+//****************************************************************************
+std::string TreeProcessor::getCheckpointHeader (void) const {
+
+	std::ostringstream header;
+
+	header << "CCUtil checkpoint 1\t" << static_cast<int> (operation) << '\t' << (operation == CRACK ? 0 : key);
+
+	return header.str ();
+
+}
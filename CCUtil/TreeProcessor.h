@@ -0,0 +1,222 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Various function lookups from:	http://www.cplusplus.com/reference/atomic/atomic/
+ *									http://www.cplusplus.com/reference/fstream/ofstream/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "CrackCache.h"
+#include "WorkStealingPool.h"
+
+#ifndef TREE_PROCESSOR_H
+#define TREE_PROCESSOR_H
+
+/**
+ * Enciphers, deciphers, or cracks every file beneath a directory. Small files
+ * are processed whole while large files are split into chunks, and both are
+ * scheduled on a WorkStealingPool. Results go to a mirrored output tree
+ * and/or a manifest, and completed files may be journaled to a checkpoint so
+ * that an interrupted run resumes where it stopped.
+ */
+class TreeProcessor {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * Operation applied to each file.
+	 */
+	enum Operation {
+
+		ENCIPHER,	/**< Encipher each file with the given key. */
+		DECIPHER,	/**< Decipher each file with the given key. */
+		CRACK		/**< Estimate the key of each file and decipher with it. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned long long DEFAULT_CHUNK_SIZE = 1 << 20;	/**< Files larger than this many bytes are split into chunks. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Prepares to process a directory tree.
+	 * @param operation to apply to each file.
+	 * @param key to encipher or decipher with. Ignored when cracking.
+	 * @param inputDirectory, root of the tree to process.
+	 * @param outputDirectory, root of the mirrored output tree. May be empty
+	 * when cracking with a manifest.
+	 * @param manifestFilename, file to list each file's key in. May be empty.
+	 * @param checkpointFilename, file to journal completed files in. May be empty.
+	 */
+	TreeProcessor (const Operation operation, const unsigned int key, const std::string& inputDirectory, const std::string& outputDirectory, const std::string& manifestFilename, const std::string& checkpointFilename);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Sets the size above which files are split into chunks.
+	 * @param chunkSize in bytes. Must not be zero.
+	 */
+	void setChunkSize (const unsigned long long chunkSize);
+
+	/**
+	 * Sets the cache that crack results of whole files are looked up in and
+	 * stored to. Chunked files are always counted since their hash would need
+	 * a pass of its own.
+	 * @param crackCache to use, or nullptr for none. Must outlive the run.
+	 */
+	void setCrackCache (CrackCache* const crackCache);
+
+	/**
+	 * Returns the number of files processed by the last run.
+	 * @return the number of files processed by the last run.
+	 */
+	unsigned int getFilesProcessed (void) const;
+
+	/**
+	 * Returns the number of files skipped by the last run because the
+	 * checkpoint recorded them as complete.
+	 * @return the number of files skipped.
+	 */
+	unsigned int getFilesResumed (void) const;
+
+	/**
+	 * Returns the relative paths of the files that failed in the last run.
+	 * @return the files that failed.
+	 */
+	const std::vector<std::string>& getFailedFiles (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Processes every file in the tree on the given pool.
+	 * @param pool to schedule files and chunks on.
+	 * @return true if the tree was walked and the checkpoint and manifest
+	 * could be written, otherwise false. Individual file failures are
+	 * reported through getFailedFiles instead.
+	 */
+	bool run (WorkStealingPool& pool);
+
+private:
+	// Private Types *********************************************************
+	/**
+	 * State shared by the chunks of a single file.
+	 */
+	struct FileJob {
+
+		std::string					relativePath;		/**< Path of the file relative to the input directory. */
+		std::string					inputPath;			/**< Full path of the input file. */
+		std::string					outputPath;			/**< Full path of the output file, empty if not mirrored. */
+		unsigned long long			size;				/**< Size of the input file in bytes. */
+		unsigned int				chunkCount;			/**< Number of chunks the file is split into. */
+		unsigned int				key;				/**< Key to encipher or decipher each chunk with. */
+		std::atomic<unsigned int>	chunksRemaining;	/**< Chunks of the current pass not yet finished. */
+		std::atomic<bool>			failed;				/**< Whether any chunk failed. */
+		std::vector<unsigned int>	letterCounts;		/**< Letter counts of each chunk, chunkCount * alphabet length. */
+
+	};
+
+	// Private Methods *******************************************************
+	/**
+	 * Loads the checkpoint journal, if any, and opens it for appending.
+	 * @return true if the checkpoint is usable, otherwise false.
+	 */
+	bool openCheckpoint (void);
+
+	/**
+	 * Schedules the first pass over a file.
+	 * @param pool to schedule on.
+	 * @param job, the file to process.
+	 */
+	void scheduleFile (WorkStealingPool& pool, FileJob& job);
+
+	/**
+	 * Processes a file small enough to be handled as a single chunk.
+	 * @param job, the file to process.
+	 */
+	void processWholeFile (FileJob& job);
+
+	/**
+	 * Creates the output file of a chunked file and schedules its chunks.
+	 * @param pool to schedule on.
+	 * @param job, the file to process.
+	 */
+	void prepareChunkedFile (WorkStealingPool& pool, FileJob& job);
+
+	/**
+	 * Enciphers or deciphers one chunk of a file into the output file.
+	 * @param job, the file the chunk belongs to.
+	 * @param chunkIndex, index of the chunk.
+	 */
+	void translateChunk (FileJob& job, const unsigned int chunkIndex);
+
+	/**
+	 * Counts the letters of one chunk of a file being cracked. The last chunk
+	 * to finish estimates the key and schedules the deciphering pass.
+	 * @param pool to schedule the deciphering pass on.
+	 * @param job, the file the chunk belongs to.
+	 * @param chunkIndex, index of the chunk.
+	 */
+	void countChunk (WorkStealingPool& pool, FileJob& job, const unsigned int chunkIndex);
+
+	/**
+	 * Schedules a translation of every chunk of a file.
+	 * @param pool to schedule on.
+	 * @param job, the file to translate.
+	 */
+	void scheduleTranslation (WorkStealingPool& pool, FileJob& job);
+
+	/**
+	 * Records that a file has finished, successfully or not.
+	 * @param job, the file that finished.
+	 */
+	void finishFile (FileJob& job);
+
+	/**
+	 * Translates text with the key of the given file according to the operation.
+	 * @param job, the file the text belongs to.
+	 * @param text to translate.
+	 * @return the translated text.
+	 */
+	std::string translate (const FileJob& job, const std::string& text) const;
+
+	/**
+	 * Writes the manifest from every recorded result.
+	 * @return true if written, otherwise false.
+	 */
+	bool writeManifest (void);
+
+	/**
+	 * Builds the header line that identifies the run in a checkpoint.
+	 * @return the header line, without a newline.
+	 */
+	std::string getCheckpointHeader (void) const;
+
+	// Private Members *******************************************************
+	Operation											operation;				/**< Operation applied to each file. */
+	unsigned int										key;					/**< Key to encipher or decipher with. */
+	std::string											inputDirectory;			/**< Root of the tree to process. */
+	std::string											outputDirectory;		/**< Root of the mirrored output tree. */
+	std::string											manifestFilename;		/**< File to list each file's key in. */
+	std::string											checkpointFilename;		/**< File to journal completed files in. */
+	unsigned long long									chunkSize;				/**< Files larger than this are split into chunks. */
+	CrackCache*											crackCache;				/**< Cache of crack results, or nullptr for none. */
+	std::set<std::string>								resumedFiles;			/**< Files the checkpoint recorded as complete. */
+	std::vector<std::pair<std::string, unsigned int> >	results;				/**< Relative path and key of each completed file. */
+	std::vector<std::string>							failedFiles;			/**< Relative path of each failed file. */
+	std::ofstream										checkpointStream;		/**< Open checkpoint journal. */
+	std::mutex											resultsMutex;			/**< Guards results, failedFiles and checkpointStream. */
+	unsigned int										filesProcessed;			/**< Files completed by this run. */
+
+};
+
+#endif
@@ -0,0 +1,294 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Index of coincidence from:		https://en.wikipedia.org/wiki/Index_of_coincidence
+ * Periodic index of coincidence:	http://practicalcryptography.com/cryptanalysis/stochastic-searching/cryptanalysis-vigenere-cipher/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "CaesarCipher.h"
+#include "FileSystem.h"
+#include "Triage.h"
+#include "WorkStealingPool.h"
+
+// Static Constant Definitions ***********************************************
+const double Triage::MAXIMUM_BINARY_FRACTION = 0.05;
+const double Triage::MINIMUM_LETTER_DENSITY = 0.4;
+const double Triage::MINIMUM_LANGUAGE_COINCIDENCE = 0.055;
+const double Triage::MAXIMUM_LANGUAGE_SCORE = 0.5;
+
+// Method Definitions ********************************************************
+Triage::Result Triage::classify (const char* const text, const std::size_t length) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	Result result;
+	unsigned int letterCounts[ALPHABET_LENGTH];
+	unsigned int rankedKeys[ALPHABET_LENGTH];
+	double rankedScores[ALPHABET_LENGTH];
+	std::vector<unsigned char> letters;
+	std::size_t controlBytes = 0;
+	unsigned char character = 0;
+
+	result.classification = UNDETERMINED;
+	result.indexOfCoincidence = 0.0;
+	result.letterDensity = 0.0;
+	result.estimatedKey = 0;
+	result.confidence = 0.0;
+	result.bytesSampled = length;
+
+	memset (letterCounts, 0, sizeof (letterCounts));
+	letters.reserve (length);
+
+	for (std::size_t i = 0; i < length; i++) {
+
+		character = static_cast<unsigned char> (text[i]);
+
+		if (character >= 'a' && character <= 'z') {
+
+			character -= 'a' - 'A';
+
+		}
+
+		if (character >= 'A' && character <= 'Z') {
+
+			letterCounts[character - 'A']++;
+			letters.push_back (static_cast<unsigned char> (character - 'A'));
+
+		} else if ((character < 0x20 && character != '\t' && character != '\n' && character != '\r' && character != '\f' && character != '\v') || character == 0x7F) {
+
+			controlBytes++;
+
+		}
+
+	}
+
+	if (length == 0) {
+
+		return result;
+
+	}
+
+	result.letterDensity = static_cast<double> (letters.size ()) / length;
+	result.indexOfCoincidence = computeIndexOfCoincidence (letterCounts, static_cast<unsigned int> (letters.size ()));
+
+	// Prose is mostly letters and never holds more than the odd control byte.
+	if (static_cast<double> (controlBytes) / length > MAXIMUM_BINARY_FRACTION) {
+
+		result.classification = RANDOM;
+		return result;
+
+	}
+
+	if (letters.size () < MINIMUM_LETTERS) {
+
+		return result;
+
+	}
+
+	if (result.letterDensity < MINIMUM_LETTER_DENSITY) {
+
+		result.classification = RANDOM;
+		return result;
+
+	}
+
+	CaesarCipher::rankKeys (letterCounts, rankedKeys, rankedScores);
+	result.estimatedKey = rankedKeys[0];
+	result.confidence = (rankedScores[0] > 0.0) ? rankedScores[1] / rankedScores[0] : 0.0;
+
+	// Any monoalphabetic cipher only relabels letters, so it keeps the index
+	// of coincidence of its language. Only a shift also keeps the shape that
+	// chi squared looks for.
+	if (result.indexOfCoincidence >= MINIMUM_LANGUAGE_COINCIDENCE) {
+
+		if (rankedScores[0] > MAXIMUM_LANGUAGE_SCORE) {
+
+			result.classification = SUBSTITUTION;
+
+		} else {
+
+			result.classification = (rankedKeys[0] == 0) ? PLAINTEXT : CAESAR;
+
+		}
+
+	} else {
+
+		// Polyalphabetic ciphers flatten the frequencies, but each column of
+		// letters enciphered with the same key keeps those of its language.
+		result.classification = (computePeriodicIndexOfCoincidence (letters) >= MINIMUM_LANGUAGE_COINCIDENCE) ? POLYALPHABETIC : RANDOM;
+
+	}
+
+	return result;
+
+}
+
+//****************************************************************************
+Triage::Result Triage::classifyFile (const std::string& filename, const std::size_t sampleSize) {
+
+	unsigned long long size = 0;
+	std::string sample;
+	Result result;
+
+	if (!FileSystem::getFileSize (filename, size) || !FileSystem::readFileRange (filename, 0, (size < sampleSize) ? size : sampleSize, sample)) {
+
+		result = classify (nullptr, 0);
+		result.classification = UNREADABLE;
+		return result;
+
+	}
+
+	return classify (sample.data (), sample.length ());
+
+}
+
+//****************************************************************************
+void Triage::classifyFiles (const std::string& directory, const std::vector<std::string>& relativePaths, const std::size_t sampleSize, WorkStealingPool& pool, std::vector<Result>& results) {
+
+	results.resize (relativePaths.size ());
+
+	// Each task writes only its own slot, so no locking is needed.
+	for (std::size_t i = 0; i < relativePaths.size (); i++) {
+
+		pool.submit ([&directory, &relativePaths, &results, sampleSize, i] (void) {
+
+			results[i] = classifyFile (FileSystem::joinPath (directory, relativePaths[i]), sampleSize);
+
+		});
+
+	}
+
+	pool.wait ();
+
+}
+
+//****************************************************************************
+const char* Triage::getClassificationName (const Classification classification) {
+
+	switch (classification) {
+
+	case PLAINTEXT:
+		return "plaintext";
+
+	case CAESAR:
+		return "caesar";
+
+	case SUBSTITUTION:
+		return "substitution";
+
+	case POLYALPHABETIC:
+		return "polyalphabetic";
+
+	case RANDOM:
+		return "random";
+
+	case UNREADABLE:
+		return "unreadable";
+
+	default:
+		return "undetermined";
+
+	}
+
+}
+
+//****************************************************************************
+double Triage::computeIndexOfCoincidence (const unsigned int* const letterCounts, const unsigned int numberOfLetters) {
+
+	unsigned long long coincidences = 0;
+
+	if (numberOfLetters < 2) {
+
+		return 0.0;
+
+	}
+
+	for (unsigned int i = 0; i < CaesarCipher::ALPHABET_LENGTH; i++) {
+
+		if (letterCounts[i] > 1) {
+
+			coincidences += static_cast<unsigned long long> (letterCounts[i]) * (letterCounts[i] - 1);
+
+		}
+
+	}
+
+	return static_cast<double> (coincidences) / (static_cast<double> (numberOfLetters) * (numberOfLetters - 1));
+
+}
+
+//****************************************************************************
+double Triage::computePeriodicIndexOfCoincidence (const std::vector<unsigned char>& letters) {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	std::vector<unsigned int> columnCounts;
+	double highestAverage = 0.0;
+	double sum = 0.0;
+
+	for (unsigned int period = 2; period <= MAXIMUM_PERIOD; period++) {
+
+		// Columns need a few letters each for their indexes to mean anything.
+		if (letters.size () / period < MINIMUM_LETTERS / 2) {
+
+			break;
+
+		}
+
+		columnCounts.assign (period * ALPHABET_LENGTH, 0);
+
+		for (std::size_t i = 0; i < letters.size (); i++) {
+
+			columnCounts[(i % period) * ALPHABET_LENGTH + letters[i]]++;
+
+		}
+
+		sum = 0.0;
+
+		for (unsigned int column = 0; column < period; column++) {
+
+			const unsigned int columnLength = static_cast<unsigned int> (letters.size () / period + ((column < letters.size () % period) ? 1 : 0));
+
+			sum += computeIndexOfCoincidence (&columnCounts[column * ALPHABET_LENGTH], columnLength);
+
+		}
+
+		if (sum / period > highestAverage) {
+
+			highestAverage = sum / period;
+
+		}
+
+	}
+
+	return highestAverage;
+
+}
+
+//****************************************************************************
+Triage::Triage (void) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+Triage::Triage (const Triage& triage) {
+
+	// Dummy
+
+}
+
+//****************************************************************************
+Triage& Triage::operator= (const Triage& triage) {
+
+	// Dummy
+	return *this;
+
+}
@@ -0,0 +1,146 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Index of coincidence from:		https://en.wikipedia.org/wiki/Index_of_coincidence
+ * Periodic index of coincidence:	http://practicalcryptography.com/cryptanalysis/stochastic-searching/cryptanalysis-vigenere-cipher/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "WorkStealingPool.h"
+
+#ifndef TRIAGE_H
+#define TRIAGE_H
+
+/**
+ * Static class that cheaply guesses whether a text is enciphered, and how,
+ * from a bounded sample at its start. Meant to be run over large numbers of
+ * files so that the expensive cracks only run where they can pay off.
+ */
+class Triage {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * What a text most likely is.
+	 */
+	enum Classification {
+
+		UNDETERMINED,		/**< Too few letters to tell. */
+		PLAINTEXT,			/**< Readable as is. */
+		CAESAR,				/**< Shifted by a Caesar cipher. */
+		SUBSTITUTION,		/**< Letter frequencies of a language, but no shift fits them. */
+		POLYALPHABETIC,		/**< Flat letter frequencies that become a language's at some period. */
+		RANDOM,				/**< Binary data or letters with no structure. */
+		UNREADABLE			/**< Could not be read. */
+
+	};
+
+	static const unsigned int CLASSIFICATION_COUNT = UNREADABLE + 1;	/**< Number of classifications. */
+
+	/**
+	 * Measurements behind a classification.
+	 */
+	struct Result {
+
+		Classification		classification;			/**< What the text most likely is. */
+		double				indexOfCoincidence;		/**< Chance that two letters picked at random are the same. */
+		double				letterDensity;			/**< Fraction of the sampled bytes that are letters. */
+		unsigned int		estimatedKey;			/**< Best fitting Caesar key. */
+		double				confidence;				/**< Ratio of the runner up key's score to the best key's. */
+		unsigned long long	bytesSampled;			/**< Number of bytes examined. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const std::size_t DEFAULT_SAMPLE_SIZE = 65536;	/**< Bytes examined at the start of each input. */
+
+	// Public Methods ********************************************************
+	/**
+	 * Classifies a text.
+	 * @param text to classify. Callers bound its length to keep triage cheap.
+	 * @param length, number of characters in text.
+	 * @return the classification and the measurements behind it.
+	 */
+	static Result classify (const char* const text, const std::size_t length);
+
+	/**
+	 * Classifies the start of a file without reading the rest of it.
+	 * @param filename of the file.
+	 * @param sampleSize, number of bytes to read at most.
+	 * @return the classification, UNREADABLE if the file could not be read.
+	 */
+	static Result classifyFile (const std::string& filename, const std::size_t sampleSize);
+
+	/**
+	 * Classifies many files at once.
+	 * @param directory the files are relative to.
+	 * @param relativePaths of the files.
+	 * @param sampleSize, number of bytes to read from each file at most.
+	 * @param pool to spread the files over.
+	 * @param results, where to store the result of each file, in order.
+	 */
+	static void classifyFiles (const std::string& directory, const std::vector<std::string>& relativePaths, const std::size_t sampleSize, WorkStealingPool& pool, std::vector<Result>& results);
+
+	/**
+	 * Returns a short name for a classification.
+	 * @param classification to name.
+	 * @return the name.
+	 */
+	static const char* getClassificationName (const Classification classification);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int	MINIMUM_LETTERS = 40;			/**< Fewer letters than this are undetermined. */
+	static const unsigned int	MAXIMUM_PERIOD = 16;			/**< Longest polyalphabetic period tested. */
+	static const double			MAXIMUM_BINARY_FRACTION;		/**< More control bytes than this means binary. */
+	static const double			MINIMUM_LETTER_DENSITY;			/**< Fewer letters than this means not prose. */
+	static const double			MINIMUM_LANGUAGE_COINCIDENCE;	/**< Index of coincidence at or above which text is monoalphabetic. */
+	static const double			MAXIMUM_LANGUAGE_SCORE;			/**< Chi squared sum at or below which a shift fits a language. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Computes the index of coincidence of letter counts.
+	 * @param letterCounts, number of times each letter occurs.
+	 * @param numberOfLetters, sum of letterCounts.
+	 * @return the index of coincidence, zero if there are fewer than two letters.
+	 */
+	static double computeIndexOfCoincidence (const unsigned int* const letterCounts, const unsigned int numberOfLetters);
+
+	/**
+	 * Finds the highest average index of coincidence when the letters are
+	 * split into columns by period, as a polyalphabetic cipher would use them.
+	 * @param letters, index of each letter of the text in order.
+	 * @return the highest average index of coincidence over the tested periods.
+	 */
+	static double computePeriodicIndexOfCoincidence (const std::vector<unsigned char>& letters);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private Ctor to prevent class from being instanced.
+	 */
+	Triage (void);
+
+	/**
+	 * Private copy Ctor to prevent class from being instanced.
+	 * @param triage to copy from.
+	 */
+	Triage (const Triage& triage);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent class from being instanced.
+	 * @param triage to copy from.
+	 * @return this Triage.
+	 */
+	Triage& operator= (const Triage& triage);
+
+};
+
+#endif
@@ -0,0 +1,435 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Perfect hashing overview from:	https://en.wikipedia.org/wiki/Perfect_hash_function
+ * Hash and displace from:			http://cmph.sourceforge.net/papers/esa09.pdf
+ * Finalizer from:					https://github.com/aappleby/smhasher/wiki/MurmurHash3
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "BinaryFormat.h"
+#include "CaesarCipher.h"
+#include "ContentHash.h"
+#include "WordDictionary.h"
+
+// Static Constant Definitions ***********************************************
+const double WordDictionary::READABLE_HIT_RATIO = 0.5;
+const char WordDictionary::MAGIC[4] = { 'C', 'C', 'W', 'D' };
+
+// Helper Functions **********************************************************
+/**
+ * Reads a little endian unsigned integer of a compiled dictionary.
+ * @param data, the first byte of the integer.
+ * @param byteCount, number of bytes the value is stored in.
+ * @return the integer.
+ */
+static inline unsigned int readField (const char* const data, const unsigned int byteCount) {
+
+	unsigned int value = 0;
+
+	for (unsigned int i = 0; i < byteCount; i++) {
+
+		value |= static_cast<unsigned int> (static_cast<unsigned char> (data[i])) << (i * 8);
+
+	}
+
+	return value;
+
+}
+
+// Method Definitions ********************************************************
+WordDictionary::WordDictionary (void) :
+	seeds (nullptr),
+	fingerprints (nullptr),
+	wordCount (0),
+	bucketCount (0),
+	slotCount (0) {
+
+}
+
+//****************************************************************************
+std::size_t WordDictionary::getWordCount (void) const {
+
+	return wordCount;
+
+}
+
+//****************************************************************************
+bool WordDictionary::open (const std::string& filename) {
+
+	contents.clear ();
+
+	if (!mappedFile.open (filename)) {
+
+		return attach (nullptr, 0);
+
+	}
+
+	if (mappedFile.getSize () >= sizeof (MAGIC) && memcmp (mappedFile.getData (), MAGIC, sizeof (MAGIC)) == 0) {
+
+		return attach (mappedFile.getData (), mappedFile.getSize ());
+
+	}
+
+	// A plain word list, compiled once here rather than ahead of time.
+	contents = compile (std::string (mappedFile.getData (), mappedFile.getSize ()));
+	mappedFile.close ();
+
+	return attach (contents.data (), contents.length ());
+
+}
+
+//****************************************************************************
+bool WordDictionary::load (const std::string& contents) {
+
+	mappedFile.close ();
+
+	if (contents.compare (0, sizeof (MAGIC), MAGIC, sizeof (MAGIC)) == 0) {
+
+		this->contents = contents;
+
+	} else {
+
+		this->contents = compile (contents);
+
+	}
+
+	return attach (this->contents.data (), this->contents.length ());
+
+}
+
+//****************************************************************************
+bool WordDictionary::contains (const char* const word, const std::size_t length) const {
+
+	char lowerCaseWord[MAXIMUM_WORD_LENGTH];
+
+	if (length == 0 || length > MAXIMUM_WORD_LENGTH) {
+
+		return false;
+
+	}
+
+	for (std::size_t i = 0; i < length; i++) {
+
+		lowerCaseWord[i] = static_cast<char> (tolower (static_cast<unsigned char> (word[i])));
+
+	}
+
+	return containsLowerCase (lowerCaseWord, length);
+
+}
+
+//****************************************************************************
+double WordDictionary::computeHitRatio (const char* const ciphertext, const std::size_t length, const unsigned int key) const {
+
+	const unsigned int ALPHABET_LENGTH = CaesarCipher::ALPHABET_LENGTH;
+	const unsigned int shift = (ALPHABET_LENGTH - key % ALPHABET_LENGTH) % ALPHABET_LENGTH;
+	char word[MAXIMUM_WORD_LENGTH];
+	std::size_t wordLength = 0;
+	unsigned int wordTotal = 0;
+	unsigned int hitTotal = 0;
+
+	// The position past the end closes the last word.
+	for (std::size_t i = 0; i <= length; i++) {
+
+		const unsigned int index = (i < length) ? CaesarCipher::getLetterIndex (ciphertext[i]) : ALPHABET_LENGTH;
+
+		if (index < ALPHABET_LENGTH) {
+
+			// Letters past the longest word are counted but not kept.
+			if (wordLength < MAXIMUM_WORD_LENGTH) {
+
+				const unsigned int plainIndex = index + shift;
+
+				word[wordLength] = static_cast<char> ('a' + ((plainIndex >= ALPHABET_LENGTH) ? plainIndex - ALPHABET_LENGTH : plainIndex));
+
+			}
+
+			wordLength++;
+
+		} else if (wordLength != 0) {
+
+			if (wordLength > 1) {
+
+				wordTotal++;
+				hitTotal += (wordLength <= MAXIMUM_WORD_LENGTH && containsLowerCase (word, wordLength)) ? 1 : 0;
+
+			}
+
+			wordLength = 0;
+
+		}
+
+	}
+
+	return (wordTotal == 0) ? 0.0 : static_cast<double> (hitTotal) / wordTotal;
+
+}
+
+//****************************************************************************
+void WordDictionary::verifyKeys (const char* const ciphertext, const std::size_t length, Candidate candidates[], const unsigned int candidateCount) const {
+
+	const std::size_t sampleLength = (length < SAMPLE_SIZE) ? length : SAMPLE_SIZE;
+	Candidate candidate;
+	unsigned int position = 0;
+
+	for (unsigned int i = 0; i < candidateCount; i++) {
+
+		candidates[i].hitRatio = computeHitRatio (ciphertext, sampleLength, candidates[i].key);
+
+	}
+
+	// An insertion sort, since it is stable, allocates nothing, and there are
+	// only a handful of candidates.
+	for (unsigned int i = 1; i < candidateCount; i++) {
+
+		candidate = candidates[i];
+
+		for (position = i; position > 0 && candidates[position - 1].hitRatio < candidate.hitRatio; position--) {
+
+			candidates[position] = candidates[position - 1];
+
+		}
+
+		candidates[position] = candidate;
+
+	}
+
+}
+
+//****************************************************************************
+std::string WordDictionary::compile (const std::string& wordList) {
+
+	std::vector<unsigned long long> hashes;
+	std::vector<std::vector<unsigned long long> > buckets;
+	std::vector<std::size_t> bucketOrder;
+	std::vector<unsigned int> bucketSeeds;
+	std::vector<unsigned int> slotFingerprints;
+	std::vector<std::size_t> bucketSlots;
+	std::string buffer;
+	char word[MAXIMUM_WORD_LENGTH];
+	std::size_t wordLength = 0;
+	std::size_t bucketCount = 0;
+	std::size_t slotCount = 0;
+	bool isPlaced = false;
+
+	for (std::size_t i = 0; i <= wordList.length (); i++) {
+
+		const unsigned char character = (i < wordList.length ()) ? static_cast<unsigned char> (wordList[i]) : '\0';
+		const unsigned int index = CaesarCipher::getLetterIndex (character);
+
+		if (index < CaesarCipher::ALPHABET_LENGTH) {
+
+			if (wordLength < MAXIMUM_WORD_LENGTH) {
+
+				word[wordLength] = static_cast<char> ('a' + index);
+
+			}
+
+			wordLength++;
+
+		} else if (wordLength != 0) {
+
+			if (wordLength <= MAXIMUM_WORD_LENGTH) {
+
+				hashes.push_back (ContentHash::hash64 (word, wordLength, 0));
+
+			}
+
+			wordLength = 0;
+
+		}
+
+	}
+
+	std::sort (hashes.begin (), hashes.end ());
+	hashes.erase (std::unique (hashes.begin (), hashes.end ()), hashes.end ());
+
+	// About four words per bucket, and one spare slot for every eight words.
+	bucketCount = hashes.size () / 4 + 1;
+	slotCount = hashes.size () + hashes.size () / 8 + 1;
+	buckets.resize (bucketCount);
+
+	for (const unsigned long long hash : hashes) {
+
+		buckets[(hash >> 32) % bucketCount].push_back (hash);
+
+	}
+
+	for (std::size_t i = 0; i < bucketCount; i++) {
+
+		bucketOrder.push_back (i);
+
+	}
+
+	// The largest buckets are the hardest to place, so they go first while
+	// the slots are still mostly empty.
+	std::stable_sort (bucketOrder.begin (), bucketOrder.end (), [&buckets] (const std::size_t first, const std::size_t second) {
+
+		return buckets[first].size () > buckets[second].size ();
+
+	});
+
+	// Should any bucket run out of seeds, start over with more slots.
+	while (!isPlaced) {
+
+		isPlaced = true;
+		bucketSeeds.assign (bucketCount, 0);
+		slotFingerprints.assign (slotCount, 0);
+
+		for (std::size_t i = 0; i < bucketCount && isPlaced && !buckets[bucketOrder[i]].empty (); i++) {
+
+			const std::vector<unsigned long long>& bucket = buckets[bucketOrder[i]];
+			unsigned int seed = 0;
+			bool isFree = false;
+
+			for (seed = 0; seed <= MAXIMUM_SEED && !isFree; seed++) {
+
+				isFree = true;
+				bucketSlots.clear ();
+
+				for (std::size_t member = 0; member < bucket.size () && isFree; member++) {
+
+					const std::size_t slot = findSlot (bucket[member], seed, slotCount);
+
+					isFree = slotFingerprints[slot] == 0 && std::find (bucketSlots.begin (), bucketSlots.end (), slot) == bucketSlots.end ();
+					bucketSlots.push_back (slot);
+
+				}
+
+			}
+
+			if (isFree) {
+
+				bucketSeeds[bucketOrder[i]] = seed - 1;
+
+				for (std::size_t member = 0; member < bucket.size (); member++) {
+
+					slotFingerprints[bucketSlots[member]] = findFingerprint (bucket[member]);
+
+				}
+
+			} else {
+
+				isPlaced = false;
+				slotCount += slotCount / 8 + 1;
+
+			}
+
+		}
+
+	}
+
+	buffer.reserve (HEADER_LENGTH + bucketCount * 2 + slotCount * 4 + 8);
+	buffer.append (MAGIC, sizeof (MAGIC));
+	BinaryFormat::appendInteger (buffer, FORMAT_VERSION, 2);
+	BinaryFormat::appendInteger (buffer, hashes.size (), 4);
+	BinaryFormat::appendInteger (buffer, bucketCount, 4);
+	BinaryFormat::appendInteger (buffer, slotCount, 4);
+
+	for (const unsigned int seed : bucketSeeds) {
+
+		BinaryFormat::appendInteger (buffer, seed, 2);
+
+	}
+
+	for (const unsigned int fingerprint : slotFingerprints) {
+
+		BinaryFormat::appendInteger (buffer, fingerprint, 4);
+
+	}
+
+	BinaryFormat::appendChecksum (buffer);
+
+	return buffer;
+
+}
+
+//****************************************************************************
+bool WordDictionary::attach (const char* const data, const std::size_t length) {
+
+	std::size_t offset = sizeof (MAGIC);
+	unsigned long long formatVersion = 0;
+	unsigned long long loadedWordCount = 0;
+	unsigned long long loadedBucketCount = 0;
+	unsigned long long loadedSlotCount = 0;
+
+	seeds = nullptr;
+	fingerprints = nullptr;
+	wordCount = 0;
+	bucketCount = 0;
+	slotCount = 0;
+
+	if (data == nullptr || length < HEADER_LENGTH || memcmp (data, MAGIC, sizeof (MAGIC)) != 0 || !BinaryFormat::verifyChecksum (data, length) ||
+		!BinaryFormat::readInteger (data, length, offset, 2, formatVersion) || formatVersion != FORMAT_VERSION ||
+		!BinaryFormat::readInteger (data, length, offset, 4, loadedWordCount) ||
+		!BinaryFormat::readInteger (data, length, offset, 4, loadedBucketCount) ||
+		!BinaryFormat::readInteger (data, length, offset, 4, loadedSlotCount) ||
+		loadedBucketCount == 0 || loadedSlotCount == 0 || length != HEADER_LENGTH + loadedBucketCount * 2 + loadedSlotCount * 4 + 8) {
+
+		return false;
+
+	}
+
+	seeds = data + HEADER_LENGTH;
+	fingerprints = seeds + loadedBucketCount * 2;
+	wordCount = static_cast<std::size_t> (loadedWordCount);
+	bucketCount = static_cast<std::size_t> (loadedBucketCount);
+	slotCount = static_cast<std::size_t> (loadedSlotCount);
+
+	return true;
+
+}
+
+//****************************************************************************
+bool WordDictionary::containsLowerCase (const char* const word, const std::size_t length) const {
+
+	unsigned long long hash = 0;
+	std::size_t slot = 0;
+
+	if (slotCount == 0) {
+
+		return false;
+
+	}
+
+	hash = ContentHash::hash64 (word, length, 0);
+	slot = findSlot (hash, readField (seeds + ((hash >> 32) % bucketCount) * 2, 2), slotCount);
+
+	return readField (fingerprints + slot * 4, 4) == findFingerprint (hash);
+
+}
+
+//****************************************************************************
+std::size_t WordDictionary::findSlot (const unsigned long long hash, const unsigned int seed, const std::size_t slotCount) {
+
+	unsigned long long mixed = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+
+	// MurmurHash3's finalizer, so that each seed scatters the bucket anew.
+	mixed ^= mixed >> 33;
+	mixed *= 0xFF51AFD7ED558CCDULL;
+	mixed ^= mixed >> 33;
+	mixed *= 0xC4CEB9FE1A85EC53ULL;
+	mixed ^= mixed >> 33;
+
+	return static_cast<std::size_t> (mixed % slotCount);
+
+}
+
+//****************************************************************************
+unsigned int WordDictionary::findFingerprint (const unsigned long long hash) {
+
+	const unsigned int fingerprint = static_cast<unsigned int> (hash & 0xFFFFFFFFULL);
+
+	return (fingerprint == 0) ? 1 : fingerprint;
+
+}
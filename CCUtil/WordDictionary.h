@@ -0,0 +1,187 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Perfect hashing overview from:	https://en.wikipedia.org/wiki/Perfect_hash_function
+ * Hash and displace from:			http://cmph.sourceforge.net/papers/esa09.pdf
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <cstddef>
+#include <string>
+#include "MappedFile.h"
+
+#ifndef WORD_DICTIONARY_H
+#define WORD_DICTIONARY_H
+
+/**
+ * Set of words used to check whether a candidate plaintext reads as language.
+ * Words are placed with a hash and displace perfect hash, so a lookup hashes
+ * the word once and compares a single 4 byte fingerprint, never touching the
+ * heap. Compiled dictionaries are memory mapped rather than parsed, so opening
+ * even a dictionary of millions of words costs no more than checking its
+ * checksum.
+ */
+class WordDictionary {
+
+public:
+	// Public Types **********************************************************
+	/**
+	 * A key to verify, and how well its plaintext matched the dictionary.
+	 */
+	struct Candidate {
+
+		unsigned int	key;		/**< Key to decipher with. */
+		double			score;		/**< Score the key was ranked by before verifying, kept for display. */
+		double			hitRatio;	/**< Fraction of the plaintext's words found in the dictionary. */
+
+	};
+
+	// Public Static Constants ***********************************************
+	static const unsigned int MAXIMUM_WORD_LENGTH = 32;		/**< Longer words are left out of dictionaries and count as misses. */
+	static const unsigned int DEFAULT_CANDIDATE_COUNT = 5;	/**< Number of top ranked keys worth verifying. */
+	static const std::size_t SAMPLE_SIZE = 4096;			/**< Characters of a text read when verifying keys. */
+	static const double READABLE_HIT_RATIO;					/**< Hit ratio from which a plaintext is taken to be readable. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Creates an empty dictionary.
+	 */
+	WordDictionary (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the number of words in the dictionary.
+	 * @return the number of distinct words.
+	 */
+	std::size_t getWordCount (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Opens a dictionary file. Compiled dictionaries are mapped into memory;
+	 * any other file is taken to be a plain word list and compiled in memory.
+	 * @param filename of the dictionary or word list.
+	 * @return true if opened, otherwise false.
+	 */
+	bool open (const std::string& filename);
+
+	/**
+	 * Replaces the dictionary with one held in memory.
+	 * @param contents, a compiled dictionary or a plain word list.
+	 * @return true if loaded, otherwise false.
+	 */
+	bool load (const std::string& contents);
+
+	/**
+	 * Checks whether the dictionary holds a word, ignoring case.
+	 * @param word to look up.
+	 * @param length, number of characters in word.
+	 * @return true if found, otherwise false.
+	 */
+	bool contains (const char* const word, const std::size_t length) const;
+
+	/**
+	 * Deciphers a text with a key and measures how much of it is words. Each
+	 * run of letters is a word; words of a single letter are skipped since
+	 * nearly every key turns some of them into "a" or "i".
+	 * @param ciphertext to decipher.
+	 * @param length, number of characters in ciphertext.
+	 * @param key to decipher with. Zero measures the text as it is.
+	 * @return the fraction of words found, or zero if there are none.
+	 */
+	double computeHitRatio (const char* const ciphertext, const std::size_t length, const unsigned int key) const;
+
+	/**
+	 * Measures the hit ratio of each candidate over the first SAMPLE_SIZE
+	 * characters of a text, then sorts the candidates by it, best first.
+	 * Candidates that tie keep their order, so the caller's ranking breaks
+	 * ties. Does not allocate from the heap.
+	 * @param ciphertext to decipher.
+	 * @param length, number of characters in ciphertext.
+	 * @param candidates, keys to verify, ranked by the caller.
+	 * @param candidateCount, number of candidates.
+	 */
+	void verifyKeys (const char* const ciphertext, const std::size_t length, Candidate candidates[], const unsigned int candidateCount) const;
+
+	/**
+	 * Compiles a word list into the binary dictionary format: the bytes
+	 * "CCWD", a 2 byte format version, a 4 byte word count, a 4 byte bucket
+	 * count, a 4 byte slot count, a 2 byte displacement seed for each bucket,
+	 * a 4 byte fingerprint for each slot, and an 8 byte checksum. Every run of
+	 * letters in the list is a word.
+	 * @param wordList to compile.
+	 * @return the compiled dictionary.
+	 */
+	static std::string compile (const std::string& wordList);
+
+private:
+	// Private Static Constants **********************************************
+	static const unsigned int FORMAT_VERSION = 1;			/**< Version of the binary dictionary format. */
+	static const std::size_t HEADER_LENGTH = 18;			/**< Bytes before the seeds. */
+	static const unsigned int MAXIMUM_SEED = 0xFFFF;		/**< Largest seed a bucket can store. */
+	static const char MAGIC[4];								/**< Bytes every compiled dictionary starts with. */
+
+	// Private Methods *******************************************************
+	/**
+	 * Points the dictionary at a compiled dictionary after checking it.
+	 * @param data, the compiled dictionary, which must outlive the view.
+	 * @param length, number of bytes in data.
+	 * @return true if intact, otherwise false.
+	 */
+	bool attach (const char* const data, const std::size_t length);
+
+	/**
+	 * Looks up a word that is already lower case.
+	 * @param word to look up.
+	 * @param length, number of characters in word.
+	 * @return true if found, otherwise false.
+	 */
+	bool containsLowerCase (const char* const word, const std::size_t length) const;
+
+	/**
+	 * Finds the slot a word hashes to under a bucket's seed.
+	 * @param hash of the word.
+	 * @param seed of the word's bucket.
+	 * @param slotCount, number of slots.
+	 * @return the slot.
+	 */
+	static std::size_t findSlot (const unsigned long long hash, const unsigned int seed, const std::size_t slotCount);
+
+	/**
+	 * Finds the fingerprint stored for a word.
+	 * @param hash of the word.
+	 * @return the fingerprint, never zero since zero marks an empty slot.
+	 */
+	static unsigned int findFingerprint (const unsigned long long hash);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the dictionary, which may point into its
+	 * own members, from being copied.
+	 * @param wordDictionary to copy from.
+	 */
+	WordDictionary (const WordDictionary& wordDictionary);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the dictionary from being copied.
+	 * @param wordDictionary to copy from.
+	 * @return this WordDictionary.
+	 */
+	WordDictionary& operator= (const WordDictionary& wordDictionary);
+
+	// Private Members *******************************************************
+	MappedFile		mappedFile;		/**< Mapping of an opened compiled dictionary. */
+	std::string		contents;		/**< Compiled dictionary, when compiled or loaded in memory. */
+	const char*		seeds;			/**< Displacement seed of each bucket, 2 bytes each. */
+	const char*		fingerprints;	/**< Fingerprint held in each slot, 4 bytes each. */
+	std::size_t		wordCount;		/**< Number of distinct words. */
+	std::size_t		bucketCount;	/**< Number of buckets. */
+	std::size_t		slotCount;		/**< Number of slots. */
+
+};
+
+#endif
@@ -0,0 +1,273 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Work stealing overview from:		https://en.wikipedia.org/wiki/Work_stealing
+ * Various function lookups from:	http://www.cplusplus.com/reference/thread/thread/
+ *									http://www.cplusplus.com/reference/condition_variable/condition_variable/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "WorkStealingPool.h"
+
+// Thread Local Variables ****************************************************
+static thread_local const WorkStealingPool*	currentPool = nullptr;	/**< Pool that owns the calling thread, if any. */
+static thread_local unsigned int			currentWorker = 0;		/**< Index of the calling worker within currentPool. */
+
+// Method Definitions ********************************************************
+WorkStealingPool::WorkStealingPool (const unsigned int threadCount) :
+	queuedTasks (0),
+	pendingTasks (0),
+	nextQueue (0),
+	stopping (false) {
+
+	unsigned int workerCount = threadCount;
+
+	if (workerCount == 0) {
+
+		workerCount = std::thread::hardware_concurrency ();
+
+	}
+
+	// hardware_concurrency may return 0 if it cannot tell.
+	if (workerCount == 0) {
+
+		workerCount = 1;
+
+	}
+
+	for (unsigned int i = 0; i < workerCount; i++) {
+
+		queues.push_back (std::unique_ptr<WorkerQueue> (new WorkerQueue ()));
+
+	}
+
+	for (unsigned int i = 0; i < workerCount; i++) {
+
+		workers.push_back (std::thread (&WorkStealingPool::runWorker, this, i));
+
+	}
+
+}
+
+//****************************************************************************
+WorkStealingPool::~WorkStealingPool (void) {
+
+	try {
+
+		wait ();
+
+	} catch (...) {
+
+		// Nobody is left to report the exception to.
+
+	}
+
+	{
+
+		std::lock_guard<std::mutex> lock (stateMutex);
+		stopping = true;
+
+	}
+
+	taskAvailable.notify_all ();
+
+	for (std::thread& worker : workers) {
+
+		worker.join ();
+
+	}
+
+}
+
+//****************************************************************************
+unsigned int WorkStealingPool::getThreadCount (void) const {
+
+	return static_cast<unsigned int> (workers.size ());
+
+}
+
+//****************************************************************************
+void WorkStealingPool::submit (const Task& task) {
+
+	unsigned int queueIndex = 0;
+
+	if (currentPool == this) {
+
+		queueIndex = currentWorker;
+
+	} else {
+
+		queueIndex = nextQueue++ % queues.size ();
+
+	}
+
+	pendingTasks++;
+
+	{
+
+		std::lock_guard<std::mutex> lock (queues[queueIndex]->mutex);
+		queues[queueIndex]->tasks.push_back (task);
+
+	}
+
+	// The count is raised under stateMutex so that a worker deciding to
+	// sleep cannot miss the wake up.
+	{
+
+		std::lock_guard<std::mutex> lock (stateMutex);
+		queuedTasks++;
+
+	}
+
+	taskAvailable.notify_one ();
+
+}
+
+//****************************************************************************
+void WorkStealingPool::wait (void) {
+
+	std::exception_ptr exception;
+
+	// A task that waited on its own pool would count itself, and any other
+	// waiting task, as pending forever. Tasks schedule follow-up tasks instead.
+	if (currentPool == this) {
+
+		throw std::logic_error ("WorkStealingPool::wait called from one of its own tasks.");
+
+	}
+
+	{
+
+		std::unique_lock<std::mutex> lock (stateMutex);
+		tasksFinished.wait (lock, [this] { return pendingTasks == 0; });
+
+		exception = firstException;
+		firstException = nullptr;
+
+	}
+
+	if (exception) {
+
+		std::rethrow_exception (exception);
+
+	}
+
+}
+
+//****************************************************************************
+void WorkStealingPool::runWorker (const unsigned int workerIndex) {
+
+	Task task;
+
+	currentPool = this;
+	currentWorker = workerIndex;
+
+	while (true) {
+
+		if (takeTask (workerIndex, task)) {
+
+			runTask (task);
+			continue;
+
+		}
+
+		std::unique_lock<std::mutex> lock (stateMutex);
+		taskAvailable.wait (lock, [this] { return queuedTasks > 0 || stopping; });
+
+		if (stopping && queuedTasks == 0) {
+
+			return;
+
+		}
+
+	}
+
+}
+
+//****************************************************************************
+bool WorkStealingPool::takeTask (const unsigned int workerIndex, Task& task) {
+
+	const unsigned int queueCount = static_cast<unsigned int> (queues.size ());
+
+	// Newest task from our own queue first, since its data is most likely
+	// still in cache.
+	{
+
+		std::lock_guard<std::mutex> lock (queues[workerIndex]->mutex);
+
+		if (!queues[workerIndex]->tasks.empty ()) {
+
+			task = std::move (queues[workerIndex]->tasks.back ());
+			queues[workerIndex]->tasks.pop_back ();
+			queuedTasks--;
+			return true;
+
+		}
+
+	}
+
+	// Otherwise steal the oldest task of another worker, which tends to be
+	// the largest remaining piece of work.
+	for (unsigned int i = 1; i < queueCount; i++) {
+
+		WorkerQueue& victim = *queues[(workerIndex + i) % queueCount];
+		std::lock_guard<std::mutex> lock (victim.mutex);
+
+		if (!victim.tasks.empty ()) {
+
+			task = std::move (victim.tasks.front ());
+			victim.tasks.pop_front ();
+			queuedTasks--;
+			return true;
+
+		}
+
+	}
+
+	return false;
+
+}
+
+//****************************************************************************
+void WorkStealingPool::runTask (Task& task) {
+
+	try {
+
+		task ();
+
+	} catch (...) {
+
+		std::lock_guard<std::mutex> lock (stateMutex);
+
+		if (!firstException) {
+
+			firstException = std::current_exception ();
+
+		}
+
+	}
+
+	task = nullptr;
+
+	if (--pendingTasks == 0) {
+
+		std::lock_guard<std::mutex> lock (stateMutex);
+		tasksFinished.notify_all ();
+
+	}
+
+}
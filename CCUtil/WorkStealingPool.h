@@ -0,0 +1,139 @@
+/**
+ * Author:		Charles Duncan (CharlesETD@gmail.com)
+ * Created:		Oct 18, 2026
+ * Compiler:	GCC 12.2
+ * OS:			Debian 12
+ *
+ * Work stealing overview from:		https://en.wikipedia.org/wiki/Work_stealing
+ * Various function lookups from:	http://www.cplusplus.com/reference/thread/thread/
+ *									http://www.cplusplus.com/reference/condition_variable/condition_variable/
+ *
+ *  Copyright 2016 Charles Duncan (CharlesETD@gmail.com)
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+/**
+ * Fixed-size pool of worker threads that each own a queue of tasks. Tasks
+ * submitted from a worker go to that worker's own queue, and a worker that
+ * runs out of tasks steals from the other queues, so one long job (such as a
+ * huge file split into chunks) is spread over every core instead of leaving
+ * the others idle.
+ */
+class WorkStealingPool {
+
+public:
+	// Public Types **********************************************************
+	typedef std::function<void (void)> Task;	/**< A unit of work run by the pool. */
+
+	// Public Ctors **********************************************************
+	/**
+	 * Starts the given number of worker threads.
+	 * @param threadCount, number of workers. Zero uses one worker per hardware thread.
+	 */
+	explicit WorkStealingPool (const unsigned int threadCount);
+
+	/**
+	 * Waits for outstanding tasks and stops every worker.
+	 */
+	~WorkStealingPool (void);
+
+	// Public Accessors ******************************************************
+	/**
+	 * Returns the number of worker threads.
+	 * @return the number of worker threads.
+	 */
+	unsigned int getThreadCount (void) const;
+
+	// Public Methods ********************************************************
+	/**
+	 * Queues a task. When called from inside a task the new task is pushed
+	 * onto the calling worker's own queue, otherwise queues are used in turn.
+	 * @param task to run.
+	 */
+	void submit (const Task& task);
+
+	/**
+	 * Blocks until every submitted task, including tasks submitted by other
+	 * tasks, has finished. Must not be called from a task of this pool; a
+	 * task that needs work done after its own should submit it as a task.
+	 * @throw the first exception thrown by a task since the last wait, if any.
+	 * @throw logic_error if called from a task of this pool.
+	 */
+	void wait (void);
+
+private:
+	// Private Types *********************************************************
+	/**
+	 * Queue of tasks owned by a single worker. The owner takes from the back
+	 * and thieves take from the front.
+	 */
+	struct WorkerQueue {
+
+		std::mutex			mutex;	/**< Guards tasks. */
+		std::deque<Task>	tasks;	/**< Tasks waiting to run. */
+
+	};
+
+	// Private Methods *******************************************************
+	/**
+	 * Main loop of each worker thread.
+	 * @param workerIndex, index of the worker's own queue.
+	 */
+	void runWorker (const unsigned int workerIndex);
+
+	/**
+	 * Takes the next task for the given worker, stealing if its own queue is empty.
+	 * @param workerIndex, index of the worker's own queue.
+	 * @param task, where to store the task taken.
+	 * @return true if a task was taken, otherwise false.
+	 */
+	bool takeTask (const unsigned int workerIndex, Task& task);
+
+	/**
+	 * Runs a task and records its completion.
+	 * @param task to run.
+	 */
+	void runTask (Task& task);
+
+	// Private Ctors *********************************************************
+	/**
+	 * Private copy Ctor to prevent the pool from being copied.
+	 * @param workStealingPool to copy from.
+	 */
+	WorkStealingPool (const WorkStealingPool& workStealingPool);
+
+	// Private Operators *****************************************************
+	/**
+	 * Private copy assignment operator to prevent the pool from being copied.
+	 * @param workStealingPool to copy from.
+	 * @return this WorkStealingPool.
+	 */
+	WorkStealingPool& operator= (const WorkStealingPool& workStealingPool);
+
+	// Private Members *******************************************************
+	std::vector<std::unique_ptr<WorkerQueue> >	queues;				/**< One queue per worker. */
+	std::vector<std::thread>					workers;			/**< Worker threads. */
+	std::mutex									stateMutex;			/**< Guards the sleeping and completion state below. */
+	std::condition_variable						taskAvailable;		/**< Signalled when a task is queued or the pool stops. */
+	std::condition_variable						tasksFinished;		/**< Signalled when the last pending task finishes. */
+	std::atomic<unsigned int>					queuedTasks;		/**< Tasks sitting in a queue. */
+	std::atomic<unsigned int>					pendingTasks;		/**< Tasks submitted but not yet finished. */
+	std::atomic<unsigned int>					nextQueue;			/**< Queue that the next external submission goes to. */
+	std::exception_ptr							firstException;		/**< First exception thrown by a task, guarded by stateMutex. */
+	bool										stopping;			/**< Whether the workers should exit, guarded by stateMutex. */
+
+};
+
+#endif